@@ -20,7 +20,7 @@ from ui.views.rx_view import RxView
 from scripts.udp_runner import UdpRunner, UdpRunnerConfig
 
 # --- Bitunwrap service ---
-from services.bitunwrap import BitUnwrapService, BitUnwrapError
+from services.bitunwrap import BitUnwrapService, BitUnwrapError, DEFAULT_START_FLAG
 # --- RS decode (DLL) ---
 from services.rs_container import RSContainer
 
@@ -92,6 +92,10 @@ class RxController(QObject):
         self._bitwrap_path = None
         self._unwrapped_path = None
         self._decoded_path = None
+        # Native udp_dump (native/Udp_Capture) varsa datagramlar sıra numaralıdır:
+        # boşluklar <out.bitwrap>.rseh'e yazılır ve RS decode'da silme olarak yüklenir
+        self._udp_seq = False
+        self._hints_path = None
 
         # RS decode service
         self._rs = RSContainer()
@@ -218,10 +222,17 @@ class RxController(QObject):
             scripts_dir = Path(paths.dir_scripts())
         else:
             scripts_dir = Path(__file__).resolve().parent.parent / "scripts"
-        udp_exe = scripts_dir / "udp_dump+.exe"
+        udp_exe, self._udp_seq = self._udp_exe(scripts_dir)
+        self._hints_path = Path(str(self._bitwrap_path) + ".rseh") if self._udp_seq else None
+        if self._hints_path and self._hints_path.exists():
+            try:
+                self._hints_path.unlink()      # önceki oturumun boşlukları
+            except Exception:
+                pass
 
         cfg = UdpRunnerConfig(
             exe_path=str(udp_exe),
+            extra_args=(["--seq", "gr", "--hints", str(self._hints_path)] if self._udp_seq else []),
             bind_ip="0.0.0.0",
             port=2000,
             out_file=self._out_name,
@@ -359,6 +370,14 @@ class RxController(QObject):
         # Smooth progress update
         self._update_progress_smooth()
 
+    @staticmethod
+    def _udp_exe(scripts_dir: Path):
+        """(exe, seq): native udp_dump (sequence-numbered datagrams) if built, else the prebuilt udp_dump+."""
+        native = scripts_dir / ("udp_dump.exe" if os.name == "nt" else "udp_dump")
+        if native.exists():
+            return native, True
+        return scripts_dir / "udp_dump+.exe", False
+
     # ---------- RX start/stop ----------
     def _start_rx(self):
         """Start rx_runner.py in a NEW console and show logs in that console."""
@@ -433,6 +452,8 @@ class RxController(QObject):
             "--gain_db",   str(gain_db),
             "--mod", mod_arg,
         ]
+        if self._udp_seq:
+            args.append("--udp-seq")
         self.view.append_log("[RX] Spawn: %s" % " ".join(args))
 
         # Env (portable PATH augmentation)
@@ -641,6 +662,7 @@ class RxController(QObject):
                     self.view.append_log("[BITUNWRAP] Flags: start=%s  end=%s" %
                                          (res.start_flag_pos, res.end_flag_pos))
                 self._pp_log(f"UNWRAP: flags start={res.start_flag_pos} end={res.end_flag_pos}")
+                self._load_gap_hints(res.start_flag_pos)
                 dt = time.perf_counter() - t0
 
                 self._pp_log(f"UNWRAP: done in {dt:.2f}s → out={self._unwrapped_path.name}")
@@ -662,6 +684,20 @@ class RxController(QObject):
         self._worker = threading.Thread(target=_worker, daemon=True)
         self._worker.start()
 
+    def _load_gap_hints(self, start_flag_pos):
+        """UDP sequence gaps → RS erasures (container base = start flag pos + flag length)."""
+        self._rs.clear_hints()
+        hp = self._hints_path
+        if (not hp) or (not hp.exists()) or (start_flag_pos is None):
+            return
+        try:
+            n = self._rs.load_hints(str(hp), int(start_flag_pos) + len(DEFAULT_START_FLAG))
+            if n:
+                self.view.append_log("[DECODE] UDP gaps → %d missing range(s) marked as erasures" % n)
+            self._pp_log(f"HINTS: {hp.name} ranges={n}")
+        except Exception as e:
+            self._pp_log(f"HINTS[WARN] {e}")
+
     def _start_decode_worker(self):
         if not self._unwrapped_path or (not self._unwrapped_path.exists()):
             self.view.append_log("[DECODE][ERROR] Unwrapped file not found: %s" % self._unwrapped_path)
@@ -715,6 +751,9 @@ class RxController(QObject):
                                              % (ok, bad, fail_cols, ber))
                         # post-process log (BER dahil)
                         self._pp_log(f"STATS: slices ok/bad={ok}/{bad} rs_fail_cols={fail_cols} BER≈{ber:.3e}")
+                        gs = self._rs.get_gap_stats() if self._hints_path else None
+                        if gs and gs["gaps_skipped"]:
+                            self._pp_log(f"STATS: gaps skipped={gs['gaps_skipped']} bytes={gs['bytes_skipped']}")
                     else:
                         self.view.set_ber_text("BER: —")
                         self._pp_log("STATS: BER unavailable (—)")
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 #if defined(_WIN32)
@@ -16,3 +17,26 @@ BITUNWRAP_API int unwrap_file_bits(
 
 BITUNWRAP_API std::uint64_t get_last_start_flag_pos();
 BITUNWRAP_API std::uint64_t get_last_end_flag_pos();
+
+// Akış (streaming) sürümü: unwrap_file_bits ile aynı bayrak/çıktı davranışı, girdi
+// parça parça beslenir (ör. UDP yakalama thread'inden), çıktı sink'e gider.
+// Durum: 0 başlangıç bayrağı aranıyor, 1 yük, 2 bitiş bayrağı bulundu (sonrası yok sayılır).
+typedef struct bitunwrap_stream bitunwrap_stream;
+typedef void (*bitunwrap_sink_fn)(void* user, const std::uint8_t* data, std::size_t n);
+
+BITUNWRAP_API bitunwrap_stream* unwrap_stream_create(
+    const char* start_flag_bits,
+    const char* end_flag_bits,
+    bitunwrap_sink_fn sink,
+    void* user
+);
+BITUNWRAP_API int  unwrap_stream_feed(bitunwrap_stream* s, const std::uint8_t* data, std::size_t n);
+// Kalan bitleri bayta tamamlayıp sink'e verir. 0: bitiş bulundu, -4: bulunamadı
+BITUNWRAP_API int  unwrap_stream_finish(bitunwrap_stream* s);
+BITUNWRAP_API void unwrap_stream_destroy(bitunwrap_stream* s);
+
+BITUNWRAP_API int           unwrap_stream_state(const bitunwrap_stream* s);
+BITUNWRAP_API std::uint64_t unwrap_stream_start_pos(const bitunwrap_stream* s);   // get_last_start_flag_pos eşi
+BITUNWRAP_API std::uint64_t unwrap_stream_end_pos(const bitunwrap_stream* s);
+BITUNWRAP_API std::uint64_t unwrap_stream_bits_in(const bitunwrap_stream* s);
+BITUNWRAP_API std::uint64_t unwrap_stream_bytes_out(const bitunwrap_stream* s);
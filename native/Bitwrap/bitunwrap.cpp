@@ -220,3 +220,189 @@ BITUNWRAP_API int unwrap_file_bits(
         return -99;
     }
 }
+
+// -------------------- Streaming --------------------
+// Bayt başına geçiş tablosu: (eşleşen bit sayısı, bayt) -> sonraki durum ve ilk eşleşmenin
+// bit konumu (8: yok). Eşleşme olmayan baytlar 8 KMP adımı yerine tek bakışla geçer.
+class ByteDfa {
+public:
+    void reset(const std::vector<uint8_t>& pat) {
+        const size_t L = pat.size();
+        std::vector<int> lps(L, 0);
+        for (size_t i = 1, len = 0; i < L; ) {
+            if (pat[i] == pat[len]) lps[i++] = static_cast<int>(++len);
+            else if (len != 0) len = static_cast<size_t>(lps[len - 1]);
+            else lps[i++] = 0;
+        }
+        bit_.assign(L * 2, 0);
+        for (size_t j = 0; j < L; ++j) {
+            for (uint8_t b = 0; b < 2; ++b) {
+                size_t k = j;
+                while (k > 0 && b != pat[k]) k = static_cast<size_t>(lps[k - 1]);
+                if (b == pat[k]) ++k;
+                bit_[j * 2 + b] = static_cast<uint32_t>(k);     // k == L: eşleşme
+            }
+        }
+        // Eşleşmeden sonra devam durumu (KMP: lps[L-1])
+        after_ = static_cast<uint32_t>(lps[L - 1]);
+        L_ = static_cast<uint32_t>(L);
+        byte_.assign(L * 256, 0);
+        hit_.assign(L * 256, 8);
+        for (size_t j = 0; j < L; ++j) {
+            for (int v = 0; v < 256; ++v) {
+                uint32_t k = static_cast<uint32_t>(j);
+                for (int t = 7; t >= 0; --t) {
+                    k = step(k, static_cast<uint8_t>((v >> t) & 1));
+                    if (k == L_) { hit_[j * 256 + v] = static_cast<uint8_t>(7 - t); k = after_; break; }
+                }
+                byte_[j * 256 + v] = k;
+            }
+        }
+    }
+    // Tek bit; dönüş L: eşleşme (çağıran after() ile sürdürür)
+    inline uint32_t step(uint32_t j, uint8_t b) const { return bit_[j * 2 + b]; }
+    inline uint32_t after() const { return after_; }
+    inline uint32_t len() const { return L_; }
+    // Eşleşmesiz bayt: hit == 8 ise next geçerli
+    inline uint8_t  hit(uint32_t j, uint8_t v) const { return hit_[j * 256u + v]; }
+    inline uint32_t next(uint32_t j, uint8_t v) const { return byte_[j * 256u + v]; }
+
+private:
+    std::vector<uint32_t> bit_, byte_;
+    std::vector<uint8_t>  hit_;
+    uint32_t after_ = 0, L_ = 0;
+};
+
+struct bitunwrap_stream {
+    ByteDfa dfa_start, dfa_end;
+    uint32_t js = 0, je = 0;         // bayrak eşleşme durumları
+
+    // Bitiş bayrağı kadar gecikme: son Lend bit çıktıya verilmeden tutulur
+    std::vector<uint8_t> tail;       // halka, 2'nin kuvveti >= Lend + 1
+    size_t t_mask = 0, t_head = 0, t_n = 0;
+
+    uint8_t acc = 0, bit_off = 0;
+    std::vector<uint8_t> out;
+    bitunwrap_sink_fn sink = nullptr;
+    void* user = nullptr;
+
+    int state = 0;
+    std::uint64_t bit_index = 0, start_pos = 0, end_pos = 0, bytes_out = 0;
+
+    inline void put_bit(uint8_t b) {
+        acc |= static_cast<uint8_t>((b & 1u) << (7 - bit_off));
+        if (++bit_off == 8) { out.push_back(acc); acc = 0; bit_off = 0; }
+    }
+    inline void push_bit(uint8_t b) {
+        tail[(t_head + t_n) & t_mask] = b;
+        if (++t_n > dfa_end.len()) {
+            put_bit(tail[t_head]);
+            t_head = (t_head + 1) & t_mask;
+            --t_n;
+        }
+    }
+    void flush() {
+        if (out.empty()) return;
+        if (sink) sink(user, out.data(), out.size());
+        bytes_out += out.size();
+        out.clear();
+    }
+};
+
+static constexpr size_t kStreamOutFlush = 64u << 10;
+
+BITUNWRAP_API bitunwrap_stream* unwrap_stream_create(
+    const char* start_flag_bits,
+    const char* end_flag_bits,
+    bitunwrap_sink_fn sink,
+    void* user)
+{
+    try {
+        std::vector<uint8_t> start_bits = parse_bitstring_(start_flag_bits);
+        std::vector<uint8_t> end_bits   = parse_bitstring_(end_flag_bits);
+        if (start_bits.empty() || end_bits.empty()) return nullptr;
+        auto* s = new bitunwrap_stream;
+        s->dfa_start.reset(start_bits);
+        s->dfa_end.reset(end_bits);
+        size_t cap = 2;
+        while (cap < end_bits.size() + 1) cap <<= 1;
+        s->tail.assign(cap, 0);
+        s->t_mask = cap - 1;
+        s->out.reserve(kStreamOutFlush + 64);
+        s->sink = sink;
+        s->user = user;
+        return s;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+// Eşleşme içeren baytın bitleri tek tek (unwrap_file_bits ile aynı sıra)
+static void feed_bits_(bitunwrap_stream* s, uint8_t byte, int from) {
+    for (int k = 7 - from; k >= 0 && s->state != 2; --k) {
+        const uint8_t b = static_cast<uint8_t>((byte >> k) & 1u);
+        s->bit_index++;
+        if (s->state == 0) {
+            s->js = s->dfa_start.step(s->js, b);
+            if (s->js == s->dfa_start.len()) {
+                s->js = s->dfa_start.after();
+                s->start_pos = s->bit_index - s->dfa_start.len();
+                s->state = 1;
+            }
+            continue;
+        }
+        s->je = s->dfa_end.step(s->je, b);
+        if (s->je == s->dfa_end.len()) {
+            // Bayrak bitleri gecikme hattında: onları at, kalanı yaz, bayta tamamla
+            s->end_pos = s->bit_index - s->dfa_end.len();
+            const size_t Lend = s->dfa_end.len();
+            s->tail[(s->t_head + s->t_n) & s->t_mask] = b;
+            ++s->t_n;
+            s->t_n = (s->t_n >= Lend) ? s->t_n - Lend : 0;
+            while (s->t_n) { s->put_bit(s->tail[s->t_head]); s->t_head = (s->t_head + 1) & s->t_mask; --s->t_n; }
+            while (s->bit_off) s->put_bit(0);
+            s->state = 2;
+            return;
+        }
+        s->push_bit(b);
+    }
+}
+
+BITUNWRAP_API int unwrap_stream_feed(bitunwrap_stream* s, const std::uint8_t* data, std::size_t n) {
+    if (!s) return -1;
+    for (size_t i = 0; i < n && s->state != 2; ++i) {
+        const uint8_t v = data[i];
+        if (s->state == 0) {
+            if (s->dfa_start.hit(s->js, v) == 8) { s->js = s->dfa_start.next(s->js, v); s->bit_index += 8; continue; }
+            // Bayrak bu baytta biter: kalan bitler yük durumunda işlenir
+            const int h = s->dfa_start.hit(s->js, v);
+            s->bit_index += static_cast<std::uint64_t>(h) + 1;
+            s->start_pos = s->bit_index - s->dfa_start.len();
+            s->state = 1;
+            feed_bits_(s, v, h + 1);
+        } else if (s->dfa_end.hit(s->je, v) == 8) {
+            s->je = s->dfa_end.next(s->je, v);
+            s->bit_index += 8;
+            for (int k = 7; k >= 0; --k) s->push_bit(static_cast<uint8_t>((v >> k) & 1u));
+        } else {
+            feed_bits_(s, v, 0);
+        }
+        if (s->out.size() >= kStreamOutFlush) s->flush();
+    }
+    s->flush();
+    return s->state;
+}
+
+BITUNWRAP_API int unwrap_stream_finish(bitunwrap_stream* s) {
+    if (!s) return -1;
+    s->flush();
+    return s->state == 2 ? 0 : -4;
+}
+
+BITUNWRAP_API void unwrap_stream_destroy(bitunwrap_stream* s) { delete s; }
+
+BITUNWRAP_API int           unwrap_stream_state(const bitunwrap_stream* s)     { return s ? s->state : -1; }
+BITUNWRAP_API std::uint64_t unwrap_stream_start_pos(const bitunwrap_stream* s) { return s ? s->start_pos : 0; }
+BITUNWRAP_API std::uint64_t unwrap_stream_end_pos(const bitunwrap_stream* s)   { return s ? s->end_pos : 0; }
+BITUNWRAP_API std::uint64_t unwrap_stream_bits_in(const bitunwrap_stream* s)   { return s ? s->bit_index : 0; }
+BITUNWRAP_API std::uint64_t unwrap_stream_bytes_out(const bitunwrap_stream* s) { return s ? s->bytes_out : 0; }
@@ -0,0 +1,66 @@
+// checksum.h — modem, RS konteyner ve yakalama araçlarının ortak CRC çekirdekleri.
+//
+// C (rs_container.c) ve C++ (Ofdm_Modem) aynı kaynağı derler; DLL'lere statik
+// bağlanır, dışa aktarılmaz. Tüm CRC'ler mevcut biçimlerle bit bit aynıdır:
+//  - CRC-32: yansıtılmış 0x04C11DB7, init/xorout 0xFFFFFFFF (zlib / crc32_bb)
+//  - CRC-16: CCITT-FALSE, 0x1021, init 0xFFFF, xorout yok (konteyner shard tabloları)
+//  - CRC-8 : 0x07, init 0xFF (packet_header_default)
+// x86 + GCC/Clang'da CRC-32 toplu yolu PCLMULQDQ katlaması kullanır (çalışma anı
+// seçimi); diğer derleyicilerde dilimleme-8 tablo yolu.
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- CRC-32 ----
+// Tam CRC: ck_crc32(buf, n) == zlib crc32(0, buf, n)
+uint32_t ck_crc32(const uint8_t* buf, size_t len);
+// Parça parça: crc = 0 ile başla, önceki dönüşü ver (zlib crc32(crc, ...) ile aynı)
+uint32_t ck_crc32_update(uint32_t crc, const uint8_t* buf, size_t len);
+// Kopyala + CRC tek geçişte (dilim başlığı kurarken ayrı tarama yok)
+uint32_t ck_crc32_copy(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t len);
+
+// Birleştirme: crc(A||B) = ck_crc32_combine(crc(A), crc(B), len(B)); veri okunmaz.
+uint32_t ck_crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b);
+// Aynı uzunluk tekrar tekrar birleştirilecekse: op bir kez üretilir (x^(8*len_b) mod P)
+uint32_t ck_crc32_combine_gen(uint64_t len_b);
+uint32_t ck_crc32_combine_op(uint32_t crc_a, uint32_t crc_b, uint32_t op);
+
+// 1: PCLMUL yolu etkin
+int ck_crc32_simd(void);
+
+// ---- CRC-16 (CCITT-FALSE) ----
+uint16_t ck_crc16_ccitt(const uint8_t* buf, size_t len);
+// n_blocks ardışık block_len'lik blok, her biri ayrı CRC (shard tabloları); dört blok
+// aynı döngüde serpiştirilir (bağımlılık zinciri kısalır)
+void ck_crc16_ccitt_blocks(const uint8_t* buf, size_t n_blocks, size_t block_len, uint16_t* out);
+
+// ---- OFDM paket CRC'si ve header ----
+// crc32_bb(packed=False): her öğe bir "bit", LSB önce 8'li paketlenir (maskeleme yok,
+// GNU Radio ile aynı), yalnız tam baytlar
+uint32_t ck_crc32_unpacked(const uint8_t* items, size_t n_items);
+
+#define CK_HEADER_BITS 48
+// packet_header_default (bits_per_byte=1): 12 bit uzunluk + 12 bit no + CRC8, kalan 0
+uint8_t ck_header_crc8(uint16_t len, uint16_t number);
+void    ck_header_bits(uint32_t len, uint16_t number, uint8_t out[CK_HEADER_BITS]);
+// 32 bitlik header kelimesi (bit i = header biti i); -1: CRC8 ya da biçim hatası
+int32_t ck_header_parse(uint32_t word, uint16_t* len, uint16_t* number);
+
+// TX tek geçiş: payload -> items (payload + 32 CRC bit-baytı) ve header bitleri
+// (uzunluk alanı n + 32, hdrgen'in crc çıkışına bağlı olduğu gibi)
+void ck_packet_build(const uint8_t* payload, size_t n, uint16_t number,
+                     uint8_t* items, uint8_t header[CK_HEADER_BITS]);
+// RX: items'ın son 32 öğesi ilk n_items-32 öğenin CRC'si mi (1/0)
+int  ck_packet_check(const uint8_t* items, size_t n_items);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CHECKSUM_H
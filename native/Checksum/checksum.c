@@ -0,0 +1,312 @@
+// checksum.c — ortak CRC çekirdekleri (bkz. Include/checksum.h)
+//
+// C ve C++ olarak derlenebilir (g++ .c dosyasını C++ sayar); bu yüzden örtük void*
+// dönüşümü ve C'ye özgü sözdizimi yok.
+//
+// Tablolar ilk çağrıda doldurulur (rs_container.c'deki crc32_init ile aynı desen);
+// aynı anda iki iş parçacığı doldursa da aynı değerleri yazar.
+
+#include "Include/checksum.h"
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define CK_X86 1
+  #include <immintrin.h>
+#else
+  #define CK_X86 0
+#endif
+
+#define CK_POLY32 0xEDB88320u
+
+static uint32_t g_t32[8][256];       // dilimleme-8: t[k][b] = b'nin k bayt sonraki etkisi
+static uint16_t g_t16[256];
+static uint8_t  g_t8[256];
+static uint32_t g_x2n[32];           // x^(2^n) mod P (birleştirme)
+static int      g_simd = 0;
+static volatile int g_init = 0;
+
+// a*b mod P, yansıtılmış gösterim (bit 31 = x^0)
+static uint32_t multmodp_(uint32_t a, uint32_t b) {
+    uint32_t m = 1u << 31, p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) break;
+        }
+        m >>= 1;
+        b = (b & 1u) ? (b >> 1) ^ CK_POLY32 : b >> 1;
+    }
+    return p;
+}
+
+static void ck_init_(void) {
+    if (g_init) return;
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k) c = (c & 1u) ? (CK_POLY32 ^ (c >> 1)) : (c >> 1);
+        g_t32[0][i] = c;
+    }
+    for (int k = 1; k < 8; ++k)
+        for (int i = 0; i < 256; ++i)
+            g_t32[k][i] = (g_t32[k - 1][i] >> 8) ^ g_t32[0][g_t32[k - 1][i] & 0xFFu];
+    for (int i = 0; i < 256; ++i) {
+        uint16_t c = (uint16_t)(i << 8);
+        for (int k = 0; k < 8; ++k) c = (c & 0x8000) ? (uint16_t)((c << 1) ^ 0x1021) : (uint16_t)(c << 1);
+        g_t16[i] = c;
+        uint8_t d = (uint8_t)i;
+        for (int k = 0; k < 8; ++k) d = (d & 0x80) ? (uint8_t)((d << 1) ^ 0x07) : (uint8_t)(d << 1);
+        g_t8[i] = d;
+    }
+    uint32_t p = 1u << 30;            // x^1
+    g_x2n[0] = p;
+    for (int n = 1; n < 32; ++n) g_x2n[n] = p = multmodp_(p, p);
+#if CK_X86
+    __builtin_cpu_init();
+    g_simd = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+    g_init = 1;
+}
+
+// ---------------------------------------------------------------- CRC-32
+
+static inline uint32_t ld32_(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// c: iç durum (init/xorout uygulanmış hali)
+static uint32_t crc32_sb8_(uint32_t c, const uint8_t* p, size_t n) {
+    while (n >= 8) {
+        const uint32_t lo = c ^ ld32_(p), hi = ld32_(p + 4);
+        c = g_t32[7][lo & 0xFFu] ^ g_t32[6][(lo >> 8) & 0xFFu] ^ g_t32[5][(lo >> 16) & 0xFFu] ^ g_t32[4][lo >> 24]
+          ^ g_t32[3][hi & 0xFFu] ^ g_t32[2][(hi >> 8) & 0xFFu] ^ g_t32[1][(hi >> 16) & 0xFFu] ^ g_t32[0][hi >> 24];
+        p += 8;
+        n -= 8;
+    }
+    while (n--) c = g_t32[0][(c ^ *p++) & 0xFFu] ^ (c >> 8);
+    return c;
+}
+
+#if CK_X86
+// PCLMULQDQ katlaması (Intel "Fast CRC Computation Using PCLMULQDQ", yansıtılmış
+// sabitler): 4x128 bit paralel katla, 128'e indir, 64 -> 32 Barrett. n >= 64, n % 16 == 0.
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32_clmul_(uint32_t c, const uint8_t* p, size_t n) {
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128((const __m128i*)(p + 0x00));
+    __m128i x2 = _mm_loadu_si128((const __m128i*)(p + 0x10));
+    __m128i x3 = _mm_loadu_si128((const __m128i*)(p + 0x20));
+    __m128i x4 = _mm_loadu_si128((const __m128i*)(p + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)c));
+    p += 64;
+    n -= 64;
+
+    while (n >= 64) {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(p + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(p + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(p + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(p + 0x30)));
+        p += 64;
+        n -= 64;
+    }
+
+    __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x4), x5);
+
+    while (n >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11),
+                                         _mm_loadu_si128((const __m128i*)p)), x5);
+        p += 16;
+        n -= 16;
+    }
+
+    // 128 -> 64
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5k0, 0x00), x2);
+
+    // Barrett -> 32
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+#endif
+
+static uint32_t crc32_raw_(uint32_t c, const uint8_t* p, size_t n) {
+#if CK_X86
+    if (g_simd && n >= 64) {
+        const size_t m = n & ~(size_t)15;
+        c = crc32_clmul_(c, p, m);
+        p += m;
+        n -= m;
+    }
+#endif
+    return crc32_sb8_(c, p, n);
+}
+
+uint32_t ck_crc32_update(uint32_t crc, const uint8_t* buf, size_t len) {
+    ck_init_();
+    return ~crc32_raw_(~crc, buf, len);
+}
+
+uint32_t ck_crc32(const uint8_t* buf, size_t len) {
+    return ck_crc32_update(0u, buf, len);
+}
+
+// L1'de kalan parçalar: kopyalanan blok CRC için yeniden bellekten okunmaz
+uint32_t ck_crc32_copy(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t len) {
+    ck_init_();
+    uint32_t c = ~crc;
+    while (len) {
+        const size_t n = len < 2048 ? len : 2048;
+        memcpy(dst, src, n);
+        c = crc32_raw_(c, dst, n);
+        dst += n;
+        src += n;
+        len -= n;
+    }
+    return ~c;
+}
+
+uint32_t ck_crc32_combine_gen(uint64_t len_b) {
+    ck_init_();
+    uint32_t p = 1u << 31;            // x^0
+    unsigned k = 3;                   // bayt -> bit: x^(8*len)
+    while (len_b) {
+        if (len_b & 1u) p = multmodp_(g_x2n[k & 31u], p);
+        len_b >>= 1;
+        ++k;
+    }
+    return p;
+}
+
+uint32_t ck_crc32_combine_op(uint32_t crc_a, uint32_t crc_b, uint32_t op) {
+    return multmodp_(op, crc_a) ^ crc_b;
+}
+
+uint32_t ck_crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b) {
+    return ck_crc32_combine_op(crc_a, crc_b, ck_crc32_combine_gen(len_b));
+}
+
+int ck_crc32_simd(void) {
+    ck_init_();
+    return g_simd;
+}
+
+// ---------------------------------------------------------------- CRC-16
+
+uint16_t ck_crc16_ccitt(const uint8_t* buf, size_t len) {
+    ck_init_();
+    uint16_t c = 0xFFFF;
+    for (size_t i = 0; i < len; ++i) c = (uint16_t)((c << 8) ^ g_t16[((c >> 8) ^ buf[i]) & 0xFF]);
+    return c;
+}
+
+void ck_crc16_ccitt_blocks(const uint8_t* buf, size_t n_blocks, size_t block_len, uint16_t* out) {
+    ck_init_();
+    size_t b = 0;
+    for (; b + 4 <= n_blocks; b += 4) {
+        const uint8_t* p0 = buf + b * block_len;
+        const uint8_t* p1 = p0 + block_len;
+        const uint8_t* p2 = p1 + block_len;
+        const uint8_t* p3 = p2 + block_len;
+        uint16_t c0 = 0xFFFF, c1 = 0xFFFF, c2 = 0xFFFF, c3 = 0xFFFF;
+        for (size_t i = 0; i < block_len; ++i) {
+            c0 = (uint16_t)((c0 << 8) ^ g_t16[((c0 >> 8) ^ p0[i]) & 0xFF]);
+            c1 = (uint16_t)((c1 << 8) ^ g_t16[((c1 >> 8) ^ p1[i]) & 0xFF]);
+            c2 = (uint16_t)((c2 << 8) ^ g_t16[((c2 >> 8) ^ p2[i]) & 0xFF]);
+            c3 = (uint16_t)((c3 << 8) ^ g_t16[((c3 >> 8) ^ p3[i]) & 0xFF]);
+        }
+        out[b] = c0; out[b + 1] = c1; out[b + 2] = c2; out[b + 3] = c3;
+    }
+    for (; b < n_blocks; ++b) out[b] = ck_crc16_ccitt(buf + b * block_len, block_len);
+}
+
+// ---------------------------------------------------------------- OFDM paketi
+
+static inline uint8_t pack8_(const uint8_t* it) {
+    return (uint8_t)(it[0] | (it[1] << 1) | (it[2] << 2) | (it[3] << 3) |
+                     (it[4] << 4) | (it[5] << 5) | (it[6] << 6) | (it[7] << 7));
+}
+
+// Öğeler 64'lük gruplarla paketlenip dilimleme-8 yoluna verilir; isteğe bağlı kopya
+static uint32_t crc32_unpacked_(const uint8_t* items, size_t n_items, uint8_t* copy) {
+    ck_init_();
+    uint8_t  pk[64];
+    uint32_t c = 0xFFFFFFFFu;
+    size_t nbytes = n_items / 8, i = 0;
+    while (i < nbytes) {
+        const size_t m = (nbytes - i) < sizeof(pk) ? (nbytes - i) : sizeof(pk);
+        const uint8_t* src = items + i * 8;
+        if (copy) memcpy(copy + i * 8, src, m * 8);
+        for (size_t j = 0; j < m; ++j) pk[j] = pack8_(src + j * 8);
+        c = crc32_sb8_(c, pk, m);
+        i += m;
+    }
+    if (copy && (n_items & 7u)) memcpy(copy + nbytes * 8, items + nbytes * 8, n_items & 7u);
+    return ~c;
+}
+
+uint32_t ck_crc32_unpacked(const uint8_t* items, size_t n_items) {
+    return crc32_unpacked_(items, n_items, NULL);
+}
+
+uint8_t ck_header_crc8(uint16_t len, uint16_t number) {
+    ck_init_();
+    const uint8_t buf[4] = { (uint8_t)(len & 0xFF), (uint8_t)(len >> 8), (uint8_t)(number & 0xFF), (uint8_t)(number >> 8) };
+    uint8_t c = 0xFF;
+    for (int i = 0; i < 4; ++i) c = g_t8[c ^ buf[i]];
+    return c;
+}
+
+void ck_header_bits(uint32_t len, uint16_t number, uint8_t out[CK_HEADER_BITS]) {
+    const uint16_t l = (uint16_t)(len & 0x0FFF);
+    const uint16_t n = (uint16_t)(number & 0x0FFF);
+    const uint32_t w = (uint32_t)l | ((uint32_t)n << 12) | ((uint32_t)ck_header_crc8(l, n) << 24);
+    for (int i = 0; i < 32; ++i) out[i] = (uint8_t)((w >> i) & 1u);
+    memset(out + 32, 0, CK_HEADER_BITS - 32);
+}
+
+int32_t ck_header_parse(uint32_t word, uint16_t* len, uint16_t* number) {
+    const uint16_t l = (uint16_t)(word & 0x0FFF);
+    const uint16_t n = (uint16_t)((word >> 12) & 0x0FFF);
+    if ((uint8_t)(word >> 24) != ck_header_crc8(l, n)) return -1;
+    if (len) *len = l;
+    if (number) *number = n;
+    return 0;
+}
+
+void ck_packet_build(const uint8_t* payload, size_t n, uint16_t number,
+                     uint8_t* items, uint8_t header[CK_HEADER_BITS]) {
+    const uint32_t crc = crc32_unpacked_(payload, n, items);
+    for (int i = 0; i < 32; ++i) items[n + (size_t)i] = (uint8_t)((crc >> i) & 1u);
+    ck_header_bits((uint32_t)(n + 32), number, header);
+}
+
+int ck_packet_check(const uint8_t* items, size_t n_items) {
+    if (n_items < 32) return 0;
+    const size_t n = n_items - 32;
+    const uint32_t c = crc32_unpacked_(items, n, NULL);
+    uint32_t acc = 0;
+    for (int i = 0; i < 32; ++i) acc |= (uint32_t)items[n + (size_t)i] ^ ((c >> i) & 1u);
+    return acc == 0;
+}
@@ -0,0 +1,221 @@
+// bench/detect_latency_bench.cpp — jammer başlangıcı -> SustainedJammer -> UDP START gecikmesi
+// ve Detector::run verim tavanı (samples_per_frame x detect_jammer_consecutive taraması).
+//
+// Kaynak: gürültü + zamanlanmış jammer patlamaları. Başlangıç örneği bilindiği için
+// tepki süresi örnek zamanında (sinyal ms) ölçülür; işlem gecikmesi ise tetikleyen
+// frame'in teslimi ile UdpIndex::start() dönüşü arasındaki duvar saati süresidir.
+#include "jd/detector.hpp"
+#include "jd/power_meter.hpp"
+#include "jd/udp_index.hpp"
+#include "jd/utils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <vector>
+#include <complex>
+#include <random>
+#include <chrono>
+
+namespace {
+
+using clock_t_ = std::chrono::steady_clock;
+
+struct ScheduleConfig {
+    int    spf          = 4096;
+    double samp_hz      = 4e6;
+    double noise_std    = 0.02;
+    double jsr_db       = 6.0;    // jammer / gürültü güç oranı
+    int    gap_min      = 20;     // patlamalar arası temiz frame
+    int    gap_max      = 60;
+    int    burst_frames = 50;     // tespit edilmezse patlama uzunluğu
+    int    bursts       = 200;
+    uint32_t seed       = 7;
+};
+
+// Gürültü + zamanlanmış patlamalar. Frameler önceden üretilmiş havuzdan kopyalanır,
+// böylece ölçüm ağırlıklı olarak Detector'ın kendisini gösterir.
+class ScheduledJamSource : public jd::ISource {
+public:
+    explicit ScheduledJamSource(const ScheduleConfig& c) : c_(c), rng_(c.seed) {
+        std::normal_distribution<float> nd(0.0f, static_cast<float>(c_.noise_std));
+        const float jam_std = static_cast<float>(c_.noise_std * std::pow(10.0, c_.jsr_db / 20.0));
+        std::normal_distribution<float> jd_(0.0f, jam_std);
+        clean_.resize(kPool);
+        jam_.resize(kPool);
+        for (int k = 0; k < kPool; ++k) {
+            clean_[k].resize(c_.spf);
+            jam_[k].resize(c_.spf);
+            for (int i = 0; i < c_.spf; ++i) {
+                clean_[k][i] = { nd(rng_), nd(rng_) };
+                jam_[k][i]   = clean_[k][i] + std::complex<float>(jd_(rng_), jd_(rng_));
+            }
+        }
+        schedule_next();
+    }
+
+    bool get_frame(std::vector<std::complex<float>>& out) override {
+        if (done_ >= c_.bursts) return false;
+        const uint64_t f0 = pos_;                      // frame ilk örneği
+        const uint64_t f1 = pos_ + static_cast<uint64_t>(c_.spf);
+        const auto& cl = clean_[frame_ % kPool];
+        const auto& jm = jam_[frame_ % kPool];
+
+        if (f1 <= onset_ || f0 >= burst_end_) {
+            out = cl;
+        } else if (f0 >= onset_ && f1 <= burst_end_) {
+            out = jm;
+        } else {                                       // kısmi kaplama
+            out = cl;
+            const uint64_t a = std::max(f0, onset_), b = std::min(f1, burst_end_);
+            for (uint64_t s = a; s < b; ++s) out[s - f0] = jm[s - f0];
+        }
+        pos_ = f1;
+        ++frame_;
+        if (f1 <= onset_ || f0 >= burst_end_) ++clean_frames_;
+        if (pos_ >= burst_end_) {                      // patlama kaçırıldı
+            if (!hit_) ++missed_;
+            ++done_;
+            schedule_next();
+        }
+        t_last_ = clock_t_::now();
+        return true;
+    }
+
+    // Tespit anında çağrılır: true -> gerçek tespit (gecikme yazılır), false -> yanlış alarm
+    bool on_detect(double& latency_ms) {
+        if (pos_ <= onset_) return false;
+        latency_ms = static_cast<double>(pos_ - onset_) * 1000.0 / c_.samp_hz;
+        hit_ = true;
+        ++done_;
+        schedule_next();                               // jammer ele alındı: sıradaki boşluk
+        return true;
+    }
+
+    clock_t_::time_point last_delivery() const { return t_last_; }
+    uint64_t frames() const { return frame_; }
+    uint64_t clean_frames() const { return clean_frames_; }
+    int missed() const { return missed_; }
+
+private:
+    void schedule_next() {
+        std::uniform_int_distribution<int> gap(c_.gap_min, c_.gap_max);
+        std::uniform_int_distribution<int> off(0, c_.spf - 1);
+        onset_ = pos_ + static_cast<uint64_t>(gap(rng_)) * c_.spf + static_cast<uint64_t>(off(rng_));
+        burst_end_ = onset_ + static_cast<uint64_t>(c_.burst_frames) * c_.spf;
+        hit_ = false;
+    }
+
+    static constexpr int kPool = 16;
+    ScheduleConfig c_;
+    std::mt19937 rng_;
+    std::vector<std::vector<std::complex<float>>> clean_, jam_;
+    uint64_t pos_ = 0, frame_ = 0, clean_frames_ = 0;
+    uint64_t onset_ = 0, burst_end_ = 0;
+    bool hit_ = false;
+    int done_ = 0, missed_ = 0;
+    clock_t_::time_point t_last_{};
+};
+
+// Eşik: temiz ve jammer'lı ortalama güçlerin dB ortası (iki tepeli GMM eşiğinin yaklaşığı)
+double midpoint_threshold(const ScheduleConfig& c) {
+    const double clean_w = 2.0 * c.noise_std * c.noise_std;
+    const double jam_w   = clean_w * (1.0 + std::pow(10.0, c.jsr_db / 10.0));
+    return 0.5 * (10.0 * std::log10(clean_w) + 10.0 * std::log10(jam_w)) + 30.0;
+}
+
+// Konumsal argümanlar: [bursts] [samp_hz] [jsr_db] [udp_port]; sayı olmayan/aralık dışı -> false
+bool parse(int argc, char** argv, ScheduleConfig& c, uint16_t& port) {
+    if (argc > 5) return false;
+    char* end = nullptr;
+    if (argc > 1) {
+        const long v = std::strtol(argv[1], &end, 10);
+        if (*end != '\0' || v <= 0 || v > 1000000) return false;
+        c.bursts = static_cast<int>(v);
+    }
+    if (argc > 2) {
+        c.samp_hz = std::strtod(argv[2], &end);
+        if (*end != '\0' || !(c.samp_hz > 0.0) || !std::isfinite(c.samp_hz)) return false;
+    }
+    if (argc > 3) {
+        c.jsr_db = std::strtod(argv[3], &end);
+        if (*end != '\0' || !std::isfinite(c.jsr_db)) return false;
+    }
+    if (argc > 4) {
+        const long v = std::strtol(argv[4], &end, 10);
+        if (*end != '\0' || v <= 0 || v > 65535) return false;
+        port = static_cast<uint16_t>(v);
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ScheduleConfig base;
+    base.bursts  = 200;
+    base.samp_hz = 4e6;
+    base.jsr_db  = 6.0;
+    uint16_t port = 6999;
+    if (!parse(argc, argv, base, port)) {
+        std::fprintf(stderr, "usage: detect_latency_bench [bursts>0] [samp_hz>0] [jsr_db] [udp_port]\n"
+                             "       defaults: 200 4e6 6.0 6999\n");
+        return 2;
+    }
+
+    jd::UdpIndex udp("127.0.0.1", port);   // START hedefi (dinleyen olmasa da gönderim ölçülür)
+
+    std::printf("bursts=%d samp=%.0f S/s jsr=%.1f dB udp=127.0.0.1:%u%s\n", base.bursts, base.samp_hz,
+                base.jsr_db, port, udp.ok() ? "" : " (UDP kapalı)");
+    std::printf("%6s %3s | %8s %8s %8s %8s | %5s %8s | %10s %9s | %9s %9s\n",
+                "spf", "N", "lat_p50", "lat_p90", "lat_p99", "lat_max", "miss", "FA/min",
+                "frames/s", "cpu_us/f", "proc_p50", "proc_p99");
+    std::printf("%6s %3s | %8s %8s %8s %8s | %5s %8s | %10s %9s | %9s %9s\n",
+                "", "", "ms", "ms", "ms", "ms", "", "", "", "", "us", "us");
+
+    for (int spf : {1024, 2048, 4096, 8192, 16384}) {
+        for (int consec : {1, 2, 3, 5, 8}) {
+            ScheduleConfig c = base;
+            c.spf = spf;
+            c.burst_frames = std::max(50, 4 * consec);
+            ScheduledJamSource src(c);
+
+            jd::DetectConfig dc;
+            dc.threshold_dbm      = midpoint_threshold(c);
+            dc.jammer_consecutive = consec;
+            dc.max_frames         = 1 << 30;
+            dc.verbose            = false;
+
+            std::vector<double> lat_ms, proc_us;
+            int fa = 0;
+            uint64_t seq = 0;
+
+            const std::clock_t c0 = std::clock();
+            jd::TicToc wall; wall.tic();
+            for (;;) {
+                jd::Detector det(src, jd::PowerMeter{}, dc);
+                if (det.run() != jd::DetectOutcome::SustainedJammer) break;
+                udp.start(++seq);
+                proc_us.push_back(std::chrono::duration<double, std::micro>(
+                    clock_t_::now() - src.last_delivery()).count());
+                double l;
+                if (src.on_detect(l)) lat_ms.push_back(l);
+                else ++fa;
+            }
+            const double ms  = wall.toc_ms();
+            const double cpu = 1e6 * static_cast<double>(std::clock() - c0) / CLOCKS_PER_SEC;
+            const double nfr = static_cast<double>(src.frames());
+            const double clean_min = static_cast<double>(src.clean_frames()) * spf / c.samp_hz / 60.0;
+
+            std::printf("%6d %3d | %8.2f %8.2f %8.2f %8.2f | %5d %8.3f | %10.0f %9.2f | %9.1f %9.1f\n",
+                        spf, consec,
+                        jd::percentile(lat_ms, 50), jd::percentile(lat_ms, 90),
+                        jd::percentile(lat_ms, 99), jd::percentile(lat_ms, 100),
+                        src.missed(), clean_min > 0 ? fa / clean_min : 0.0,
+                        nfr / (ms * 1e-3), cpu / nfr,
+                        jd::percentile(proc_us, 50), jd::percentile(proc_us, 99));
+        }
+    }
+    return 0;
+}
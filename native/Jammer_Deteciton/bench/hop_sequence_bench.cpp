@@ -0,0 +1,73 @@
+// bench/hop_sequence_bench.cpp — anahtarlı hop dizisi: HopSequence::value() hızı ve
+// dizi özelliklerinin taraması (her devir bir permütasyon, art arda aynı kanal yok).
+//
+//   jd_bench_hop_sequence [cycles] [keys]
+//
+// n = 2..8 ve birkaç büyük n için her anahtarda cycles devir üretilir; ihlal bulunursa
+// ilki yazdırılır ve çıkış kodu 1 olur.
+#include "jd/hop_clock.hpp"
+#include "jd/utils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+// Devirleri doğrular; ihlal yoksa true
+bool check(const jd::HopSequence& s, uint64_t cycles) {
+    const int n = s.channels();
+    std::vector<int> seen(static_cast<size_t>(n) + 1, -1);
+    int prev = 0;
+    for (uint64_t slot = 0; slot < cycles * static_cast<uint64_t>(n); ++slot) {
+        const int v = s.value(slot);
+        const uint64_t c = slot / static_cast<uint64_t>(n);
+        if (v < 1 || v > n) {
+            std::printf("FAIL key=%016llx n=%d slot=%llu: value %d out of range\n",
+                        static_cast<unsigned long long>(s.key()), n, static_cast<unsigned long long>(slot), v);
+            return false;
+        }
+        if (seen[v] == static_cast<int>(c)) {
+            std::printf("FAIL key=%016llx n=%d cycle=%llu: value %d repeated within cycle\n",
+                        static_cast<unsigned long long>(s.key()), n, static_cast<unsigned long long>(c), v);
+            return false;
+        }
+        seen[v] = static_cast<int>(c);
+        if (v == prev) {
+            std::printf("FAIL key=%016llx n=%d slot=%llu: value %d repeats across slots\n",
+                        static_cast<unsigned long long>(s.key()), n, static_cast<unsigned long long>(slot), v);
+            return false;
+        }
+        prev = v;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long cycles = (argc > 1) ? std::atol(argv[1]) : 20000;
+    const long keys   = (argc > 2) ? std::atol(argv[2]) : 16;
+    if (cycles <= 0 || keys <= 0) {
+        std::fprintf(stderr, "usage: jd_bench_hop_sequence [cycles>0] [keys>0]\n");
+        return 2;
+    }
+
+    std::printf("cycles=%ld keys=%ld\n", cycles, keys);
+    std::printf("%5s %12s %10s\n", "n", "slots", "ns/value");
+    bool ok = jd::HopSequence(0, 5).channels() == 5 && check(jd::HopSequence(0, 5), static_cast<uint64_t>(cycles));
+    for (int n : {2, 3, 4, 5, 6, 7, 8, 16, 64, 256}) {
+        uint64_t slots = 0;
+        jd::TicToc t; t.tic();
+        for (long k = 0; k < keys && ok; ++k) {
+            const jd::HopSequence s(jd::HopSequence::mix(0x4A44ull + static_cast<uint64_t>(k)), n);
+            ok = check(s, static_cast<uint64_t>(cycles));
+            slots += static_cast<uint64_t>(cycles) * static_cast<uint64_t>(n);
+        }
+        const double ms = t.toc_ms();
+        if (!ok) break;
+        std::printf("%5d %12llu %10.1f\n", n, static_cast<unsigned long long>(slots), ms * 1e6 / static_cast<double>(slots));
+    }
+    std::printf("%s\n", ok ? "OK: every cycle is a permutation, no back-to-back repeats" : "FAILED");
+    return ok ? 0 : 1;
+}
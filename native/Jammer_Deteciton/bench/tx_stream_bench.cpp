@@ -0,0 +1,189 @@
+// bench/tx_stream_bench.cpp — PlutoSink push thread'i: örnek hızına yetişme, push süresi /
+// aralık jitter'ı, CPU kullanımı ve underrun raporlaması.
+//
+//   jd_bench_tx_stream [--samp 20e6] [--buffer 32768] [--kbuf 4] [--seconds 3]
+//                      [--input file.cs16 [--loop]] [--stall-every 0 --stall-ms 0] [--uri ip:...]
+//
+// --input yoksa sentetik rampa üretilir. --stall-every N: her N. doldurmada üretici
+// --stall-ms kadar bekler (kuyruk underrun'ı), --stall-ms < 0 ise yarım blok verir
+// (üretici underrun'ı). JD_MOCK_IIO derlemesinde mock gerçek zamanlı çalışır; gönderilen
+// örneklerin özeti üretilenle karşılaştırılır (sıfır kopya yolunun doğruluğu).
+#include "jd/pluto_sink.hpp"
+#include "jd/metrics.hpp"
+#if defined(JD_MOCK_IIO)
+#include "iio_mock.hpp"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Args {
+    double      samp    = 20e6;
+    int         buffer  = 32768;
+    int         kbuf    = 4;
+    double      seconds = 3.0;
+    std::string input;
+    bool        loop    = false;
+    int         stall_every = 0;
+    double      stall_ms    = 0.0;
+    std::string uri;
+};
+
+// Üretilen akışın FNV-1a özeti mock'taki tx_checksum ile aynı kuralla tutulur
+struct Fnv {
+    uint64_t h = 0xcbf29ce484222325ull;
+    void add(const int16_t* iq, size_t n) {
+        const uint16_t* w = reinterpret_cast<const uint16_t*>(iq);
+        for (size_t i = 0; i < n; ++i) {
+            h ^= static_cast<uint64_t>(w[2 * i]) | (static_cast<uint64_t>(w[2 * i + 1]) << 16);
+            h *= 0x100000001b3ull;
+        }
+    }
+};
+
+// Sarmalayıcı: gerçek üreticinin çıktısını özetler, isteğe bağlı duraklama ekler
+class BenchProducer : public jd::ITxProducer {
+public:
+    BenchProducer(std::shared_ptr<jd::ITxProducer> inner, const Args& a) : in_(std::move(inner)), a_(a) {}
+
+    size_t fill(int16_t* iq, size_t n) override {
+        ++calls_;
+        size_t want = n;
+        if (a_.stall_every > 0 && calls_ % a_.stall_every == 0) {
+            if (a_.stall_ms > 0) std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(a_.stall_ms));
+            else                 want = n / 2;
+        }
+        const size_t got = in_ ? in_->fill(iq, want) : ramp(iq, want);
+        // Sink eksik kısmı sıfırlayıp gönderir (eof'ta hiç örnek yoksa göndermez)
+        if (got == 0 && eof()) return 0;
+        sum_.add(iq, got);
+        static const int16_t z[2] = {0, 0};
+        for (size_t i = got; i < n; ++i) sum_.add(z, 1);
+        after_.push_back(sum_.h);
+        return got;
+    }
+    bool eof() const override { return in_ ? in_->eof() : false; }
+    // k push sonrası beklenen özet (stop() ile iptal edilen son doldurma gönderilmemiş olabilir)
+    uint64_t checksum_after(uint64_t k) const { return k ? after_[k - 1] : Fnv().h; }
+
+private:
+    size_t ramp(int16_t* iq, size_t n) {
+        for (size_t i = 0; i < n; ++i, ++t_) {
+            iq[2 * i]     = static_cast<int16_t>((t_ & 0x7FF) << 4);
+            iq[2 * i + 1] = static_cast<int16_t>(((t_ >> 3) & 0x7FF) << 4);
+        }
+        return n;
+    }
+    std::shared_ptr<jd::ITxProducer> in_;
+    const Args& a_;
+    uint64_t calls_ = 0, t_ = 0;
+    Fnv      sum_;
+    std::vector<uint64_t> after_;
+};
+
+bool parse(int argc, char** argv, Args& a) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string k = argv[i];
+        auto val = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if      (k == "--samp")        { if (!(v = val())) return false; a.samp = std::atof(v); }
+        else if (k == "--buffer")      { if (!(v = val())) return false; a.buffer = std::atoi(v); }
+        else if (k == "--kbuf")        { if (!(v = val())) return false; a.kbuf = std::atoi(v); }
+        else if (k == "--seconds")     { if (!(v = val())) return false; a.seconds = std::atof(v); }
+        else if (k == "--input")       { if (!(v = val())) return false; a.input = v; }
+        else if (k == "--loop")        { a.loop = true; }
+        else if (k == "--stall-every") { if (!(v = val())) return false; a.stall_every = std::atoi(v); }
+        else if (k == "--stall-ms")    { if (!(v = val())) return false; a.stall_ms = std::atof(v); }
+        else if (k == "--uri")         { if (!(v = val())) return false; a.uri = v; }
+        else return false;
+    }
+    return a.buffer > 0 && a.samp > 0;
+}
+
+void print_hist(const char* name, const jd::LatencyHistogram& h) {
+    const auto s = h.snapshot();
+    std::printf("  %-9s n=%-7llu mean=%8.1f us  p50=%8.1f  p99=%8.1f  p99.9=%8.1f  max=%8.1f\n", name,
+                static_cast<unsigned long long>(s.count), s.mean_us(), s.percentile_us(50), s.percentile_us(99),
+                s.percentile_us(99.9), 1e-3 * static_cast<double>(s.max_ns));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Args a;
+    if (!parse(argc, argv, a)) {
+        std::fprintf(stderr, "usage: jd_bench_tx_stream [--samp Hz] [--buffer N] [--kbuf K] [--seconds S]\n"
+                             "                          [--input file.cs16 [--loop]] [--stall-every N --stall-ms M] [--uri U]\n");
+        return 2;
+    }
+#if defined(JD_MOCK_IIO)
+    jd::mock::MockIioConfig mc;
+    mc.realtime = true;
+    jd::mock::configure(mc);
+    jd::mock::reset_stats();
+#endif
+
+    jd::PlutoSinkConfig cfg;
+    cfg.uri            = a.uri;
+    cfg.samp_hz        = static_cast<uint64_t>(a.samp);
+    cfg.rfbw_hz        = static_cast<uint64_t>(a.samp);
+    cfg.buffer_samples = a.buffer;
+    cfg.kernel_buffers = a.kbuf;
+    jd::PlutoSink sink(cfg);
+    if (!sink.ok()) return 1;
+
+    std::shared_ptr<jd::ITxProducer> inner;
+    if (!a.input.empty()) {
+        auto f = std::make_shared<jd::Cs16FileProducer>(a.input, a.loop);
+        if (!f->ok()) return 1;
+        std::printf("input: %s (%llu samples%s)\n", a.input.c_str(), static_cast<unsigned long long>(f->samples()),
+                    a.loop ? ", loop" : "");
+        inner = f;
+    }
+    auto prod = std::make_shared<BenchProducer>(inner, a);
+
+    uint64_t under_cb = 0;
+    sink.set_underrun_cb([&](const jd::TxUnderrun&) { ++under_cb; });
+
+    const std::clock_t c0 = std::clock();
+    const auto t0 = std::chrono::steady_clock::now();
+    if (!sink.start(prod)) return 1;
+    while (sink.running() &&
+           std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() < a.seconds)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sink.stop();                          // iptal edilen son push ne sink'te ne mock'ta sayılır
+    const jd::TxStats st = sink.stats();
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    const double cpu  = static_cast<double>(std::clock() - c0) / CLOCKS_PER_SEC;
+
+    std::printf("samp=%.2f MS/s buffer=%d kbuf=%d | %.2f s wall, cpu %.1f%%\n",
+                a.samp * 1e-6, a.buffer, a.kbuf, wall, 100.0 * cpu / wall);
+    std::printf("pushes=%llu samples=%llu (%.2f MS/s) underruns: producer=%llu queue=%llu (cb %llu) errors=%llu%s\n",
+                static_cast<unsigned long long>(st.pushes), static_cast<unsigned long long>(st.samples),
+                st.samples / wall * 1e-6, static_cast<unsigned long long>(st.producer_underruns),
+                static_cast<unsigned long long>(st.queue_underruns), static_cast<unsigned long long>(under_cb),
+                static_cast<unsigned long long>(st.push_errors), st.finished ? " (eof)" : "");
+    print_hist("fill", sink.fill_latency());
+    print_hist("push", sink.push_latency());
+    print_hist("interval", sink.push_interval());
+
+#if defined(JD_MOCK_IIO)
+    const auto ms = jd::mock::stats();
+    const bool same = ms.tx_samples == st.samples && ms.tx_checksum == prod->checksum_after(ms.pushes);
+    std::printf("mock: pushes=%llu tx_samples=%llu tx_underruns=%llu checksum %s\n",
+                static_cast<unsigned long long>(ms.pushes), static_cast<unsigned long long>(ms.tx_samples),
+                static_cast<unsigned long long>(ms.tx_underruns), same ? "OK" : "MISMATCH");
+    return same ? 0 : 1;
+#else
+    return 0;
+#endif
+}
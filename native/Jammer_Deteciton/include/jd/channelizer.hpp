@@ -0,0 +1,122 @@
+// jd/channelizer.hpp
+#pragma once
+#include "jd/source.hpp"
+#include "jd/gmm_threshold.hpp"
+#include "jd/detector.hpp"
+#include <vector>
+#include <complex>
+#include <cstdint>
+
+namespace jd {
+
+// Polifaz filtre bankası: tek geniş bant yakalamayı M eşit kanala böler.
+// Kanal k merkezi = center + k * samp/M (k > M/2 negatif frekans).
+struct ChannelizerConfig {
+    int    num_channels   = 64;    // M (2'nin kuvveti)
+    int    taps_per_branch= 8;     // P, prototip filtre uzunluğu = M*P
+    double cutoff_scale   = 1.0;   // prototip kesim = cutoff_scale * samp/(2M)
+    double floor_watt     = 1e-15;
+    double calib_db       = 0.0;
+};
+
+class Channelizer {
+public:
+    explicit Channelizer(const ChannelizerConfig& cfg = {});
+
+    int num_channels() const { return M_; }
+    bool avx2() const { return avx2_; }   // çalışma anında seçilen AVX2/FMA çekirdeği
+
+    // Frame'i işler; her kanalın frame ortalama gücünü (dBm) out_dbm'e yazar.
+    // M'ye tam bölünmeyen artık örnekler bir sonraki frame'e taşınır.
+    // Dönüş: bu frame'de üretilen çıkış bloğu sayısı.
+    int process(const std::vector<std::complex<float>>& frame, std::vector<double>& out_dbm);
+
+    void reset();
+
+private:
+    void push_block(const std::complex<float>* x); // M örnek
+    void fft_inplace(float* re, float* im) const;
+
+    ChannelizerConfig cfg_;
+    int M_ = 0;
+    int P_ = 0;
+    int log2M_ = 0;
+
+    // Katsayılar: h_[k*M + p] (k: dal içi tap, p: dal)
+    std::vector<float> h_;
+    // Gecikme hattı: P blok, her blok M örnek (re/im ayrık, SoA)
+    std::vector<float> dl_re_, dl_im_;
+    int head_ = 0;
+
+    // FFT tabloları
+    std::vector<float>    tw_re_, tw_im_;
+    std::vector<uint32_t> bitrev_;
+
+    // Çalışma tamponları
+    std::vector<float> y_re_, y_im_;
+    std::vector<float> acc_;                       // kanal başına |X|^2 toplamı
+    std::vector<std::complex<float>> pending_;     // önceki frame'den artan örnekler
+
+    // Çekirdekler (kurucuda CPU'ya göre seçilir)
+    void (*mac_)(float*, float*, const float*, const float*, const float*, int) = nullptr;
+    void (*pow_)(float*, const float*, const float*, int) = nullptr;
+    bool avx2_ = false;
+};
+
+// FHSS planındaki her kanalın jammer durumu
+struct ChannelState {
+    uint64_t hz            = 0;
+    int      bin           = 0;       // kanalizer çıkış indeksi
+    double   threshold_dbm = -50.0;
+    double   power_dbm     = -300.0;
+    int      jam_cnt       = 0;       // ardışık eşik üstü frame
+    bool     jammed        = false;
+    bool     changed       = false;   // son update()'te durum değişti mi
+};
+
+struct ChannelPlan {
+    uint64_t center_hz = 2402000000ULL;
+    uint64_t samp_hz   = 56000000ULL;
+    std::vector<uint64_t> channels_hz;  // izlenecek hop frekansları
+};
+
+// Izgarada olmayan (bin merkezinden aralığın %10'undan fazla sapan) ya da başka bir
+// kanalla aynı bine düşen frekanslar uyarıyla atlanır.
+class ChannelBank {
+public:
+    ChannelBank(Channelizer& chz, const ChannelPlan& plan, int jammer_consecutive);
+
+    bool ok() const { return !ch_.empty(); }
+    const std::vector<ChannelState>& channels() const { return ch_; }
+
+    // Kanal başına eşikleri GMM ile kalibre eder (tüm kanallar aynı frameleri görür)
+    bool calibrate(ISource& src, const GmmThreshold& gmm, double target_seconds, bool verbose = true);
+
+    // Bir frame işler; durumu değişen kanal sayısını döner
+    int update(const std::vector<std::complex<float>>& frame);
+
+    bool any_jammed() const;
+
+private:
+    Channelizer& chz_;
+    int consec_;
+    std::vector<ChannelState> ch_;
+    std::vector<double> bin_dbm_;
+};
+
+// Kanalize tespit döngüsü (Detector'ın çok kanallı eşleniği).
+// Herhangi bir kanal ardışık eşiği aşınca SustainedJammer döner.
+class ChannelDetector {
+public:
+    ChannelDetector(ISource& src, ChannelBank& bank, DetectConfig cfg)
+      : src_(src), bank_(bank), cfg_(cfg) {}
+
+    DetectOutcome run();
+
+private:
+    ISource&     src_;
+    ChannelBank& bank_;
+    DetectConfig cfg_;
+};
+
+} // namespace jd
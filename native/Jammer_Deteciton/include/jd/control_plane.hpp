@@ -0,0 +1,79 @@
+// jd/control_plane.hpp
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace jd {
+
+// Olay güdümlü kontrol düzlemi: tek thread, poll() (Windows: WSAPoll) ile
+//  - UDP kontrol soketi (127.0.0.1:port) komutları
+//  - self-pipe: sinyal/uyandırma (sinyal işleyicisinden güvenle yazılabilir)
+// Boşta periyodik uyanma yoktur; STOP/sinyal gecikmesi tek bir poll dönüşüdür.
+// Slot sınırı gibi son tarihli işler HopTimer'dadır (jd/hop_clock.hpp).
+// Yerleşik komutlar: STOP|EXIT|QUIT, PING. Diğerleri on() ile kaydedilir;
+// komut adı büyük/küçük harf duyarsızdır, argümanlar olduğu gibi iletilir.
+class ControlPlane {
+public:
+    // Komut işleyicisi: argüman metni -> gönderene cevap (boş: cevap yok)
+    using Handler = std::function<std::string(const std::string& args)>;
+
+    ControlPlane(std::atomic<bool>& stop_flag, uint16_t port = 25000);
+    ~ControlPlane();
+
+    ControlPlane(const ControlPlane&) = delete;
+    ControlPlane& operator=(const ControlPlane&) = delete;
+
+    // start() öncesi kayıt
+    void on(const std::string& cmd, Handler h);        // cmd büyük harf (ör. "RETUNE")
+
+    // Döngüyü başlatır. Dönüş: kontrol soketi bağlandı mı (bağlanmasa da
+    // sinyal uyandırması çalışır).
+    bool start();
+    void stop();
+
+    // Stop bayrağını kaldırıp döngüyü ve bekleyenleri uyandırır
+    void request_stop();
+    // Sinyal işleyicisinden çağrılabilir (stop_flag zaten kaldırılmış olmalı;
+    // yalnız self-pipe'a bir bayt yazar)
+    void notify_signal();
+
+    // stop_flag kalkana kadar bekler (main'in yayın/boşta aşaması)
+    void wait_stop();
+
+    bool listening() const { return listening_; }
+
+private:
+    void loop();
+    void handle_datagram(const char* buf, int n, const void* from, int flen);
+    void wake();
+
+    std::atomic<bool>& stop_;
+    uint16_t           port_;
+    std::atomic<bool>  quit_{false};
+    bool               listening_ = false;
+    std::thread        th_;
+
+#ifdef _WIN32
+    uintptr_t sock_     = ~uintptr_t(0);
+    uintptr_t wake_rx_  = ~uintptr_t(0);   // Windows'ta pipe yerine loopback UDP çifti
+    uintptr_t wake_tx_  = ~uintptr_t(0);
+#else
+    int sock_    = -1;
+    int wake_rx_ = -1;                      // self-pipe okuma ucu
+    int wake_tx_ = -1;                      // self-pipe yazma ucu
+#endif
+
+    std::map<std::string, Handler> handlers_;
+
+    std::mutex              wm_;
+    std::condition_variable wcv_;
+};
+
+} // namespace jd
@@ -1,20 +1,19 @@
 #pragma once
 #include <atomic>
-#include <chrono>
 #include <cstdint>
-#include <array>
+#include "jd/hop_clock.hpp"
 
 namespace jd {
 
+// Jammer oturumu + hop saati. Varsayılan ayar eski davranıştır: start() anından
+// itibaren tam saniyelerle {1,3,5,4,2}. Anahtar/dwell/epoch HopConfig ile verilir.
 class Counter {
 public:
-    using clock = std::chrono::steady_clock;
-
-    Counter() { _pattern = {1,3,5,4,2}; }
+    explicit Counter(const HopConfig& cfg = {}) : _clock(cfg) {}
 
     void start(uint64_t seq) {
         _seq.store(seq, std::memory_order_relaxed);
-        _t0 = clock::now();
+        _clock.arm();
         _active.store(true, std::memory_order_release);
     }
 
@@ -25,20 +24,20 @@ public:
     bool active() const { return _active.load(std::memory_order_acquire); }
     uint64_t seq()  const { return _seq.load(std::memory_order_relaxed); }
 
-    // Aktif değilse false döner
+    const HopClock& clock() const { return _clock; }
+
+    // Aktif değilse (veya ortak epoch henüz gelmediyse) false döner
     bool current_value(int& out_val) const {
-        if (!active()) return false;
-        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(clock::now() - _t0).count();
-        size_t idx = static_cast<size_t>(elapsed % _pattern.size());
-        out_val = _pattern[idx];
+        uint64_t slot = 0;
+        if (!active() || !_clock.slot_at(HopClock::now(), slot)) return false;
+        out_val = _clock.value(slot);
         return true;
     }
 
 private:
-    std::array<int,5> _pattern;
+    HopClock _clock;
     std::atomic<bool> _active{false};
     std::atomic<uint64_t> _seq{0};
-    clock::time_point _t0{};
 };
 
 } // namespace jd
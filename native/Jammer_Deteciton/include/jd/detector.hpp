@@ -1,6 +1,7 @@
 #pragma once
 #include "jd/source.hpp"
 #include "jd/power_meter.hpp"
+#include <atomic>
 
 namespace jd {
 
@@ -8,6 +9,10 @@ struct DetectConfig {
     double threshold_dbm = -50.0;
     int jammer_consecutive = 5; // ardışık pozitif sayacı eşiği
     int max_frames = 1000;
+    bool verbose = true;        // false: frame başına printf yok (benchmark)
+    // Çalışırken kontrol (opsiyonel): frame başına okunur
+    const std::atomic<double>* live_threshold = nullptr;   // THRESHOLD komutu
+    const std::atomic<bool>*   stop           = nullptr;   // true: döngüden çık
 };
 
 enum class DetectOutcome {
@@ -16,6 +21,7 @@ enum class DetectOutcome {
     SourceEnded          // kaynak bitti/hata
 };
 
+// Tek seferlik tespit: kaynağı bırakmaz (release çağıran tarafta)
 class Detector {
 public:
     Detector(ISource& src, PowerMeter pm, DetectConfig cfg)
@@ -0,0 +1,161 @@
+// jd/event_ring.hpp
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace jd {
+
+// Paylaşımlı bellek olay halkası (jammer_detect -> Python denetleyiciler).
+// Adlı segment: POSIX shm_open("/<name>") (/dev/shm/<name>), Windows
+// CreateFileMapping("<name>"); Python tarafı services/jd_events.py ile mmap eder.
+//
+// Yerleşim (küçük endian, sabit):
+//   [0, 128)   EventRingHeader
+//   [128, ...) capacity x EventRecord (128 bayt)
+// Çok üreticili: bilet = head.fetch_add(1), hücre = bilet % capacity. Hücre başına
+// seqlock: yazarken seq = 2*bilet+1, bitince 2*bilet+2. Okuyucular yıkıcı değildir
+// (her biri kendi imlecini tutar, birden çok okuyucu olabilir); yazar beklemez,
+// en eski kayıt üzerine yazılır. Okuyucu bilet r için:
+//   seq == 2r+2 -> kopyala, seq'i yeniden oku, aynıysa geçerli
+//   seq <  2r+2 -> henüz yazılmadı
+//   seq >  2r+2 -> halka tarafından geçildi: imleç head - capacity'ye atlar (kayıp sayılır)
+// UDP yolu (JdxPacketV1, 6000/25000) uzak kullanım için değişmeden kalır.
+
+constexpr uint32_t kEventRingMagic   = 0x5645444A;   // 'JDEV'
+constexpr uint16_t kEventRingVersion = 1;
+constexpr uint32_t kEventRecordSize  = 128;
+
+enum class EventType : uint16_t {
+    Detect  = 1,   // oturum START/STOP (JdxState)
+    Power   = 2,   // frame gücü + eşik
+    Hop     = 3,   // hop saati slotu (TICK ile aynı an)
+    Channel = 4,   // kanalizer: kanal durum değişimi
+    Telemetry = 5, // telemetri periyodu özeti (JdxTelemetryV2 ile aynı an)
+};
+
+#pragma pack(push,1)
+struct EventRingHeader {
+    uint32_t magic = kEventRingMagic;
+    uint16_t version = kEventRingVersion;
+    uint16_t header_size = 128;
+    uint32_t record_size = kEventRecordSize;
+    uint32_t capacity = 0;          // 2'nin kuvveti
+    int64_t  unix_off_ns = 0;       // UNIX ns - monotonik ns (kayıt t_ns'i çevirmek için)
+    int64_t  created_unix_ns = 0;
+    uint32_t writer_pid = 0;
+    uint32_t _pad0 = 0;
+    uint8_t  _pad1[24]{};
+    uint64_t head = 0;              // ofset 64: bir sonraki bilet (atomik)
+    uint8_t  _pad2[56]{};
+};
+
+struct EventRecord {
+    uint64_t seq;                   // seqlock (yukarıya bakınız)
+    uint64_t t_ns;                  // monotonik (jd::now_ns)
+    uint16_t type;                  // EventType
+    uint8_t  version;               // yük sürümü (tür başına)
+    uint8_t  _r;
+    uint32_t size;                  // yük bayt sayısı
+    uint8_t  payload[kEventRecordSize - 24];
+};
+
+// Yükler (version 1)
+struct EvDetectV1 {
+    uint64_t session;               // JDX seq
+    uint64_t frame;
+    float    power_dbm;
+    float    threshold_dbm;
+    uint8_t  state;                 // JdxState: 1 START, 3 STOP
+    uint8_t  _pad[7];
+};
+struct EvPowerV1 {
+    uint64_t frame;
+    float    power_dbm;
+    float    threshold_dbm;
+    uint8_t  over;                  // güç > eşik
+    uint8_t  jammed;                // izleyici durumu (sürekli mod), yoksa over
+    uint8_t  _pad[6];
+};
+struct EvHopV1 {
+    uint64_t session;
+    uint64_t slot;
+    int64_t  slot_start_ns;         // monotonik
+    uint32_t dwell_us;
+    int32_t  value;
+};
+struct EvChannelV1 {
+    uint64_t hz;
+    uint64_t frame;
+    float    power_dbm;
+    float    threshold_dbm;
+    uint8_t  jammed;
+    uint8_t  _pad[7];
+};
+struct EvTelemetryV1 {
+    uint64_t pkt;                   // JdxTelemetryV2::pkt
+    uint64_t session;
+    uint64_t hop_slot;
+    uint32_t frames;
+    uint32_t over;
+    float    threshold_dbm;
+    float    min_dbm, mean_dbm, max_dbm;
+    uint32_t frame_p99_us;          // Stage::Frame
+    int16_t  hop_value;
+    uint8_t  state;                 // bit0 jammer, bit1 oturum aktif
+    uint8_t  _pad[5];
+};
+#pragma pack(pop)
+
+static_assert(sizeof(EventRingHeader) == 128, "EventRingHeader layout");
+static_assert(sizeof(EventRecord) == kEventRecordSize, "EventRecord layout");
+
+struct EventRingConfig {
+    std::string name     = "jd_events";
+    uint32_t    capacity = 4096;     // kayıt (2'nin kuvvetine yuvarlanır)
+    int         power_every = 1;     // her N frame'de bir Power olayı (0: kapalı)
+};
+
+// Süreç genelinde tek yazar uç (logger() gibi); açılmadıysa tüm çağrılar no-op.
+// publish() kilitsizdir ve sıcak döngüden çağrılabilir.
+class EventRing {
+public:
+    static EventRing& instance();
+
+    // Aynı adla çalışan başka bir yazar varsa false (ölmüş yazarın kalıntısı yeniden kurulur)
+    bool open(const EventRingConfig& cfg);
+    void close();                    // oluşturduğu segmenti kaldırır (okuyucular eşlemeyi korur)
+    bool ok() const { return ok_.load(std::memory_order_acquire); }
+    const EventRingConfig& config() const { return cfg_; }
+
+    bool publish(EventType type, const void* payload, uint32_t size, uint8_t version = 1);
+
+    void detect(uint64_t session, uint8_t state, uint64_t frame, double power_dbm, double threshold_dbm);
+    void power(uint64_t frame, double power_dbm, double threshold_dbm, bool jammed);
+    void hop(uint64_t session, uint64_t slot, int64_t slot_start_ns, uint32_t dwell_us, int value);
+    void channel(uint64_t hz, uint64_t frame, double power_dbm, double threshold_dbm, bool jammed);
+
+    uint64_t published() const;
+
+private:
+    EventRing() = default;
+    ~EventRing();
+
+    EventRingConfig       cfg_;
+    std::atomic<bool>     ok_{false};
+    EventRingHeader*      hdr_  = nullptr;
+    EventRecord*          recs_ = nullptr;
+    std::atomic<uint64_t>* head_ = nullptr;
+    uint32_t              mask_ = 0;
+    uint32_t              pw_n_ = 0;         // power_every sayacı (tespit thread'i)
+    size_t                bytes_ = 0;
+#ifdef _WIN32
+    void*                 map_ = nullptr;
+#else
+    int                   fd_ = -1;
+#endif
+};
+
+inline EventRing& events() { return EventRing::instance(); }
+
+} // namespace jd
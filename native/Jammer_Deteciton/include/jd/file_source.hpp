@@ -0,0 +1,146 @@
+// jd/file_source.hpp
+#pragma once
+#include "jd/source.hpp"
+#include <string>
+#include <vector>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <atomic>
+
+namespace jd {
+
+enum class SampleFormat : uint8_t { CS16, CF32 }; // SigMF: ci16_le | cf32_le
+
+// SigMF meta dosyasından okunan/yazılan alanların alt kümesi
+struct SigmfMeta {
+    SampleFormat format    = SampleFormat::CS16;
+    double       samp_hz   = 0.0;
+    double       center_hz = 0.0;
+    std::string  description;
+};
+
+bool sigmf_read_meta (const std::string& meta_path, SigmfMeta& out);
+bool sigmf_write_meta(const std::string& meta_path, const SigmfMeta& m,
+                      const std::vector<std::pair<uint64_t, double>>& captures); // (sample_start, frequency)
+
+// Salt okunur bellek eşlemli dosya (POSIX mmap / Win32 file mapping)
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    const uint8_t* data() const { return data_; }
+    size_t         size() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t         size_ = 0;
+#ifdef _WIN32
+    void* hfile_ = nullptr;
+    void* hmap_  = nullptr;
+#endif
+};
+
+struct FileSourceConfig {
+    std::string  path;               // .sigmf-meta, .sigmf-data veya ham dosya
+    int          frame_len = 4096;   // samples per frame
+    SampleFormat format    = SampleFormat::CS16; // meta yoksa kullanılır
+    double       samp_hz   = 0.0;    // 0: meta'dan; realtime için gerekli
+    bool         realtime  = false;  // false: olabildiğince hızlı
+    bool         loop      = false;  // dosya sonunda başa dön
+};
+
+// Sıfır kopya frame görünümü: eşlenmiş dosyanın içine işaret eder
+struct FrameView {
+    const void*  data    = nullptr;
+    size_t       samples = 0;
+    SampleFormat format  = SampleFormat::CS16;
+
+    const int16_t*             cs16() const { return static_cast<const int16_t*>(data); }
+    const std::complex<float>* cf32() const { return static_cast<const std::complex<float>*>(data); }
+};
+
+// Kayıttan oynatma kaynağı (SigMF / ham cs16-cf32)
+class FileSource : public ISource {
+public:
+    explicit FileSource(const FileSourceConfig& cfg);
+
+    bool ok() const { return map_.data() != nullptr && total_ >= static_cast<size_t>(cfg_.frame_len); }
+
+    // ISource: cs16 -> float dönüşümü PlutoSource ile aynı ölçekte
+    bool get_frame(std::vector<std::complex<float>>& out) override;
+    void release() override { map_.close(); }
+
+    // Kopyasız erişim (realtime/loop kurallarına uyar)
+    bool next_view(FrameView& v);
+
+    const SigmfMeta& meta() const { return meta_; }
+    uint64_t frames_read() const { return frames_; }
+    uint64_t loops() const { return loops_; }
+
+private:
+    FileSourceConfig cfg_;
+    SigmfMeta  meta_;
+    MappedFile map_;
+    size_t     total_ = 0;      // toplam örnek
+    size_t     pos_   = 0;      // sonraki örnek
+    uint64_t   frames_ = 0;
+    uint64_t   loops_  = 0;
+    uint64_t   played_ = 0;     // realtime tempo için toplam oynatılan örnek
+    std::chrono::steady_clock::time_point t0_{};
+};
+
+// PlutoSource kayıt musluğu: ham cs16 tamponları arka planda .sigmf-data'ya yazar.
+// Sıcak yol yalnız önceden ayrılmış bloğa memcpy yapar; havuz dolarsa blok düşer.
+class SigmfRecorder {
+public:
+    SigmfRecorder(const std::string& base_path, double samp_hz, double center_hz,
+                  size_t block_bytes = 1u << 16, int pool_blocks = 64);
+    ~SigmfRecorder();
+
+    bool ok() const { return fp_ != nullptr; }
+
+    // Sıcak yol: iio tamponundaki ham I/Q (int16 çiftleri)
+    void write(const int16_t* iq, size_t samples);
+    // Frekans değişimi: yeni SigMF capture segmenti
+    void note_retune(double center_hz);
+
+    void close();
+
+    uint64_t samples_written() const { return samples_.load(std::memory_order_relaxed); }
+    uint64_t blocks_dropped()  const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void writer_loop();
+
+    std::string base_;
+    SigmfMeta   meta_;
+    std::vector<std::pair<uint64_t, double>> captures_;
+    FILE*       fp_ = nullptr;
+
+    struct Block { std::vector<uint8_t> bytes; size_t used = 0; };
+    std::vector<Block>  pool_;
+    std::vector<Block*> free_;
+    std::deque<Block*>  full_;
+    Block*              cur_ = nullptr;
+    std::mutex              m_;
+    std::condition_variable cv_;
+    bool                    quit_ = false;
+    std::thread             th_;
+
+    std::atomic<uint64_t> samples_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+} // namespace jd
@@ -0,0 +1,122 @@
+// jd/hop_clock.hpp
+#pragma once
+#include "jd/metrics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace jd {
+
+// Hop saati ayarı. Aynı (key, dwell_us, channels, epoch_unix_ns) ile çalışan TX ve RX
+// aynı anda aynı slotu ve değeri hesaplar; yoklama/mesaj gerekmez.
+struct HopConfig {
+    uint64_t key           = 0;        // 0: eski sabit desen {1,3,5,4,2} (channels=5)
+    uint32_t dwell_us      = 1000000;  // slot süresi (>= 1000 us)
+    int      channels      = 5;        // değerler 1..channels (2..256)
+    int64_t  epoch_unix_ns = 0;        // ortak başlangıç (UNIX ns); 0: start() anı
+    int      refresh_ms    = 100;      // slot içinde TICK tekrarı (0: yalnız sınırda)
+};
+
+// Anahtarlı hop dizisi: slot -> değer, durumsuz.
+//   c = slot / n, i = slot % n
+//   devir c için permütasyon: st = mix(key ^ mix(c)); j = n-1..1 için
+//     st += 0x9E3779B97F4A7C15; swap(p[j], p[mix(st) % (j+1)])
+//   devir sonu sonraki devrin (ham) ilk değerine eşitse p[n-2] <-> p[n-1]; devir başı
+//   hiç değişmediğinden düzeltme zincirlenmez (art arda aynı kanal yok)
+//   n = 2'de art arda farklılık diziyi salınıma zorlar: tüm devirler c = 0 permütasyonu
+//   mix: splitmix64 sonlandırıcısı. Değer = p[i] + 1.
+// Her devirde her kanal bir kez kullanılır (eski desenin özelliği); sıra anahtarı
+// bilmeyen için öngörülemez.
+class HopSequence {
+public:
+    HopSequence(uint64_t key = 0, int channels = 5);
+
+    int      channels() const { return n_; }
+    uint64_t key()      const { return key_; }
+    int      value(uint64_t slot) const;
+
+    static uint64_t mix(uint64_t z);
+
+private:
+    void perm(uint64_t cycle, uint8_t* p) const;
+
+    uint64_t key_;
+    int      n_;
+};
+
+// Ortak epoch'tan slot türeten saat. Zaman tabanı monotonik (steady_clock); UNIX
+// epoch yalnız kurulumda bir kez monotoniğe çevrilir, duvar saati adımları
+// sonradan slotları kaydırmaz.
+class HopClock {
+public:
+    explicit HopClock(const HopConfig& cfg = {});
+
+    const HopConfig&   config()   const { return cfg_; }
+    const HopSequence& sequence() const { return seq_; }
+
+    // Epoch'u sabitler: cfg.epoch_unix_ns verilmişse o, yoksa şu an
+    void    arm();
+    int64_t epoch_ns()      const { return epoch_.load(std::memory_order_acquire); }   // monotonik
+    int64_t epoch_unix_ns() const { return epoch_ns() + unix_off_; }
+
+    static int64_t now() { return static_cast<int64_t>(now_ns()); }
+
+    // t epoch'tan önceyse false
+    bool    slot_at(int64_t t, uint64_t& slot) const;
+    int64_t slot_start(uint64_t slot) const { return epoch_ns() + static_cast<int64_t>(slot) * dwell_ns_; }
+    int64_t dwell_ns() const { return dwell_ns_; }
+    int     value(uint64_t slot) const { return seq_.value(slot); }
+
+private:
+    HopConfig   cfg_;
+    HopSequence seq_;
+    int64_t     dwell_ns_;
+    int64_t     unix_off_;                 // UNIX ns - monotonik ns (kurulumda)
+    std::atomic<int64_t> epoch_{0};
+};
+
+// Mutlak son tarihli yayın thread'i: slot sınırlarında (ve slot içinde refresh_ms
+// adımlarıyla) fn(slot) çağrılır. Son tarihler epoch'tan hesaplanır, gecikme
+// birikmez; bir slottan fazla geç kalınırsa kaçırılan slotlar atlanır (missed).
+// Saat pasifken (enable(false)) thread uyur; enable/stop bekleyeni hemen uyandırır.
+class HopTimer {
+public:
+    using Fn = std::function<void(uint64_t slot)>;
+
+    HopTimer(const HopClock& clock, Fn fn);
+    ~HopTimer();
+
+    HopTimer(const HopTimer&) = delete;
+    HopTimer& operator=(const HopTimer&) = delete;
+
+    void start();
+    void stop();
+    void enable(bool on);                  // clock.arm() sonrası true
+
+    // Son tarih -> çağrı gecikmesi (ns) ve atlanan slot sayısı
+    const LatencyHistogram& lateness() const { return late_; }
+    uint64_t fired()  const { return fired_.load(std::memory_order_relaxed); }
+    uint64_t missed() const { return missed_.load(std::memory_order_relaxed); }
+
+private:
+    void loop();
+
+    const HopClock& clk_;
+    Fn              fn_;
+    std::thread     th_;
+    std::mutex      m_;
+    std::condition_variable cv_;
+    bool            quit_ = false;
+    bool            on_   = false;
+    uint64_t        gen_  = 0;             // enable() her çağrıda artar (bekleyen yeniden hesaplar)
+
+    LatencyHistogram      late_;
+    std::atomic<uint64_t> fired_{0}, missed_{0};
+};
+
+} // namespace jd
@@ -5,6 +5,7 @@
 #include "jd/gmm_threshold.hpp"
 #include "jd/calibrator.hpp"
 #include "jd/detector.hpp"
+#include <atomic>
 #include <optional>
 
 namespace jd {
@@ -29,10 +30,19 @@ public:
 
     double threshold_dbm() const { return threshold_dbm_; }
 
+    // Çalışırken kontrol: run_detection() eşiği her frame'de live'dan okur,
+    // stop kalkınca tarama erken biter (nullptr: kapalı)
+    void set_live_control(const std::atomic<double>* live_threshold, const std::atomic<bool>* stop) {
+        live_thr_ = live_threshold;
+        stop_     = stop;
+    }
+
 private:
     ISource& src_;
     Params   p_;
     double   threshold_dbm_ = -100.0;
+    const std::atomic<double>* live_thr_ = nullptr;
+    const std::atomic<bool>*   stop_     = nullptr;
 };
 
 } // namespace jd
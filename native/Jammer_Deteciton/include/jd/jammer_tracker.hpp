@@ -0,0 +1,88 @@
+// jd/jammer_tracker.hpp
+#pragma once
+#include "jd/source.hpp"
+#include "jd/power_meter.hpp"
+#include "jd/detector.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace jd {
+
+// Histerezisli sürekli jammer durumu.
+// Giriş: on_frames ardışık frame (threshold + on_margin) üstü
+// Çıkış: off_frames ardışık frame (threshold - off_margin) altı
+// Her iki geçiş de mevcut durumda en az min_dwell_ms kalındıktan sonra olur.
+struct TrackerConfig {
+    double threshold_dbm = -50.0;   // kalibrasyon (GMM) eşiği
+    double on_margin_db  = 0.0;
+    double off_margin_db = 1.0;
+    int    on_frames     = 5;
+    int    off_frames    = 10;
+    double min_dwell_ms  = 200.0;
+};
+
+enum class JamState : uint8_t { Clear = 0, Jammed = 1 };
+
+struct JammerEvent {
+    JamState state         = JamState::Clear;  // yeni durum
+    uint64_t frame         = 0;       // geçişi tetikleyen frame
+    double   power_dbm     = 0.0;
+    uint64_t t_ns          = 0;       // steady_clock
+    int64_t  wall_us       = 0;       // system_clock (epoch µs)
+    double   prev_state_ms = 0.0;     // önceki durumda geçen süre
+    uint64_t onsets        = 0;       // şimdiye kadarki jammer başlangıç sayısı
+};
+
+class JammerTracker {
+public:
+    explicit JammerTracker(const TrackerConfig& cfg);
+
+    // Frame gücünü işler; geçiş olduysa true döner ve ev doldurulur
+    bool update(double power_dbm, uint64_t t_ns, JammerEvent* ev = nullptr);
+
+    JamState state() const { return state_; }
+    uint64_t frames() const { return frame_; }
+    const TrackerConfig& config() const { return cfg_; }
+    void set_threshold_dbm(double thr) { cfg_.threshold_dbm = thr; }
+    void reset(uint64_t t_ns);
+
+private:
+    TrackerConfig cfg_;
+    JamState state_    = JamState::Clear;
+    int      run_      = 0;       // geçiş yönünde ardışık frame
+    uint64_t since_ns_ = 0;       // mevcut duruma giriş anı
+    uint64_t frame_    = 0;
+    uint64_t onsets_   = 0;
+};
+
+// Uzun süreli tespit döngüsü: cihazı açık tutar, stop bayrağı gelene kadar
+// her geçişte on_event çağrılır (UDP START/STOP main'de).
+class ContinuousDetector {
+public:
+    using EventFn = std::function<void(const JammerEvent&)>;
+    using FrameFn = std::function<void(uint64_t t_ns)>;   // her frame sonrası (tick vb.)
+
+    ContinuousDetector(ISource& src, PowerMeter pm, const TrackerConfig& cfg,
+                       EventFn on_event, FrameFn on_frame = {})
+      : src_(src), pm_(std::move(pm)), tracker_(cfg),
+        on_event_(std::move(on_event)), on_frame_(std::move(on_frame)) {}
+
+    // SourceEnded: kaynak bitti/hata; CompletedNoSustain: stop istendi
+    DetectOutcome run(const std::atomic<bool>& stop);
+
+    JammerTracker& tracker() { return tracker_; }
+
+    // THRESHOLD komutu: eşik frame başında buradan okunur (nullptr: sabit)
+    void set_live_threshold(const std::atomic<double>* thr) { live_thr_ = thr; }
+
+private:
+    ISource&      src_;
+    PowerMeter    pm_;
+    JammerTracker tracker_;
+    EventFn       on_event_;
+    FrameFn       on_frame_;
+    const std::atomic<double>* live_thr_ = nullptr;
+};
+
+} // namespace jd
@@ -0,0 +1,109 @@
+// jd/logger.hpp
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace jd {
+
+enum class LogLevel : uint8_t { Debug = 0, Info = 1, Warn = 2, Error = 3, Off = 4 };
+
+// Kaydın türü: metin veya drain thread'inde biçimlenen yapısal olay
+enum class LogKind : uint8_t {
+    Text,          // önceden biçimlenmiş kısa mesaj
+    FrameState,    // tespit durum geçişi (frame, güç, sayaç)
+    PowerSummary   // periyodik güç özeti (min/ortalama/maks)
+};
+
+// Sabit boyutlu ikili kayıt (halka tampon hücresi)
+struct LogRecord {
+    uint64_t t_ns   = 0;
+    LogLevel level  = LogLevel::Info;
+    LogKind  kind   = LogKind::Text;
+    uint8_t  flag   = 0;         // FrameState: 1=JAMMER
+    uint8_t  _pad   = 0;
+    int32_t  i0 = 0, i1 = 0, i2 = 0;
+    double   d0 = 0.0, d1 = 0.0, d2 = 0.0, d3 = 0.0;
+    char     text[96] = {0};
+};
+
+struct LoggerConfig {
+    LogLevel level        = LogLevel::Info;
+    size_t   capacity     = 4096;   // kayıt (2'nin kuvvetine yuvarlanır)
+    int      summary_ms   = 1000;   // güç özeti periyodu (0: kapalı)
+    FILE*    out          = stdout;
+};
+
+// Çok üreticili, tek tüketicili kilitsiz halka + arka plan drain thread'i.
+// Sıcak yol yalnız bir hücreye kayıt kopyalar; stdout'a yazım drain thread'indedir.
+// start() çağrılmadıysa kayıtlar eşzamanlı yazılır (araçlar/benchmark için).
+class AsyncLogger {
+public:
+    static AsyncLogger& instance();
+
+    void start(const LoggerConfig& cfg);
+    void stop();                 // kuyruğu boşaltıp thread'i bitirir
+    void flush();                // o ana kadarki kayıtlar yazılana dek bekler
+
+    bool enabled(LogLevel l) const { return l >= level_.load(std::memory_order_relaxed); }
+    void set_level(LogLevel l) { level_.store(l, std::memory_order_relaxed); }
+
+    // printf biçimli kısa mesaj (95 bayta kısaltılır)
+    void text(LogLevel l, const char* fmt, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 3, 4)))
+#endif
+        ;
+
+    // Tespit durum geçişi
+    void frame_state(int frame, double dbm, int count, int consec, bool jammed);
+
+    // Frame başına güç örneği: üretici tarafında biriktirilir, periyotta bir özet kaydı
+    void power_sample(double dbm, bool jammed);
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    AsyncLogger() = default;
+    ~AsyncLogger();
+
+    void submit(const LogRecord& r);
+    bool push(const LogRecord& r);
+    bool pop(LogRecord& r);
+    void drain_loop();
+    void emit(const LogRecord& r);
+
+    struct Cell {
+        std::atomic<size_t> seq{0};
+        LogRecord rec;
+    };
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> head_{0};    // üreticiler
+    alignas(64) std::atomic<size_t> tail_{0};    // tüketici
+
+    std::atomic<LogLevel> level_{LogLevel::Info};
+    std::atomic<bool>     running_{false};
+    std::atomic<bool>     quit_{false};
+    std::atomic<bool>     closed_{false};    // stop() başladı: yeni kayıtlar eşzamanlı yazılır
+    std::atomic<int>      inflight_{0};      // kuyruğa yazmakta olan üretici
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> pushed_{0};
+    uint64_t              reported_drops_ = 0;
+    FILE*                 out_ = stdout;
+    int                   summary_ms_ = 1000;
+    std::thread           th_;
+
+    // power_sample birikimi (tespit thread'i)
+    uint64_t sum_t0_ = 0;
+    double   sum_min_ = 0.0, sum_max_ = 0.0, sum_acc_ = 0.0;
+    int      sum_n_ = 0, sum_jam_ = 0;
+};
+
+inline AsyncLogger& logger() { return AsyncLogger::instance(); }
+
+} // namespace jd
@@ -0,0 +1,103 @@
+// jd/metrics.hpp
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace jd {
+
+inline uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// HDR benzeri log-lineer gecikme histogramı (ns).
+// Her ikinin kuvveti aralığı 16 alt kovaya bölünür (~%6 çözünürlük).
+// record() kilitsizdir (relaxed atomik); sıcak döngüden çağrılabilir.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBits  = 4;
+    static constexpr int kSub      = 1 << kSubBits;
+    static constexpr int kBuckets  = (64 - kSubBits + 1) * kSub;
+
+    struct Snapshot {
+        uint64_t count  = 0;
+        uint64_t sum_ns = 0;
+        uint64_t min_ns = 0;
+        uint64_t max_ns = 0;
+        std::array<uint64_t, kBuckets> buckets{};
+
+        double mean_us() const { return count ? 1e-3 * static_cast<double>(sum_ns) / count : 0.0; }
+        double percentile_us(double p) const;   // p: 0..100
+    };
+
+    LatencyHistogram() { reset(); }
+
+    void record(uint64_t ns) {
+        b_[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t m = max_.load(std::memory_order_relaxed);
+        while (ns > m && !max_.compare_exchange_weak(m, ns, std::memory_order_relaxed)) {}
+        m = min_.load(std::memory_order_relaxed);
+        while (ns < m && !min_.compare_exchange_weak(m, ns, std::memory_order_relaxed)) {}
+    }
+
+    Snapshot snapshot() const;
+    void reset();
+
+    static int bucket_of(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+        const int msb = 63 - __builtin_clzll(v | 1);
+#else
+        int msb = 63;
+        while (msb > 0 && !(v >> msb)) --msb;
+#endif
+        const int shift = msb > kSubBits ? msb - kSubBits : 0;
+        return shift * kSub + static_cast<int>(v >> shift);
+    }
+    static uint64_t bucket_low(int idx) {
+        if (idx < 2 * kSub) return static_cast<uint64_t>(idx);
+        const int shift = idx / kSub - 1;
+        return static_cast<uint64_t>(idx - shift * kSub) << shift;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, kBuckets> b_;
+    std::atomic<uint64_t> count_{0}, sum_{0}, min_{0}, max_{0};
+};
+
+// Tespit hattı aşamaları
+enum class Stage : uint8_t {
+    Refill,    // iio_buffer_refill / kaynak bekleme
+    Convert,   // cs16 -> complex<float>
+    Power,     // güç ölçümü / kanalizer
+    Decide,    // eşik + durum + log
+    Frame,     // get_frame başı -> karar sonu
+    Interval,  // ardışık refill tamamlanmaları arası (refill jitter)
+    Count
+};
+
+const char* stage_name(Stage s);
+
+struct HotPathMetrics {
+    std::array<LatencyHistogram, static_cast<size_t>(Stage::Count)> stage;
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> jammed_frames{0};
+    std::atomic<uint64_t> refill_errors{0};
+    std::atomic<uint64_t> stale_frames{0};
+    std::atomic<uint64_t> t0_ns{now_ns()};
+
+    void record(Stage s, uint64_t ns) { stage[static_cast<size_t>(s)].record(ns); }
+    void reset();
+};
+
+// Süreç genelinde tek örnek (PlutoSource + dedektörler aynı sayaçlara yazar)
+HotPathMetrics& hot_metrics();
+
+// Tek satır JSON özet (UDP STATS cevabı)
+std::string format_stats(const HotPathMetrics& m);
+
+} // namespace jd
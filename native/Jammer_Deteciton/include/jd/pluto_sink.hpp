@@ -0,0 +1,155 @@
+// jd/pluto_sink.hpp
+#pragma once
+
+#include "jd/metrics.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+extern "C" {
+#include <iio.h>
+}
+
+namespace jd {
+
+// TX örnek üreticisi: push thread'i iio tamponunu (iio_buffer_start) doğrudan buna
+// doldurtur; arada float ya da ara kopya yoktur.
+class ITxProducer {
+public:
+    virtual ~ITxProducer() = default;
+    // iq: n örneklik cs16, I/Q serpiştirilmiş (12 bit sola hizalı). Dönüş: yazılan örnek.
+    // n'den az dönüp eof() false ise üretici yetişememiştir: kalan sıfırlanır, underrun sayılır.
+    virtual size_t fill(int16_t* iq, size_t n) = 0;
+    virtual bool   eof() const = 0;
+};
+
+// .cs16 dosyasını eşleyip sırayla verir: ham cs16 ya da ofdm_cache girdisi
+// ('OCS1' başlığı atlanır). loop: dosya sonunda başa sarar (tekrarlı gönderim).
+class Cs16FileProducer : public ITxProducer {
+public:
+    Cs16FileProducer(const std::string& path, bool loop);
+    ~Cs16FileProducer() override;
+    Cs16FileProducer(const Cs16FileProducer&) = delete;
+    Cs16FileProducer& operator=(const Cs16FileProducer&) = delete;
+
+    bool     ok() const      { return iq_ != nullptr; }
+    uint64_t samples() const { return n_; }
+
+    size_t fill(int16_t* iq, size_t n) override;
+    bool   eof() const override { return !loop_ && pos_ >= n_; }
+
+private:
+    const uint8_t* base_ = nullptr;
+    uint64_t       size_ = 0;
+    const int16_t* iq_   = nullptr;
+    uint64_t       n_    = 0;
+    uint64_t       pos_  = 0;
+    bool           loop_ = false;
+#if defined(_WIN32)
+    void* file_ = nullptr;
+    void* map_  = nullptr;
+#endif
+};
+
+struct PlutoSinkConfig {
+    std::string uri;                           // PlutoConfig::uri ile aynı biçim
+    uint64_t    center_hz   = 2402000000ULL;   // TX LO
+    uint64_t    samp_hz     = 4000000ULL;
+    uint64_t    rfbw_hz     = 4000000ULL;
+    int         atten_db    = 10;              // hardwaregain = -atten_db
+    int         buffer_samples = 32768;        // tx_runner --buffer
+    int         kernel_buffers = 4;            // DMA halkası (push bu kadar blok önde kalabilir)
+    bool        apply_config   = true;         // false: paylaşılan context'te PHY ayarlarına dokunma
+};
+
+// DMA kuyruğu boşaldı (kestirim) ya da üretici zamanında örnek veremedi
+struct TxUnderrun {
+    enum class Kind : uint8_t { Producer, Queue };
+    Kind     kind    = Kind::Queue;
+    uint64_t sample  = 0;    // o ana kadar gönderilen örnek
+    uint64_t missing = 0;    // Producer: sıfırla doldurulan; Queue: kestirilen boşluk (örnek)
+};
+
+struct TxStats {
+    uint64_t pushes             = 0;
+    uint64_t samples            = 0;
+    uint64_t producer_underruns = 0;
+    uint64_t queue_underruns    = 0;
+    uint64_t push_errors        = 0;
+    bool     running            = false;
+    bool     finished           = false;   // üretici eof ile bitti
+};
+
+// Native TX motoru: PlutoSource'un eşi. cf-ad9361-dds-core-lpc üzerinde cs16 TX
+// tamponu açar; ayrı push thread'i üreticiyi iio_buffer_start()'a doğrudan yazdırıp
+// iio_buffer_push() ile kernel halkasına (kernel_buffers blok) verir. Her push'tan
+// sonra başlangıç adresi yeniden alınır (libiio mmap blokları döner).
+// Kuyruk underrun kestirimi: son çapadan bu yana pushlanan - tüketilen (duvar saati *
+// örnek hızı); push bloklandığında kuyruk dolu kabul edilip çapa yenilenir (saat kayması).
+class PlutoSink {
+public:
+    using UnderrunFn = std::function<void(const TxUnderrun&)>;
+
+    // shared_ctx: PlutoSource::raw_ctx() ile RX/TX tek context'i paylaşır (sahiplik alınmaz)
+    explicit PlutoSink(const PlutoSinkConfig& cfg, iio_context* shared_ctx = nullptr);
+    ~PlutoSink();
+    PlutoSink(const PlutoSink&) = delete;
+    PlutoSink& operator=(const PlutoSink&) = delete;
+
+    bool ok() const { return txdev_ != nullptr; }
+
+    // Push thread'ini başlatır (çalışıyorsa önce durdurur). Tampon her start'ta açılır.
+    bool start(std::shared_ptr<ITxProducer> producer);
+    // Bekleyen push iptal edilir, thread birleştirilir, tampon bırakılır
+    void stop();
+    bool running() const { return running_.load(std::memory_order_acquire); }
+
+    // Push thread'inden çağrılır; kısa tutulmalı. start() öncesi ayarlanır.
+    void set_underrun_cb(UnderrunFn fn) { on_underrun_ = std::move(fn); }
+
+    // Çalışırken ayar (TX LO hop, zayıflatma)
+    bool set_center_freq(uint64_t hz);
+    bool set_atten_db(int db);
+
+    TxStats stats() const;
+    const LatencyHistogram& push_latency()  const { return push_hist_; }   // iio_buffer_push süresi
+    const LatencyHistogram& push_interval() const { return intv_hist_; }   // ardışık push arası (jitter)
+    const LatencyHistogram& fill_latency()  const { return fill_hist_; }   // üretici doldurma süresi
+
+    iio_context* raw_ctx()   const { return ctx_; }
+    iio_buffer*  raw_txbuf() const { return txbuf_; }
+
+private:
+    bool init_context(iio_context* shared_ctx);
+    bool apply_static_config();
+    void push_loop();
+    void report(TxUnderrun::Kind k, uint64_t sample, uint64_t missing);
+
+    PlutoSinkConfig cfg_{};
+    iio_context* ctx_      = nullptr;
+    bool         own_ctx_  = false;
+    iio_device*  phy_      = nullptr;   // "ad9361-phy"
+    iio_channel* lo_ch_    = nullptr;   // "altvoltage1" (TX LO)
+    iio_channel* phy_tx_ch_ = nullptr;  // ad9361-phy "voltage0" output
+    iio_device*  txdev_    = nullptr;   // "cf-ad9361-dds-core-lpc"
+    iio_channel* tx_i_     = nullptr;   // "voltage0" output
+    iio_channel* tx_q_     = nullptr;   // "voltage1" output
+    iio_buffer*  txbuf_    = nullptr;
+
+    std::mutex   attr_m_;
+    std::thread  th_;
+    std::shared_ptr<ITxProducer> prod_;
+    UnderrunFn   on_underrun_;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<bool> finished_{false};
+
+    std::atomic<uint64_t> pushes_{0}, samples_{0}, prod_under_{0}, queue_under_{0}, push_err_{0};
+    LatencyHistogram push_hist_, intv_hist_, fill_hist_;
+};
+
+} // namespace jd
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 
 extern "C" {
 #include <iio.h>
@@ -15,6 +16,15 @@ extern "C" {
 
 namespace jd {
 
+class SigmfRecorder;
+
+// Retune öncesi kuyrukta kalan (eski frekanstan) tamponlara ne yapılacağı
+enum class RetuneFlush {
+    Tag,       // frameler döner, last_frame_stale() true olur; tespit/tarama atar
+    Drain,     // get_frame() eski tamponları sessizce atar (varsayılan)
+    Recreate   // retune içinde iio buffer yeniden oluşturulur
+};
+
 struct PlutoConfig {
     std::string uri;                 // "ip:192.168.2.1" | "usb:" | "" (default)
     uint64_t    center_hz   = 2402000000ULL; // 2.402 GHz
@@ -22,6 +32,16 @@ struct PlutoConfig {
     uint64_t    rfbw_hz     = 4000000ULL;    // 4 MHz
     int         frame_len   = 4096;          // samples per frame
     int         rx_gain_db  = -10;           // RX manual gain (dB)
+    int         kernel_buffers = 4;          // iio kernel tampon sayısı
+    RetuneFlush flush       = RetuneFlush::Drain;
+};
+
+// Son retune'un ölçülen gecikmeleri
+struct RetuneTiming {
+    double   write_ms        = 0.0;   // attribute yazımları
+    double   to_data_ms      = 0.0;   // retune başı -> ilk taze frame
+    int      stale_dropped   = 0;     // atılan/etiketlenen eski tampon
+    uint64_t count           = 0;
 };
 
 class PlutoSource : public ISource {
@@ -33,7 +53,19 @@ public:
     bool get_frame(std::vector<std::complex<float>>& out) override;
     void release() override;
 
-    // Çalışırken ayar değişimi
+    // Toplu retune: önbellekli tutamaçlarla yalnız değişen attribute'ları yazar,
+    // eski tamponları cfg.flush politikasına göre atar/etiketler.
+    bool retune(const RetuneRequest& req, RetuneResult* out = nullptr) override;
+    uint64_t generation() const override { return frame_gen_; }
+    bool last_frame_stale() const override { return last_stale_; }
+    RetuneTiming retune_timing() const;
+
+    // Başka thread'den (kontrol düzlemi) retune: istek kutuya konur ve RX
+    // thread'i bir sonraki get_frame() başında uygular. Bekleyen istekle
+    // alan alan birleştirilir.
+    void post_retune(const RetuneRequest& req);
+
+    // Çalışırken ayar değişimi (retune() üzerinden)
     bool set_center_freq(uint64_t hz);
     bool set_rf_bw(uint64_t hz);
     bool set_sample_rate(uint64_t hz);
@@ -43,6 +75,9 @@ public:
     // Yalnız RX'i kapat (TX'e dokunmaz, context açık kalır)
     bool shutdown_rx_only();
 
+    // Kayıt musluğu: taze RX tamponları ham cs16 olarak kaydedilir (nullptr: kapalı)
+    void set_record_tap(SigmfRecorder* rec) { rec_ = rec; }
+
     // libiio timeout (ms)
     void set_timeout_ms(int ms);
 
@@ -60,16 +95,41 @@ private:
     iio_channel* rx_ch_ = nullptr;   // "voltage0" (input=false)
     iio_buffer*  rxbuf_ = nullptr;
 
+    // Önbellekli PHY tutamaçları (init'te bir kez bulunur)
+    iio_channel* phy_rx_ch_ = nullptr;   // ad9361-phy "voltage0" input
+    iio_channel* phy_tx_ch_ = nullptr;   // ad9361-phy "voltage0" output
+    enum class AttrTarget : uint8_t { None, RxChan, TxChan, Device };
+    AttrTarget   rate_at_ = AttrTarget::None;  // sampling_frequency hangi hedefe yazılabildi
+    AttrTarget   rfbw_at_ = AttrTarget::None;  // rf_bandwidth hangi hedefe yazılabildi
+    std::string  gain_mode_;                   // son yazılan gain_control_mode
+
+    // Retune nesli / eski tampon takibi
+    uint64_t     gen_        = 0;   // son retune nesli
+    uint64_t     frame_gen_  = 0;   // son dönen frame'in nesli
+    int          stale_left_ = 0;   // henüz atılmamış eski tampon
+    bool         last_stale_ = false;
+    bool         awaiting_data_ = false;
+    std::chrono::steady_clock::time_point retune_t0_{};
+    RetuneTiming timing_{};
+
+    SigmfRecorder* rec_ = nullptr;
+    uint64_t     last_refill_ns_ = 0;   // refill aralığı (jitter) ölçümü
     // Eşzamanlılık/güvenlik
     std::mutex        m_;
     std::atomic<bool> rx_open_{false};
 
+    // post_retune kutusu
+    std::mutex        pend_m_;
+    RetuneRequest     pend_{};
+    std::atomic<bool> pend_flag_{false};
+
     // Kurulum adımları
     bool init_context();
     bool apply_static_config();
     bool alloc_buffer();
 
     // Yardımcılar
+    bool write_attr_ll(AttrTarget at, const char* attr, long long val);
     static bool write_dev_ll (iio_device* dev,  const char* attr, long long val);
     static bool write_dev_str(iio_device* dev,  const char* attr, const char* val);
     static bool write_chan_ll(iio_channel* ch,  const char* attr, long long val);
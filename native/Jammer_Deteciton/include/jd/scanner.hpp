@@ -0,0 +1,78 @@
+// jd/scanner.hpp
+#pragma once
+#include "jd/source.hpp"
+#include "jd/power_meter.hpp"
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+namespace jd {
+
+// Hop tablosu üzerinde süpürme taraması: her frekansta dwell kadar ölçüm,
+// frekans başına EWMA güç + jammer durumu. Ziyaret süresi = ölçülen settle + dwell;
+// auto_dwell açıkken dwell, tespitin karar için istediği frame sayısına indirilir.
+struct ScanConfig {
+    std::vector<uint64_t> freqs_hz;
+    int    dwell_frames      = 8;      // frekans başına ölçülen frame (auto_dwell: üst sınır)
+    bool   auto_dwell        = true;   // dwell = required_frames
+    int    required_frames   = 5;      // karar için gereken geçerli frame (tespit ardışık sayacı)
+    int    settle_frames     = 2;      // retune sonrası atılan frame (başlangıç değeri)
+    bool   auto_settle       = true;   // ölçülen retune gecikmesine göre settle_frames ayarla
+    int    max_settle_frames = 16;
+    double settle_tol_db     = 1.0;    // ardışık iki frame farkı < tol -> geçerli veri
+    double ewma_alpha        = 0.25;
+    double threshold_dbm     = -50.0;  // EWMA bu eşiği aşarsa kanal jammed
+};
+
+// Kompakt tablo girdisi (frekans başına 16 bayt)
+struct ScanEntry {
+    uint64_t hz        = 0;
+    float    ewma_dbm  = -300.0f;
+    uint16_t visits    = 0;
+    uint8_t  jammed    = 0;
+    uint8_t  _pad      = 0;
+};
+
+struct RetuneStats {
+    double   mean_ms         = 0.0;   // retune çağrısından geçerli ilk frame'e
+    double   max_ms          = 0.0;
+    double   mean_frames     = 0.0;   // geçerli veriye kadar atılan frame (EWMA)
+    uint64_t count           = 0;
+};
+
+class Scanner {
+public:
+    using TuneFn = std::function<bool(uint64_t hz)>;
+
+    Scanner(ISource& src, TuneFn tune, PowerMeter pm, ScanConfig cfg);
+
+    // Tablonun tek turu; kaynak bittiyse false
+    bool sweep();
+
+    const std::vector<ScanEntry>& table() const { return table_; }
+    // Temiz kanallar önce, EWMA gücüne göre artan sıralı indeksler
+    std::vector<int> ranked() const;
+
+    const RetuneStats& retune_stats() const { return rs_; }
+    int  settle_frames() const { return settle_; }
+    int  dwell_frames() const { return dwell_; }
+    uint64_t sweeps() const { return sweeps_; }
+
+    void set_threshold_dbm(double thr) { cfg_.threshold_dbm = thr; }
+
+private:
+    bool visit(ScanEntry& e);
+
+    ISource&    src_;
+    TuneFn      tune_;
+    PowerMeter  pm_;
+    ScanConfig  cfg_;
+    std::vector<ScanEntry> table_;
+    std::vector<std::complex<float>> frame_;
+    RetuneStats rs_;
+    int         settle_ = 2;
+    int         dwell_  = 8;
+    uint64_t    sweeps_ = 0;
+};
+
+} // namespace jd
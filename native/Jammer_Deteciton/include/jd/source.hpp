@@ -1,9 +1,26 @@
 #pragma once
 #include <vector>
 #include <complex>
+#include <cstdint>
+#include <optional>
+#include <string>
 
 namespace jd {
 
+// Toplu ayar değişimi: yalnız dolu alanlar (ve değişenler) yazılır
+struct RetuneRequest {
+    std::optional<uint64_t>    center_hz;
+    std::optional<uint64_t>    rfbw_hz;
+    std::optional<int>         rx_gain_db;   // gain_mode'u "manual" yapar
+    std::optional<std::string> gain_mode;    // "manual" | "slow_attack" | ...
+};
+
+struct RetuneResult {
+    bool     ok          = false;
+    double   write_ms    = 0.0;   // attribute yazma süresi
+    uint64_t generation  = 0;     // retune sonrası frame nesli
+};
+
 // Frame sağlayıcı arayüzü (Pluto/dosya/simülasyon hepsi buradan türesin)
 class ISource {
 public:
@@ -11,6 +28,14 @@ public:
     // true: frame üretildi; false: kaynak bitti/hata
     virtual bool get_frame(std::vector<std::complex<float>>& out) = 0;
     virtual void release() {} // opsiyonel kaynak bırakma
+
+    // Çalışırken yeniden ayar (desteklemeyen kaynaklar false döner)
+    virtual bool retune(const RetuneRequest&, RetuneResult* = nullptr) { return false; }
+    // Son get_frame() çıktısının üretildiği ayar nesli (her retune'da artar)
+    virtual uint64_t generation() const { return 0; }
+    // Son frame retune öncesi ayardan mı (RetuneFlush::Tag); tüketiciler bu frameleri
+    // ölçüme katmadan atar
+    virtual bool last_frame_stale() const { return false; }
 };
 
 } // namespace jd
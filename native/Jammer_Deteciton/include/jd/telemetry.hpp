@@ -0,0 +1,63 @@
+// jd/telemetry.hpp
+#pragma once
+#include "jd/metrics.hpp"
+#include "jd/udp_index.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace jd {
+
+class Counter;
+
+struct TelemetryConfig {
+    int period_ms  = 100;    // yayın periyodu (0: kapalı)
+    int max_frames = 32;     // paket başına son N frame girdisi (1..255)
+};
+
+// Telemetri V2 toplayıcı: tespit thread'i her frame'de frame() çağırır; periyot
+// dolunca aynı thread bir JdxTelemetryV2 datagramı (son N frame + periyot özeti +
+// aşama gecikmeleri) ve olay halkasına bir Telemetry özeti yazar. Frame yoksa
+// (RX kapalı) paket de yoktur; V1 TICK akışı bundan bağımsızdır.
+// Aşama yüzdelikleri hot_metrics() histogramlarının periyot farkından hesaplanır.
+class Telemetry {
+public:
+    static Telemetry& instance();
+
+    // udp: hedef soket (nullptr: yalnız olay halkası); ctr: oturum + hop durumu
+    void start(const TelemetryConfig& cfg, UdpIndex* udp, const Counter* ctr);
+    void stop();
+    bool enabled() const { return on_; }
+
+    void frame(uint64_t frame, double power_dbm, double threshold_dbm, bool jammed);
+
+    uint64_t packets() const { return pkt_; }
+
+private:
+    Telemetry() = default;
+    void flush(uint64_t t);
+    void stage_delta(JdxTelemetryV2& h);
+
+    TelemetryConfig cfg_;
+    bool            on_  = false;
+    UdpIndex*       udp_ = nullptr;
+    const Counter*  ctr_ = nullptr;
+    int64_t         unix_off_ = 0;
+
+    // Periyot birikimi (son max_frames girdi halka düzeninde)
+    std::unique_ptr<JdxTelemetryFrameV2[]> ring_;
+    std::unique_ptr<uint64_t[]>            ring_frame_;
+    std::unique_ptr<JdxTelemetryFrameV2[]> out_;
+    uint64_t t0_ = 0;
+    uint32_t n_ = 0, over_ = 0;
+    double   min_ = 0.0, max_ = 0.0, acc_ = 0.0, thr_ = 0.0;
+    bool     jam_ = false;
+    uint64_t pkt_ = 0;
+
+    std::unique_ptr<std::array<LatencyHistogram::Snapshot, kJdxStages>> prev_, cur_;
+};
+
+inline Telemetry& telemetry() { return Telemetry::instance(); }
+
+} // namespace jd
@@ -16,6 +16,54 @@ struct JdxPacketV1 {
     uint8_t  state;
     uint8_t  _pad[7]{};
 };
+
+// Tarama modu: temiz kanal sıralaması (başlık + count adet girdi, temizden kirliye)
+struct JdxRankHeaderV1 {
+    uint32_t magic = 0x4B4E524A; // 'JRNK'
+    uint64_t sweep;
+    uint16_t count;
+    uint16_t _pad{};
+};
+
+struct JdxRankEntryV1 {
+    uint64_t hz;
+    int16_t  ewma_cdbm;          // EWMA güç, 0.01 dBm
+    uint8_t  jammed;
+    uint8_t  _pad{};
+};
+
+// Telemetri V2: periyot başına tek datagram (başlık + count adet frame girdisi).
+// V1 (START/TICK/STOP) aynen sürer; V2 ayrı porttan gider.
+constexpr int kJdxStages = 6;    // jd::Stage::Count
+struct JdxTelemetryV2 {
+    uint32_t magic = 0x3258444A; // 'JDX2'
+    uint16_t version = 2;
+    uint16_t header_size = 0;    // sizeof(JdxTelemetryV2); girdiler bunun ardından
+    uint64_t pkt;                // paket sayacı (alıcıda kayıp tespiti)
+    uint64_t session;            // JDX seq (oturum yoksa son oturum)
+    int64_t  t0_ns;              // periyodun ilk frame'i (monotonik)
+    int64_t  t_ns;               // gönderim anı (monotonik)
+    int64_t  unix_off_ns;        // UNIX ns - monotonik ns
+    uint64_t first_frame;        // girdilerin ilk frame numarası
+    uint32_t frames;             // periyottaki frame sayısı (girdilerden fazla olabilir)
+    uint32_t over;               // eşik üstü frame sayısı
+    int16_t  thr_cdbm;           // güncel eşik, 0.01 dBm
+    int16_t  min_cdbm, mean_cdbm, max_cdbm;   // periyot güç özeti
+    uint8_t  state;              // bit0: jammer (son frame), bit1: oturum aktif
+    uint8_t  count;              // frame girdisi (son N frame)
+    int16_t  hop_value;          // güncel hop değeri (oturum yoksa 0)
+    uint32_t _pad{};
+    uint64_t hop_slot;
+    uint32_t stage_p50_us[kJdxStages];   // periyottaki aşama gecikmeleri (jd::Stage sırası)
+    uint32_t stage_p99_us[kJdxStages];
+};
+
+struct JdxTelemetryFrameV2 {
+    uint32_t dt_us;              // t0_ns'ten itibaren
+    int16_t  cdbm;               // güç, 0.01 dBm
+    uint8_t  flags;              // bit0: eşik üstü, bit1: jammer durumu
+    uint8_t  _pad{};
+};
 #pragma pack(pop)
 
 class UdpIndex {
@@ -30,10 +78,18 @@ public:
 
     // Her frame’de çağır
     void tick(const Counter& ctr);
+    // Hop zamanlayıcısından: slotun değeri (son tarihte hesaplanmış slot)
+    void tick(const Counter& ctr, uint64_t slot);
 
     // Jammer bittiğinde çağır
     void stop(const Counter& ctr);
 
+    // Tarama sonucu sıralı kanal listesi (tek datagram)
+    void publish_ranking(uint64_t sweep, const JdxRankEntryV1* entries, uint16_t count);
+
+    // Telemetri V2 (tek datagram; h.count girdi)
+    void publish_telemetry(const JdxTelemetryV2& h, const JdxTelemetryFrameV2* frames);
+
 private:
     void send(JdxState st, uint64_t seq, uint64_t us);
 
@@ -0,0 +1,61 @@
+/* mock/iio.h
+ * libiio 0.x C API'sinin PlutoSource/PlutoSink'in kullandığı alt kümesi.
+ * JD_MOCK_IIO=ON derlemede gerçek iio.h yerine bu başlık bulunur;
+ * imzalar libiio ile birebir aynıdır (kaynak kodu değişmeden derlenir).
+ */
+#ifndef JD_MOCK_IIO_H
+#define JD_MOCK_IIO_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#ifdef _MSC_VER
+  #include <BaseTsd.h>
+  typedef SSIZE_T ssize_t;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct iio_context;
+struct iio_device;
+struct iio_channel;
+struct iio_buffer;
+
+/* Context */
+struct iio_context* iio_create_default_context(void);
+struct iio_context* iio_create_context_from_uri(const char* uri);
+void                iio_context_destroy(struct iio_context* ctx);
+int                 iio_context_set_timeout(struct iio_context* ctx, unsigned int timeout_ms);
+unsigned int        iio_context_get_devices_count(const struct iio_context* ctx);
+struct iio_device*  iio_context_get_device(const struct iio_context* ctx, unsigned int index);
+struct iio_device*  iio_context_find_device(const struct iio_context* ctx, const char* name);
+
+/* Device / channel */
+const char*         iio_device_get_name(const struct iio_device* dev);
+struct iio_channel* iio_device_find_channel(const struct iio_device* dev, const char* name, bool output);
+int                 iio_device_set_kernel_buffers_count(const struct iio_device* dev, unsigned int nb_buffers);
+int                 iio_device_attr_write_longlong(const struct iio_device* dev, const char* attr, long long val);
+ssize_t             iio_device_attr_write(const struct iio_device* dev, const char* attr, const char* src);
+int                 iio_channel_attr_write_longlong(const struct iio_channel* chn, const char* attr, long long val);
+ssize_t             iio_channel_attr_write(const struct iio_channel* chn, const char* attr, const char* src);
+void                iio_channel_enable(struct iio_channel* chn);
+void                iio_channel_disable(struct iio_channel* chn);
+
+/* Buffer */
+struct iio_buffer*  iio_device_create_buffer(const struct iio_device* dev, size_t samples_count, bool cyclic);
+ssize_t             iio_buffer_refill(struct iio_buffer* buf);
+ssize_t             iio_buffer_push(struct iio_buffer* buf);
+void*               iio_buffer_start(const struct iio_buffer* buf);
+void*               iio_buffer_end(const struct iio_buffer* buf);
+ptrdiff_t           iio_buffer_step(const struct iio_buffer* buf);
+void                iio_buffer_cancel(struct iio_buffer* buf);
+void                iio_buffer_destroy(struct iio_buffer* buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JD_MOCK_IIO_H */
@@ -0,0 +1,546 @@
+// mock/iio_mock.cpp
+// libiio'nun süreç içi sahte arka ucu: ad9361-phy / cf-ad9361-lpc / cf-ad9361-dds-core-lpc
+// cihazlarını taklit eder, RX tamponlarını gürültü + ton/darbe ile doldurur.
+// JD_MOCK_IIO=ON derlemede gerçek libiio yerine bağlanır.
+#include "iio.h"
+#include "iio_mock.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef M_PI
+  #define M_PI 3.14159265358979323846
+#endif
+
+using jd::mock::MockIioConfig;
+using jd::mock::MockIioStats;
+using jd::mock::MockTone;
+
+// ------------------------------------------------------------
+// Sahte nesneler
+struct iio_channel {
+    std::string  id;
+    bool         output  = false;
+    bool         enabled = false;
+    iio_device*  dev     = nullptr;
+    std::map<std::string, std::string> attrs;
+};
+
+struct iio_device {
+    std::string  name;
+    iio_context* ctx = nullptr;
+    unsigned int kernel_buffers = 4;
+    std::vector<std::unique_ptr<iio_channel>> chans;
+    std::map<std::string, std::string> attrs;
+};
+
+struct iio_context {
+    MockIioConfig cfg;
+    unsigned int  timeout_ms = 0;
+    std::vector<std::unique_ptr<iio_device>> devs;
+
+    // Radyo durumu (attribute yazımlarıyla güncellenir)
+    std::mutex m;
+    int64_t  lo_hz    = 2402000000LL;
+    int64_t  samp_hz  = 4000000LL;
+    int64_t  rfbw_hz  = 4000000LL;
+    int      gain_db  = 0;
+
+    // LO değişimi kernel kuyruğundaki tamponlara gecikmeli yansır
+    int64_t  eff_lo_hz = 2402000000LL;
+    unsigned lo_lag    = 0;
+
+    std::vector<std::complex<float>> noise;   // önceden üretilmiş birim gürültü
+    std::mt19937 rng;
+};
+
+struct iio_buffer {
+    iio_device*          dev    = nullptr;
+    size_t               samples = 0;
+    bool                 cyclic = false;
+    bool                 output = false;
+    std::vector<int16_t> data;              // I/Q serpiştirilmiş
+    std::atomic<bool>    cancelled{false};
+    uint64_t             pos    = 0;        // üretilen toplam örnek (zaman ekseni)
+    std::vector<double>  phase;             // ton başına faz (rad)
+    std::chrono::steady_clock::time_point t0{};
+    bool                 started = false;
+    std::vector<int16_t> spare;             // TX: push sonrası verilen sonraki blok
+};
+
+// ------------------------------------------------------------
+// Global yapılandırma ve sayaçlar
+namespace {
+
+std::mutex          g_cfg_m;
+bool                g_cfg_set = false;
+MockIioConfig       g_cfg;
+
+std::atomic<uint64_t> g_refills{0}, g_refill_fail{0}, g_pushes{0}, g_attr_writes{0},
+                      g_samples{0}, g_buffers{0}, g_cancels{0},
+                      g_tx_samples{0}, g_tx_underruns{0};
+std::atomic<uint64_t> g_tx_sum{0xcbf29ce484222325ull};
+std::atomic<int64_t>  g_lo{0}, g_tx_lo{0}, g_samp{0};
+std::atomic<int>      g_gain{0};
+std::atomic<bool>     g_open{false};
+
+constexpr size_t kNoiseLen = 1u << 16;
+
+MockIioConfig active_config() {
+    std::lock_guard<std::mutex> lk(g_cfg_m);
+    if (g_cfg_set) return g_cfg;
+    MockIioConfig c;
+    if (const char* env = std::getenv("JD_MOCK_IIO")) {
+        if (!jd::mock::parse_config(env, c))
+            std::fprintf(stderr, "[MOCK] JD_MOCK_IIO ayrıştırılamadı: %s\n", env);
+    }
+    return c;
+}
+
+iio_channel* add_chan(iio_device* d, const char* id, bool output) {
+    auto ch = std::make_unique<iio_channel>();
+    ch->id = id;
+    ch->output = output;
+    ch->dev = d;
+    d->chans.push_back(std::move(ch));
+    return d->chans.back().get();
+}
+
+iio_device* add_dev(iio_context* ctx, const char* name) {
+    auto d = std::make_unique<iio_device>();
+    d->name = name;
+    d->ctx = ctx;
+    ctx->devs.push_back(std::move(d));
+    return ctx->devs.back().get();
+}
+
+iio_context* make_context(const char* uri) {
+    MockIioConfig cfg = active_config();
+    if (cfg.fail_context) {
+        errno = ENODEV;
+        return nullptr;
+    }
+    auto* ctx = new iio_context();
+    ctx->cfg = cfg;
+    ctx->rng.seed(cfg.seed);
+
+    iio_device* phy = add_dev(ctx, "ad9361-phy");
+    add_chan(phy, "voltage0", false);
+    add_chan(phy, "voltage1", false);
+    add_chan(phy, "voltage0", true);
+    add_chan(phy, "voltage1", true);
+    add_chan(phy, "altvoltage0", true);   // RX LO
+    add_chan(phy, "altvoltage1", true);   // TX LO
+
+    iio_device* rx = add_dev(ctx, "cf-ad9361-lpc");
+    add_chan(rx, "voltage0", false);
+    add_chan(rx, "voltage1", false);
+
+    iio_device* tx = add_dev(ctx, "cf-ad9361-dds-core-lpc");
+    for (const char* v : {"voltage0", "voltage1", "voltage2", "voltage3"}) add_chan(tx, v, true);
+
+    // Birim güçlü karmaşık Gauss gürültü tablosu (refill başına rastgele ofset)
+    ctx->noise.resize(kNoiseLen);
+    std::normal_distribution<float> nd(0.0f, static_cast<float>(std::sqrt(0.5)));
+    for (auto& z : ctx->noise) z = { nd(ctx->rng), nd(ctx->rng) };
+
+    g_open.store(true);
+    std::fprintf(stderr, "[MOCK] iio context (%s): noise=%.1f dBFS, %zu tone(s)%s\n",
+                 uri ? uri : "default", cfg.noise_dbfs, cfg.tones.size(), cfg.realtime ? ", realtime" : "");
+    return ctx;
+}
+
+void sleep_us(int us) {
+    if (us > 0) std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// Radyo durumunu attribute yazımından güncelle
+void apply_attr(iio_context* ctx, const iio_channel* ch, const char* attr, long long v) {
+    std::lock_guard<std::mutex> lk(ctx->m);
+    if (std::strcmp(attr, "frequency") == 0 && ch && ch->id == "altvoltage0") {
+        if (v != ctx->lo_hz) {
+            ctx->lo_hz  = v;
+            ctx->lo_lag = 0;
+            // Kuyrukta bekleyen tamponlar eski LO ile dolmuştu
+            for (auto& d : ctx->devs)
+                if (d->name == "cf-ad9361-lpc") ctx->lo_lag = d->kernel_buffers;
+        }
+        g_lo.store(v);
+    } else if (std::strcmp(attr, "sampling_frequency") == 0) {
+        if (v > 0) ctx->samp_hz = v;
+        g_samp.store(v);
+    } else if (std::strcmp(attr, "rf_bandwidth") == 0) {
+        if (v > 0) ctx->rfbw_hz = v;
+    } else if (std::strcmp(attr, "frequency") == 0 && ch && ch->id == "altvoltage1") {
+        g_tx_lo.store(v);
+    } else if (std::strcmp(attr, "hardwaregain") == 0 && !(ch && ch->output)) {
+        ctx->gain_db = static_cast<int>(v);
+        g_gain.store(static_cast<int>(v));
+    }
+}
+
+bool parse_tone(const std::string& s, bool burst, MockTone& t) {
+    double f[5] = {0, 0, 0, 0, 0};
+    int n = 0;
+    size_t p = 0;
+    while (n < 5 && p <= s.size()) {
+        const size_t e = std::min(s.find(':', p), s.size());
+        char* end = nullptr;
+        const std::string tok = s.substr(p, e - p);
+        f[n] = std::strtod(tok.c_str(), &end);
+        if (tok.empty() || *end) return false;
+        ++n;
+        p = e + 1;
+        if (e == s.size()) break;
+    }
+    if (n < 2 || (burst && n < 4)) return false;
+    t.hz = f[0];
+    t.dbfs = f[1];
+    t.on_ms = (n >= 4) ? f[2] : 0.0;
+    t.period_ms = (n >= 4) ? f[3] : 0.0;
+    t.start_ms = (n >= 5) ? f[4] : 0.0;
+    return true;
+}
+
+} // namespace
+
+// ------------------------------------------------------------
+// Kontrol API'si
+namespace jd {
+namespace mock {
+
+void configure(const MockIioConfig& cfg) {
+    std::lock_guard<std::mutex> lk(g_cfg_m);
+    g_cfg = cfg;
+    g_cfg_set = true;
+}
+
+bool parse_config(const std::string& spec, MockIioConfig& out) {
+    bool ok = true;
+    size_t p = 0;
+    while (p < spec.size()) {
+        const size_t e = std::min(spec.find(',', p), spec.size());
+        const std::string kv = spec.substr(p, e - p);
+        p = e + 1;
+        if (kv.empty()) continue;
+        const size_t eq = kv.find('=');
+        const std::string k = kv.substr(0, eq);
+        const std::string v = (eq == std::string::npos) ? std::string("1") : kv.substr(eq + 1);
+
+        if      (k == "noise")           out.noise_dbfs = std::atof(v.c_str());
+        else if (k == "realtime")        out.realtime = std::atoi(v.c_str()) != 0;
+        else if (k == "latency_us")      out.latency_us = std::atoi(v.c_str());
+        else if (k == "attr_latency_us") out.attr_latency_us = std::atoi(v.c_str());
+        else if (k == "fail_after")      out.fail_after = std::strtoull(v.c_str(), nullptr, 10);
+        else if (k == "fail_prob")       out.fail_prob = std::atof(v.c_str());
+        else if (k == "fail_context")    out.fail_context = std::atoi(v.c_str()) != 0;
+        else if (k == "seed")            out.seed = static_cast<uint32_t>(std::strtoul(v.c_str(), nullptr, 10));
+        else if (k == "tone" || k == "burst") {
+            MockTone t;
+            if (parse_tone(v, k == "burst", t)) out.tones.push_back(t);
+            else ok = false;
+        } else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+MockIioStats stats() {
+    MockIioStats s;
+    s.refills         = g_refills.load();
+    s.refill_fail     = g_refill_fail.load();
+    s.pushes          = g_pushes.load();
+    s.attr_writes     = g_attr_writes.load();
+    s.samples         = g_samples.load();
+    s.buffers_created = g_buffers.load();
+    s.cancels         = g_cancels.load();
+    s.tx_samples      = g_tx_samples.load();
+    s.tx_underruns    = g_tx_underruns.load();
+    s.tx_checksum     = g_tx_sum.load();
+    s.lo_hz           = g_lo.load();
+    s.tx_lo_hz        = g_tx_lo.load();
+    s.samp_hz         = g_samp.load();
+    s.gain_db         = g_gain.load();
+    s.context_open    = g_open.load();
+    return s;
+}
+
+void reset_stats() {
+    g_refills = 0; g_refill_fail = 0; g_pushes = 0; g_attr_writes = 0;
+    g_samples = 0; g_buffers = 0; g_cancels = 0;
+    g_tx_samples = 0; g_tx_underruns = 0; g_tx_sum = 0xcbf29ce484222325ull;
+}
+
+} // namespace mock
+} // namespace jd
+
+// ------------------------------------------------------------
+// libiio C API
+extern "C" {
+
+struct iio_context* iio_create_default_context(void) { return make_context(nullptr); }
+struct iio_context* iio_create_context_from_uri(const char* uri) { return make_context(uri); }
+
+void iio_context_destroy(struct iio_context* ctx) {
+    if (!ctx) return;
+    delete ctx;
+    g_open.store(false);
+}
+
+int iio_context_set_timeout(struct iio_context* ctx, unsigned int timeout_ms) {
+    if (!ctx) return -EINVAL;
+    ctx->timeout_ms = timeout_ms;
+    return 0;
+}
+
+unsigned int iio_context_get_devices_count(const struct iio_context* ctx) {
+    return ctx ? static_cast<unsigned int>(ctx->devs.size()) : 0u;
+}
+
+struct iio_device* iio_context_get_device(const struct iio_context* ctx, unsigned int index) {
+    if (!ctx || index >= ctx->devs.size()) return nullptr;
+    return ctx->devs[index].get();
+}
+
+struct iio_device* iio_context_find_device(const struct iio_context* ctx, const char* name) {
+    if (!ctx || !name) return nullptr;
+    for (const auto& d : ctx->devs) if (d->name == name) return d.get();
+    return nullptr;
+}
+
+const char* iio_device_get_name(const struct iio_device* dev) {
+    return dev ? dev->name.c_str() : nullptr;
+}
+
+struct iio_channel* iio_device_find_channel(const struct iio_device* dev, const char* name, bool output) {
+    if (!dev || !name) return nullptr;
+    for (const auto& c : dev->chans) if (c->id == name && c->output == output) return c.get();
+    return nullptr;
+}
+
+int iio_device_set_kernel_buffers_count(const struct iio_device* dev, unsigned int nb_buffers) {
+    if (!dev || nb_buffers == 0) return -EINVAL;
+    const_cast<iio_device*>(dev)->kernel_buffers = nb_buffers;
+    return 0;
+}
+
+int iio_device_attr_write_longlong(const struct iio_device* dev, const char* attr, long long val) {
+    if (!dev || !attr) return -EINVAL;
+    sleep_us(dev->ctx->cfg.attr_latency_us);
+    const_cast<iio_device*>(dev)->attrs[attr] = std::to_string(val);
+    apply_attr(dev->ctx, nullptr, attr, val);
+    g_attr_writes.fetch_add(1);
+    return 0;
+}
+
+ssize_t iio_device_attr_write(const struct iio_device* dev, const char* attr, const char* src) {
+    if (!dev || !attr || !src) return -EINVAL;
+    sleep_us(dev->ctx->cfg.attr_latency_us);
+    const_cast<iio_device*>(dev)->attrs[attr] = src;
+    g_attr_writes.fetch_add(1);
+    return static_cast<ssize_t>(std::strlen(src) + 1);
+}
+
+int iio_channel_attr_write_longlong(const struct iio_channel* chn, const char* attr, long long val) {
+    if (!chn || !attr) return -EINVAL;
+    sleep_us(chn->dev->ctx->cfg.attr_latency_us);
+    const_cast<iio_channel*>(chn)->attrs[attr] = std::to_string(val);
+    apply_attr(chn->dev->ctx, chn, attr, val);
+    g_attr_writes.fetch_add(1);
+    return 0;
+}
+
+ssize_t iio_channel_attr_write(const struct iio_channel* chn, const char* attr, const char* src) {
+    if (!chn || !attr || !src) return -EINVAL;
+    sleep_us(chn->dev->ctx->cfg.attr_latency_us);
+    const_cast<iio_channel*>(chn)->attrs[attr] = src;
+    g_attr_writes.fetch_add(1);
+    return static_cast<ssize_t>(std::strlen(src) + 1);
+}
+
+void iio_channel_enable(struct iio_channel* chn)  { if (chn) chn->enabled = true;  }
+void iio_channel_disable(struct iio_channel* chn) { if (chn) chn->enabled = false; }
+
+struct iio_buffer* iio_device_create_buffer(const struct iio_device* dev, size_t samples_count, bool cyclic) {
+    if (!dev || samples_count == 0) { errno = EINVAL; return nullptr; }
+    auto* b = new iio_buffer();
+    b->dev     = const_cast<iio_device*>(dev);
+    b->samples = samples_count;
+    b->cyclic  = cyclic;
+    b->output  = (dev->name == "cf-ad9361-dds-core-lpc");
+    b->data.assign(samples_count * 2, 0);
+    if (b->output) b->spare.assign(samples_count * 2, 0);
+    b->phase.assign(dev->ctx->cfg.tones.size(), 0.0);
+
+    // Yeni RX tamponu: kernel kuyruğu boş, LO hemen geçerli
+    if (!b->output) {
+        std::lock_guard<std::mutex> lk(dev->ctx->m);
+        dev->ctx->eff_lo_hz = dev->ctx->lo_hz;
+        dev->ctx->lo_lag = 0;
+    }
+    g_buffers.fetch_add(1);
+    return b;
+}
+
+// Gerçek zamanlı tempo: iptal edilebilir bekleme
+static bool pace(struct iio_buffer* buf, int64_t samp_hz) {
+    using clock = std::chrono::steady_clock;
+    if (!buf->started) { buf->t0 = clock::now(); buf->started = true; }
+    const auto due = buf->t0 + std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(buf->pos + buf->samples) / static_cast<double>(samp_hz)));
+    while (clock::now() < due) {
+        if (buf->cancelled.load()) return false;
+        std::this_thread::sleep_until(std::min(due, clock::now() + std::chrono::milliseconds(10)));
+    }
+    return true;
+}
+
+ssize_t iio_buffer_refill(struct iio_buffer* buf) {
+    if (!buf || buf->output) return -EINVAL;
+    if (buf->cancelled.load()) return -EBADF;
+    iio_context* ctx = buf->dev->ctx;
+    const MockIioConfig& cfg = ctx->cfg;
+
+    const uint64_t n_refill = g_refills.fetch_add(1) + 1;
+    if (cfg.fail_after > 0 && n_refill > cfg.fail_after) { g_refill_fail.fetch_add(1); return -EIO; }
+
+    int64_t lo, samp, rfbw;
+    int gain;
+    double u;
+    size_t noff;
+    {
+        std::lock_guard<std::mutex> lk(ctx->m);
+        if (ctx->lo_lag > 0) --ctx->lo_lag;          // eski LO ile dolmuş tampon
+        else ctx->eff_lo_hz = ctx->lo_hz;
+        lo = ctx->eff_lo_hz; samp = ctx->samp_hz; rfbw = ctx->rfbw_hz; gain = ctx->gain_db;
+        u = std::uniform_real_distribution<double>(0.0, 1.0)(ctx->rng);
+        noff = static_cast<size_t>(ctx->rng()) & (kNoiseLen - 1);
+    }
+    if (cfg.fail_prob > 0.0 && u < cfg.fail_prob) { g_refill_fail.fetch_add(1); return -ETIMEDOUT; }
+
+    sleep_us(cfg.latency_us);
+    if (cfg.realtime && !pace(buf, samp)) return -EBADF;
+
+    // Üretim: gürültü + bantta kalan tonlar; kazanç dB olarak ölçekler
+    const double fs    = 32767.0;
+    const double g     = std::pow(10.0, gain / 20.0);
+    const float  namp  = static_cast<float>(fs * g * std::pow(10.0, cfg.noise_dbfs / 20.0));
+    std::vector<std::complex<float>> acc(buf->samples);
+    for (size_t i = 0; i < buf->samples; ++i) acc[i] = ctx->noise[(noff + i) & (kNoiseLen - 1)] * namp;
+
+    for (size_t t = 0; t < cfg.tones.size(); ++t) {
+        const MockTone& tn = cfg.tones[t];
+        const double off = tn.hz - static_cast<double>(lo);
+        if (std::fabs(off) >= 0.5 * static_cast<double>(samp)) continue;
+        double amp = fs * g * std::pow(10.0, tn.dbfs / 20.0);
+        if (std::fabs(off) > 0.5 * static_cast<double>(rfbw)) amp *= 0.03; // ~-30 dB analog filtre
+
+        const double w = 2.0 * M_PI * off / static_cast<double>(samp);
+        const double ms_per_s = 1000.0 / static_cast<double>(samp);
+        const bool   pulsed = tn.on_ms > 0.0 && tn.period_ms > 0.0;
+        double ph = buf->phase[t];
+        for (size_t i = 0; i < buf->samples; ++i, ph += w) {
+            const double tms = static_cast<double>(buf->pos + i) * ms_per_s - tn.start_ms;
+            if (tms < 0.0) continue;
+            if (pulsed && std::fmod(tms, tn.period_ms) >= tn.on_ms) continue;
+            acc[i] += std::complex<float>(static_cast<float>(amp * std::cos(ph)), static_cast<float>(amp * std::sin(ph)));
+        }
+        buf->phase[t] = std::fmod(ph, 2.0 * M_PI);
+    }
+
+    int16_t* d = buf->data.data();
+    for (size_t i = 0; i < buf->samples; ++i) {
+        d[2 * i + 0] = static_cast<int16_t>(std::clamp(std::lround(acc[i].real()), -32768L, 32767L));
+        d[2 * i + 1] = static_cast<int16_t>(std::clamp(std::lround(acc[i].imag()), -32768L, 32767L));
+    }
+    buf->pos += buf->samples;
+    g_samples.fetch_add(buf->samples);
+    return static_cast<ssize_t>(buf->data.size() * sizeof(int16_t));
+}
+
+// TX kuyruk modeli: DMA ilk push'tan itibaren örnek hızında tüketir; kernel_buffers
+// dolu iken push bekler, tüketim pushlanandan öne geçerse underrun sayılır ve
+// zaman çizgisi sıfırlanır (gerçek donanımda DAC sıfır/son örneği tekrarlar).
+static bool tx_pace(struct iio_buffer* buf, int64_t samp_hz) {
+    using clock = std::chrono::steady_clock;
+    const auto now = clock::now();
+    const double fs = static_cast<double>(samp_hz);
+    if (!buf->started) { buf->t0 = now; buf->started = true; buf->pos = 0; return true; }
+    const double consumed = std::chrono::duration<double>(now - buf->t0).count() * fs;
+    if (consumed > static_cast<double>(buf->pos)) {
+        g_tx_underruns.fetch_add(1);
+        buf->t0 = now;
+        buf->pos = 0;
+        return true;
+    }
+    const double room = static_cast<double>(buf->dev->kernel_buffers) * static_cast<double>(buf->samples);
+    const auto due = buf->t0 + std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>((static_cast<double>(buf->pos + buf->samples) - room) / fs));
+    while (clock::now() < due) {
+        if (buf->cancelled.load()) return false;
+        std::this_thread::sleep_until(std::min(due, clock::now() + std::chrono::milliseconds(10)));
+    }
+    return true;
+}
+
+ssize_t iio_buffer_push(struct iio_buffer* buf) {
+    if (!buf || !buf->output) return -EINVAL;
+    if (buf->cancelled.load()) return -EBADF;
+    const MockIioConfig& cfg = buf->dev->ctx->cfg;
+    int64_t samp;
+    { std::lock_guard<std::mutex> lk(buf->dev->ctx->m); samp = buf->dev->ctx->samp_hz; }
+    sleep_us(cfg.latency_us);
+    if (cfg.realtime && !tx_pace(buf, samp)) return -EBADF;
+
+    // Özet: örnek başına 32 bit kelime üzerinden FNV-1a (tek push thread'i varsayılır)
+    uint64_t h = g_tx_sum.load(std::memory_order_relaxed);
+    const uint16_t* w = reinterpret_cast<const uint16_t*>(buf->data.data());
+    for (size_t i = 0; i < buf->samples; ++i) {
+        h ^= static_cast<uint64_t>(w[2 * i]) | (static_cast<uint64_t>(w[2 * i + 1]) << 16);
+        h *= 0x100000001b3ull;
+    }
+    g_tx_sum.store(h, std::memory_order_relaxed);
+
+    // Gerçek libiio (mmap) gibi push sonrası başka blok verilir: iio_buffer_start yeniden alınmalı
+    buf->data.swap(buf->spare);
+    buf->pos += buf->samples;
+    g_tx_samples.fetch_add(buf->samples);
+    g_pushes.fetch_add(1);
+    return static_cast<ssize_t>(buf->spare.size() * sizeof(int16_t));
+}
+
+// Mock her zaman I/Q serpiştirilmiş cs16 verir (adım 4 bayt)
+void* iio_buffer_start(const struct iio_buffer* buf) {
+    return buf ? const_cast<int16_t*>(buf->data.data()) : nullptr;
+}
+void* iio_buffer_end(const struct iio_buffer* buf) {
+    return buf ? const_cast<int16_t*>(buf->data.data() + buf->data.size()) : nullptr;
+}
+ptrdiff_t iio_buffer_step(const struct iio_buffer* buf) {
+    return buf ? static_cast<ptrdiff_t>(2 * sizeof(int16_t)) : 0;
+}
+
+void iio_buffer_cancel(struct iio_buffer* buf) {
+    if (!buf) return;
+    buf->cancelled.store(true);
+    g_cancels.fetch_add(1);
+}
+
+void iio_buffer_destroy(struct iio_buffer* buf) { delete buf; }
+
+} // extern "C"
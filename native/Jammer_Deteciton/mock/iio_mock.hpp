@@ -0,0 +1,60 @@
+// mock/iio_mock.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jd {
+namespace mock {
+
+// Sabit ya da darbeli ton (mutlak RF frekansı; LO'ya göre banda düşerse görünür)
+struct MockTone {
+    double hz       = 2402500000.0;
+    double dbfs     = -20.0;   // 0 dBFS = tam ölçek cs16
+    double on_ms    = 0.0;     // 0: sürekli
+    double period_ms= 0.0;     // darbe periyodu (on_ms > 0 iken)
+    double start_ms = 0.0;     // ilk görünme anı (örnek zamanında)
+};
+
+// Sahte ad9361 davranışı. JD_MOCK_IIO ortam değişkeni ile de verilebilir:
+//   JD_MOCK_IIO="noise=-60,tone=2402500000:-20,burst=2410000000:-10:50:200,latency_us=200"
+struct MockIioConfig {
+    double   noise_dbfs   = -60.0;
+    std::vector<MockTone> tones;
+    bool     realtime     = false;  // refill'i örnek hızına göre bekletir
+    int      latency_us   = 0;      // her refill'e eklenen gecikme
+    int      attr_latency_us = 0;   // her attribute yazımına eklenen gecikme
+    uint64_t fail_after   = 0;      // N refill sonra -EIO (0: kapalı)
+    double   fail_prob    = 0.0;    // refill başına rastgele hata olasılığı
+    bool     fail_context = false;  // context oluşturma başarısız
+    uint32_t seed         = 1;
+};
+
+struct MockIioStats {
+    uint64_t refills     = 0;
+    uint64_t refill_fail = 0;
+    uint64_t pushes      = 0;
+    uint64_t attr_writes = 0;
+    uint64_t samples     = 0;
+    uint64_t buffers_created = 0;
+    uint64_t cancels     = 0;
+    uint64_t tx_samples  = 0;
+    uint64_t tx_underruns = 0;     // realtime: push gelmeden DMA kuyruğu boşaldı
+    uint64_t tx_checksum = 0;      // gönderilen cs16 örneklerin FNV-1a özeti (sırayla)
+    int64_t  lo_hz       = 0;      // son yazılan RX LO
+    int64_t  tx_lo_hz    = 0;      // son yazılan TX LO
+    int64_t  samp_hz     = 0;
+    int      gain_db     = 0;
+    bool     context_open = false;
+};
+
+// Sonraki context'ler için yapılandırma (JD_MOCK_IIO'yu geçersiz kılar)
+void configure(const MockIioConfig& cfg);
+// "key=val,..." biçimini ayrıştırır; bilinmeyen anahtar -> false
+bool parse_config(const std::string& spec, MockIioConfig& out);
+
+MockIioStats stats();
+void reset_stats();
+
+} // namespace mock
+} // namespace jd
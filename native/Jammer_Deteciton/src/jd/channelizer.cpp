@@ -0,0 +1,345 @@
+// jd/channelizer.cpp
+#include "jd/channelizer.hpp"
+#include "jd/metrics.hpp"
+#include "jd/logger.hpp"
+#include "jd/event_ring.hpp"
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <algorithm>
+
+// AVX2/FMA çekirdekleri target özniteliğiyle derlenir ve çalışma anında CPU'ya göre
+// seçilir (Ofdm_Modem BatchFft gibi); -march=native gerekmez.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #include <immintrin.h>
+  #define JD_CHZ_X86 1
+#else
+  #define JD_CHZ_X86 0
+#endif
+
+namespace jd {
+
+// y += h * x (re/im ayrık)
+static void mac_scalar(float* yr, float* yi, const float* h, const float* xr, const float* xi, int n) {
+    for (int p = 0; p < n; ++p) {
+        yr[p] += h[p] * xr[p];
+        yi[p] += h[p] * xi[p];
+    }
+}
+// acc += |y|^2
+static void pow_scalar(float* acc, const float* yr, const float* yi, int n) {
+    for (int k = 0; k < n; ++k) acc[k] += yr[k] * yr[k] + yi[k] * yi[k];
+}
+
+#if JD_CHZ_X86
+__attribute__((target("avx2,fma")))
+static void mac_avx2(float* yr, float* yi, const float* h, const float* xr, const float* xi, int n) {
+    int p = 0;
+    for (; p + 8 <= n; p += 8) {
+        const __m256 hv = _mm256_loadu_ps(h + p);
+        _mm256_storeu_ps(yr + p, _mm256_fmadd_ps(hv, _mm256_loadu_ps(xr + p), _mm256_loadu_ps(yr + p)));
+        _mm256_storeu_ps(yi + p, _mm256_fmadd_ps(hv, _mm256_loadu_ps(xi + p), _mm256_loadu_ps(yi + p)));
+    }
+    for (; p < n; ++p) {
+        yr[p] += h[p] * xr[p];
+        yi[p] += h[p] * xi[p];
+    }
+}
+__attribute__((target("avx2,fma")))
+static void pow_avx2(float* acc, const float* yr, const float* yi, int n) {
+    int k = 0;
+    for (; k + 8 <= n; k += 8) {
+        const __m256 r = _mm256_loadu_ps(yr + k);
+        const __m256 i = _mm256_loadu_ps(yi + k);
+        _mm256_storeu_ps(acc + k, _mm256_fmadd_ps(r, r, _mm256_fmadd_ps(i, i, _mm256_loadu_ps(acc + k))));
+    }
+    for (; k < n; ++k) acc[k] += yr[k] * yr[k] + yi[k] * yi[k];
+}
+static bool cpu_has_avx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+#endif
+
+static int ilog2_exact(int n) {
+    int l = 0;
+    while ((1 << l) < n) ++l;
+    return ((1 << l) == n) ? l : -1;
+}
+
+Channelizer::Channelizer(const ChannelizerConfig& cfg) : cfg_(cfg) {
+    M_ = cfg_.num_channels;
+    log2M_ = ilog2_exact(M_);
+    if (M_ < 2 || log2M_ < 0) { // 2'nin kuvvetine yuvarla
+        log2M_ = 1;
+        while ((1 << log2M_) < std::max(2, M_)) ++log2M_;
+        M_ = 1 << log2M_;
+    }
+    P_ = std::max(1, cfg_.taps_per_branch);
+
+    // Prototip alçak geçiren: Blackman pencereli sinc, DC kazancı 1
+    const int L = M_ * P_;
+    const double fc = std::clamp(cfg_.cutoff_scale, 0.1, 2.0) / (2.0 * M_); // normalize (cycles/sample)
+    std::vector<double> proto(L);
+    double sum = 0.0;
+    for (int n = 0; n < L; ++n) {
+        const double t = n - 0.5 * (L - 1);
+        const double sinc = (t == 0.0) ? 2.0 * fc : std::sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        const double w = 0.42 - 0.5 * std::cos(2.0 * M_PI * n / (L - 1))
+                              + 0.08 * std::cos(4.0 * M_PI * n / (L - 1));
+        proto[n] = sinc * w;
+        sum += proto[n];
+    }
+    h_.resize(L);
+    for (int n = 0; n < L; ++n) h_[n] = static_cast<float>(proto[n] / sum);
+
+    dl_re_.assign(static_cast<size_t>(L), 0.0f);
+    dl_im_.assign(static_cast<size_t>(L), 0.0f);
+
+    // FFT: ters yönlü (pozitif üs) twiddle'lar
+    tw_re_.resize(M_ / 2);
+    tw_im_.resize(M_ / 2);
+    for (int k = 0; k < M_ / 2; ++k) {
+        tw_re_[k] = static_cast<float>(std::cos(2.0 * M_PI * k / M_));
+        tw_im_[k] = static_cast<float>(std::sin(2.0 * M_PI * k / M_));
+    }
+    bitrev_.resize(M_);
+    for (int i = 0; i < M_; ++i) {
+        uint32_t r = 0;
+        for (int b = 0; b < log2M_; ++b) if (i & (1 << b)) r |= 1u << (log2M_ - 1 - b);
+        bitrev_[i] = r;
+    }
+
+    y_re_.resize(M_);
+    y_im_.resize(M_);
+    acc_.assign(M_, 0.0f);
+    pending_.reserve(M_);
+
+    mac_ = mac_scalar;
+    pow_ = pow_scalar;
+#if JD_CHZ_X86
+    if (cpu_has_avx2()) { mac_ = mac_avx2; pow_ = pow_avx2; avx2_ = true; }
+#endif
+}
+
+void Channelizer::reset() {
+    std::fill(dl_re_.begin(), dl_re_.end(), 0.0f);
+    std::fill(dl_im_.begin(), dl_im_.end(), 0.0f);
+    std::fill(acc_.begin(), acc_.end(), 0.0f);
+    head_ = 0;
+    pending_.clear();
+}
+
+void Channelizer::fft_inplace(float* re, float* im) const {
+    for (int i = 0; i < M_; ++i) {
+        const uint32_t j = bitrev_[i];
+        if (j > static_cast<uint32_t>(i)) { std::swap(re[i], re[j]); std::swap(im[i], im[j]); }
+    }
+    for (int len = 2; len <= M_; len <<= 1) {
+        const int half = len >> 1;
+        const int step = M_ / len;
+        for (int i = 0; i < M_; i += len) {
+            for (int k = 0; k < half; ++k) {
+                const float wr = tw_re_[k * step], wi = tw_im_[k * step];
+                const int a = i + k, b = a + half;
+                const float tr = re[b] * wr - im[b] * wi;
+                const float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr; im[b] = im[a] - ti;
+                re[a] += tr;        im[a] += ti;
+            }
+        }
+    }
+}
+
+void Channelizer::push_block(const std::complex<float>* x) {
+    // Komütatör: blok[p] = x[M-1-p]; en yeni blok head_ konumuna yazılır
+    float* br = dl_re_.data() + static_cast<size_t>(head_) * M_;
+    float* bi = dl_im_.data() + static_cast<size_t>(head_) * M_;
+    for (int p = 0; p < M_; ++p) {
+        br[p] = x[M_ - 1 - p].real();
+        bi[p] = x[M_ - 1 - p].imag();
+    }
+
+    // Dal filtreleri: y[p] = sum_k h[k*M+p] * blok_{n-k}[p]  (p ekseninde vektörel)
+    float* yr = y_re_.data();
+    float* yi = y_im_.data();
+    std::fill(y_re_.begin(), y_re_.end(), 0.0f);
+    std::fill(y_im_.begin(), y_im_.end(), 0.0f);
+    for (int k = 0; k < P_; ++k) {
+        const int slot = (head_ - k + P_) % P_;
+        const float* hk = h_.data() + static_cast<size_t>(k) * M_;
+        const float* xr = dl_re_.data() + static_cast<size_t>(slot) * M_;
+        const float* xi = dl_im_.data() + static_cast<size_t>(slot) * M_;
+        mac_(yr, yi, hk, xr, xi, M_);
+    }
+    head_ = (head_ + 1) % P_;
+
+    fft_inplace(yr, yi);
+
+    // Kanal güç birikimi
+    pow_(acc_.data(), yr, yi, M_);
+}
+
+int Channelizer::process(const std::vector<std::complex<float>>& frame, std::vector<double>& out_dbm) {
+    std::fill(acc_.begin(), acc_.end(), 0.0f);
+    int blocks = 0;
+    size_t i = 0;
+
+    // Önceki frame'den kalanları tamamla
+    if (!pending_.empty()) {
+        while (pending_.size() < static_cast<size_t>(M_) && i < frame.size()) pending_.push_back(frame[i++]);
+        if (pending_.size() == static_cast<size_t>(M_)) {
+            push_block(pending_.data());
+            pending_.clear();
+            ++blocks;
+        }
+    }
+    for (; i + M_ <= frame.size(); i += M_) {
+        push_block(frame.data() + i);
+        ++blocks;
+    }
+    for (; i < frame.size(); ++i) pending_.push_back(frame[i]);
+
+    out_dbm.resize(M_);
+    for (int k = 0; k < M_; ++k) {
+        const double mean_watt = blocks > 0 ? std::max(static_cast<double>(acc_[k]) / blocks, cfg_.floor_watt)
+                                            : cfg_.floor_watt;
+        out_dbm[k] = 10.0 * std::log10(mean_watt) + 30.0 + cfg_.calib_db;
+    }
+    return blocks;
+}
+
+// ------------------------------------------------------------
+// Kanal merkezi bin merkezinden en çok aralığın bu kesri kadar sapabilir
+static constexpr double kBinTolerance = 0.1;
+
+ChannelBank::ChannelBank(Channelizer& chz, const ChannelPlan& plan, int jammer_consecutive)
+    : chz_(chz), consec_(std::max(1, jammer_consecutive)) {
+    const int M = chz_.num_channels();
+    const double spacing = static_cast<double>(plan.samp_hz) / M;
+    for (uint64_t hz : plan.channels_hz) {
+        const double off = static_cast<double>(hz) - static_cast<double>(plan.center_hz);
+        if (std::fabs(off) > 0.5 * static_cast<double>(plan.samp_hz)) {
+            std::fprintf(stderr, "[CHZ] %llu Hz yakalama bandı dışında, atlandı.\n",
+                         static_cast<unsigned long long>(hz));
+            continue;
+        }
+        const long nearest = std::lround(off / spacing);
+        const double err = std::fabs(off - static_cast<double>(nearest) * spacing);
+        if (err > kBinTolerance * spacing) {
+            std::fprintf(stderr, "[CHZ] %llu Hz kanal ızgarasında değil (en yakın bin %.0f Hz uzakta, aralık %.0f Hz), atlandı.\n",
+                         static_cast<unsigned long long>(hz), err, spacing);
+            continue;
+        }
+        const int bin = static_cast<int>(((nearest % M) + M) % M);
+        const auto dup = std::find_if(ch_.begin(), ch_.end(), [bin](const ChannelState& c) { return c.bin == bin; });
+        if (dup != ch_.end()) {
+            std::fprintf(stderr, "[CHZ] %llu Hz, %llu Hz ile aynı bine (%d) düşüyor, atlandı.\n",
+                         static_cast<unsigned long long>(hz), static_cast<unsigned long long>(dup->hz), bin);
+            continue;
+        }
+        ChannelState st;
+        st.hz  = hz;
+        st.bin = bin;
+        ch_.push_back(st);
+    }
+}
+
+bool ChannelBank::calibrate(ISource& src, const GmmThreshold& gmm, double target_seconds, bool verbose) {
+    if (ch_.empty()) return false;
+    using clock = std::chrono::steady_clock;
+    std::vector<std::vector<double>> hist(ch_.size());
+    std::vector<std::complex<float>> frame;
+
+    chz_.reset();
+    const auto t0 = clock::now();
+    const double Tgoal = std::max(0.1, target_seconds);
+    while (std::chrono::duration<double>(clock::now() - t0).count() < Tgoal) {
+        if (!src.get_frame(frame)) break;
+        if (src.last_frame_stale()) continue;
+        if (chz_.process(frame, bin_dbm_) == 0) continue;
+        for (size_t c = 0; c < ch_.size(); ++c) hist[c].push_back(bin_dbm_[ch_[c].bin]);
+    }
+
+    bool all_ok = true;
+    for (size_t c = 0; c < ch_.size(); ++c) {
+        auto g = gmm.fit(hist[c]);
+        if (!g) { all_ok = false; continue; }
+        ch_[c].threshold_dbm = g->threshold;
+        if (verbose)
+            std::printf("[CHZ] ch %llu Hz (bin %d): mu_low=%.2f mu_high=%.2f threshold=%.2f dBm (n=%d)\n",
+                        static_cast<unsigned long long>(ch_[c].hz), ch_[c].bin,
+                        g->mu_low, g->mu_high, g->threshold, g->n_used);
+    }
+    return all_ok;
+}
+
+int ChannelBank::update(const std::vector<std::complex<float>>& frame) {
+    if (chz_.process(frame, bin_dbm_) == 0) return 0;
+    int changed = 0;
+    for (auto& c : ch_) {
+        c.power_dbm = bin_dbm_[c.bin];
+        const bool was = c.jammed;
+        if (c.power_dbm > c.threshold_dbm) {
+            if (c.jam_cnt < consec_) ++c.jam_cnt;
+            if (c.jam_cnt >= consec_) c.jammed = true;
+        } else {
+            c.jam_cnt = 0;
+            c.jammed  = false;
+        }
+        c.changed = (was != c.jammed);
+        if (c.changed) ++changed;
+    }
+    return changed;
+}
+
+bool ChannelBank::any_jammed() const {
+    for (const auto& c : ch_) if (c.jammed) return true;
+    return false;
+}
+
+// ------------------------------------------------------------
+DetectOutcome ChannelDetector::run() {
+    std::vector<std::complex<float>> frame;
+    HotPathMetrics& hm = hot_metrics();
+    AsyncLogger&    lg = logger();
+    for (int idx = 1; idx <= cfg_.max_frames; ++idx) {
+        if (cfg_.stop && cfg_.stop->load(std::memory_order_acquire)) break;
+        const uint64_t t0 = now_ns();
+        if (!src_.get_frame(frame)) {
+            lg.text(LogLevel::Warn, "Source exhausted/error.");
+            return DetectOutcome::SourceEnded;
+        }
+        if (src_.last_frame_stale()) continue;   // eski frekanstan kalan tampon
+        const uint64_t t1 = now_ns();
+        const int changed = bank_.update(frame);
+        const uint64_t t2 = now_ns();
+        hm.record(Stage::Power, t2 - t1);
+        hm.frames.fetch_add(1, std::memory_order_relaxed);
+        if (bank_.any_jammed()) hm.jammed_frames.fetch_add(1, std::memory_order_relaxed);
+        if (changed == 0) {
+            hm.record(Stage::Frame, t2 - t0);
+            continue;
+        }
+
+        // Yalnız durum değişimlerini yaz
+        for (const auto& c : bank_.channels()) {
+            if (!c.changed) continue;
+            lg.text(LogLevel::Info, "Frame %d - ch %llu Hz %s (%.2f dBm / thr %.2f)",
+                    idx, static_cast<unsigned long long>(c.hz),
+                    c.jammed ? "JAMMER" : "Normal", c.power_dbm, c.threshold_dbm);
+            events().channel(c.hz, static_cast<uint64_t>(idx), c.power_dbm, c.threshold_dbm, c.jammed);
+        }
+        const uint64_t t3 = now_ns();
+        hm.record(Stage::Decide, t3 - t2);
+        hm.record(Stage::Frame,  t3 - t0);
+        if (bank_.any_jammed()) {
+            lg.text(LogLevel::Info, "Continuous JAMMER detected on channelized band - exiting.");
+            return DetectOutcome::SustainedJammer;
+        }
+    }
+    lg.text(LogLevel::Info, "Scan completed; continuous jammer threshold not reached.");
+    return DetectOutcome::CompletedNoSustain;
+}
+
+} // namespace jd
@@ -0,0 +1,201 @@
+// jd/control_plane.cpp
+#include "jd/control_plane.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+  #include <winsock2.h>
+  #include <ws2tcpip.h>
+  #pragma comment(lib, "Ws2_32.lib")
+  static bool g_wsastarted=false;
+  static void wsainit(){ if(!g_wsastarted){ WSADATA w; WSAStartup(MAKEWORD(2,2), &w); g_wsastarted=true; } }
+  static void set_nonblock(SOCKET s){ u_long m=1; ioctlsocket(s, FIONBIO, &m); }
+  static void closesock(uintptr_t s){ if(s!=(uintptr_t)INVALID_SOCKET) ::closesocket((SOCKET)s); }
+  static int  poll_fds(WSAPOLLFD* f, ULONG n, int ms){ return ::WSAPoll(f, n, ms); }
+  using pollfd_t = WSAPOLLFD;
+  using socklen_t = int;
+  static constexpr uintptr_t BAD = (uintptr_t)INVALID_SOCKET;
+#else
+  #include <unistd.h>
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <arpa/inet.h>
+  #include <sys/socket.h>
+  static void set_nonblock(int s){ int fl=fcntl(s,F_GETFL,0); fcntl(s,F_SETFL, fl|O_NONBLOCK); }
+  static void closesock(int s){ if(s>=0) ::close(s); }
+  static int  poll_fds(pollfd* f, nfds_t n, int ms){ return ::poll(f, n, ms); }
+  using pollfd_t = pollfd;
+  static constexpr int BAD = -1;
+#endif
+
+namespace jd {
+
+ControlPlane::ControlPlane(std::atomic<bool>& stop_flag, uint16_t port)
+  : stop_(stop_flag), port_(port) {}
+
+ControlPlane::~ControlPlane() { stop(); }
+
+void ControlPlane::on(const std::string& cmd, Handler h) {
+    std::string k = cmd;
+    for (auto& c : k) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    handlers_[k] = std::move(h);
+}
+
+bool ControlPlane::start() {
+#ifdef _WIN32
+    wsainit();
+    // Windows'ta select/poll pipe bekleyemez: loopback UDP çifti self-pipe görevi görür
+    wake_rx_ = (uintptr_t)::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    wake_tx_ = (uintptr_t)::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (wake_rx_ != BAD && wake_tx_ != BAD) {
+        sockaddr_in wa{};
+        wa.sin_family = AF_INET;
+        wa.sin_port   = 0;
+        wa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        int wl = sizeof(wa);
+        if (::bind((SOCKET)wake_rx_, (sockaddr*)&wa, sizeof(wa)) != 0 ||
+            ::getsockname((SOCKET)wake_rx_, (sockaddr*)&wa, &wl) != 0 ||
+            ::connect((SOCKET)wake_tx_, (sockaddr*)&wa, sizeof(wa)) != 0) {
+            closesock(wake_rx_); closesock(wake_tx_); wake_rx_ = wake_tx_ = BAD;
+        } else {
+            set_nonblock((SOCKET)wake_rx_);
+            set_nonblock((SOCKET)wake_tx_);
+        }
+    }
+#else
+    int p[2];
+    if (::pipe(p) == 0) {
+        wake_rx_ = p[0]; wake_tx_ = p[1];
+        set_nonblock(wake_rx_);
+        set_nonblock(wake_tx_);
+    }
+#endif
+
+    sock_ = (decltype(sock_))::socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock_ != BAD) {
+        sockaddr_in sa{};
+        sa.sin_family = AF_INET;
+        sa.sin_port   = htons(port_);
+        sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK); // 127.0.0.1
+        if (::bind(sock_, (sockaddr*)&sa, sizeof(sa)) != 0) {
+            closesock(sock_); sock_ = BAD;
+        } else {
+            set_nonblock(sock_);
+        }
+    }
+    listening_ = (sock_ != BAD);
+
+    quit_.store(false, std::memory_order_release);
+    th_ = std::thread([this]{ loop(); });
+    return listening_;
+}
+
+void ControlPlane::stop() {
+    quit_.store(true, std::memory_order_release);
+    wake();
+    if (th_.joinable()) th_.join();
+    closesock(sock_);    sock_    = BAD;
+    closesock(wake_rx_); wake_rx_ = BAD;
+    closesock(wake_tx_); wake_tx_ = BAD;
+    wcv_.notify_all();
+}
+
+void ControlPlane::wake() {
+    if (wake_tx_ == BAD) return;
+    const char b = 1;
+#ifdef _WIN32
+    ::send((SOCKET)wake_tx_, &b, 1, 0);
+#else
+    // Tam pipe (EAGAIN) zaten bekleyen bir uyandırma demektir
+    ssize_t w = ::write(wake_tx_, &b, 1);
+    (void)w;
+#endif
+}
+
+void ControlPlane::notify_signal() { wake(); }
+
+void ControlPlane::request_stop() {
+    stop_.store(true, std::memory_order_release);
+    { std::lock_guard<std::mutex> lk(wm_); }
+    wcv_.notify_all();
+    wake();
+}
+
+void ControlPlane::wait_stop() {
+    std::unique_lock<std::mutex> lk(wm_);
+    wcv_.wait(lk, [this]{
+        return stop_.load(std::memory_order_acquire) || !th_.joinable();
+    });
+}
+
+void ControlPlane::handle_datagram(const char* buf, int n, const void* from, int flen) {
+    // İlk kelime komut (büyük harfe çevrilir), kalanı argüman
+    int i = 0;
+    while (i < n && std::isspace(static_cast<unsigned char>(buf[i]))) ++i;
+    int j = i;
+    while (j < n && !std::isspace(static_cast<unsigned char>(buf[j]))) ++j;
+    std::string cmd(buf + i, buf + j);
+    for (auto& c : cmd) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    while (j < n && std::isspace(static_cast<unsigned char>(buf[j]))) ++j;
+    int k = n;
+    while (k > j && std::isspace(static_cast<unsigned char>(buf[k-1]))) --k;
+    const std::string args(buf + j, buf + k);
+
+    std::string reply;
+    if (cmd == "STOP" || cmd == "EXIT" || cmd == "QUIT") {
+        std::printf("[CTRL] STOP komutu alindi.\n");
+        std::fflush(stdout);
+        request_stop();
+        reply = "OK";
+    } else if (cmd == "PING") {
+        reply = "PONG";
+    } else {
+        auto it = handlers_.find(cmd);
+        reply = (it != handlers_.end()) ? it->second(args) : "ERR unknown command";
+    }
+    if (!reply.empty())
+        ::sendto(sock_, reply.data(), (int)reply.size(), 0,
+                 static_cast<const sockaddr*>(from), (socklen_t)flen);
+}
+
+void ControlPlane::loop() {
+    char buf[512];
+
+    while (!quit_.load(std::memory_order_acquire)) {
+        pollfd_t fds[2];
+        int nf = 0, si = -1, wi = -1;
+        if (sock_ != BAD)    { fds[nf] = {}; fds[nf].fd = sock_;    fds[nf].events = POLLIN; si = nf++; }
+        if (wake_rx_ != BAD) { fds[nf] = {}; fds[nf].fd = wake_rx_; fds[nf].events = POLLIN; wi = nf++; }
+
+        const int pr = (nf > 0) ? poll_fds(fds, nf, -1) : 0;
+        if (nf == 0) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        if (pr > 0 && wi >= 0 && (fds[wi].revents & POLLIN)) {
+            char tmp[64];
+#ifdef _WIN32
+            while (::recv((SOCKET)wake_rx_, tmp, sizeof(tmp), 0) > 0) {}
+#else
+            while (::read(wake_rx_, tmp, sizeof(tmp)) > 0) {}
+#endif
+        }
+        if (pr > 0 && si >= 0 && (fds[si].revents & POLLIN)) {
+            for (;;) {
+                sockaddr_in from{}; socklen_t flen = sizeof(from);
+                const int n = (int)::recvfrom(sock_, buf, (int)sizeof(buf) - 1, 0, (sockaddr*)&from, &flen);
+                if (n <= 0) break;
+                buf[n] = 0;
+                handle_datagram(buf, n, &from, (int)flen);
+            }
+        }
+
+        // Sinyal yolu yalnız bayrağı kaldırıp pipe'a yazar; bekleyenleri burada uyandır
+        if (stop_.load(std::memory_order_acquire)) {
+            { std::lock_guard<std::mutex> lk(wm_); }
+            wcv_.notify_all();
+        }
+    }
+}
+
+} // namespace jd
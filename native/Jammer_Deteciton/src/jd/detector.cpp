@@ -1,5 +1,8 @@
 #include "jd/detector.hpp"
-#include <cstdio>
+#include "jd/metrics.hpp"
+#include "jd/logger.hpp"
+#include "jd/event_ring.hpp"
+#include "jd/telemetry.hpp"
 
 namespace jd {
 
@@ -7,29 +10,54 @@ DetectOutcome Detector::run() {
     std::vector<std::complex<float>> frame;
     int jam_cnt = 0;
 
+    HotPathMetrics& hm = hot_metrics();
+    AsyncLogger&    lg = logger();
+    EventRing&      ev_ring = events();
+    Telemetry&      tm = telemetry();
+
     for (int idx=1; idx<=cfg_.max_frames; ++idx) {
+        if (cfg_.stop && cfg_.stop->load(std::memory_order_acquire)) break;
+        const uint64_t t0 = now_ns();
         if (!src_.get_frame(frame)) {
-            std::printf("Source exhausted/error.\n");
+            if (cfg_.verbose) lg.text(LogLevel::Warn, "Source exhausted/error.");
             return DetectOutcome::SourceEnded;
         }
+        if (src_.last_frame_stale()) continue;   // eski frekanstan kalan tampon
+        const uint64_t t1 = now_ns();
         const double pd = pm_.power_dbm(frame);
+        const uint64_t t2 = now_ns();
+        hm.record(Stage::Power, t2 - t1);
+        hm.frames.fetch_add(1, std::memory_order_relaxed);
+
+        // Frame başına log yok: yalnız durum geçişleri + periyodik güç özeti
+        const double thr = cfg_.live_threshold ? cfg_.live_threshold->load(std::memory_order_relaxed)
+                                               : cfg_.threshold_dbm;
+        const bool over = pd > thr;
+        if (cfg_.verbose) lg.power_sample(pd, over);
+        ev_ring.power(static_cast<uint64_t>(idx), pd, thr, over);
+        tm.frame(static_cast<uint64_t>(idx), pd, thr, over);
 
-        if (pd > cfg_.threshold_dbm) {
+        if (over) {
+            hm.jammed_frames.fetch_add(1, std::memory_order_relaxed);
             ++jam_cnt;
-            std::printf("Frame %d - JAMMER (%.2f dBm)  [count=%d/%d]\n",
-                        idx, pd, jam_cnt, cfg_.jammer_consecutive);
+            if (cfg_.verbose && (jam_cnt == 1 || jam_cnt >= cfg_.jammer_consecutive))
+                lg.frame_state(idx, pd, jam_cnt, cfg_.jammer_consecutive, true);
             if (jam_cnt >= cfg_.jammer_consecutive) {
-                std::printf("Continuous JAMMER detected - exiting.\n");
-                src_.release();
+                const uint64_t t3 = now_ns();
+                hm.record(Stage::Decide, t3 - t2);
+                hm.record(Stage::Frame,  t3 - t0);
+                if (cfg_.verbose) lg.text(LogLevel::Info, "Continuous JAMMER detected - exiting.");
                 return DetectOutcome::SustainedJammer;
             }
         } else {
+            if (cfg_.verbose && jam_cnt > 0) lg.frame_state(idx, pd, jam_cnt, cfg_.jammer_consecutive, false);
             jam_cnt = 0;
-            std::printf("Frame %d - Normal (%.2f dBm)\n", idx, pd);
         }
+        const uint64_t t3 = now_ns();
+        hm.record(Stage::Decide, t3 - t2);
+        hm.record(Stage::Frame,  t3 - t0);
     }
-    src_.release();
-    std::printf("Scan completed; continuous jammer threshold not reached.\n");
+    if (cfg_.verbose) lg.text(LogLevel::Info, "Scan completed; continuous jammer threshold not reached.");
     return DetectOutcome::CompletedNoSustain;
 }
 
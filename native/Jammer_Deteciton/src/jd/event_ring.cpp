@@ -0,0 +1,231 @@
+// jd/event_ring.cpp
+#include "jd/event_ring.hpp"
+#include "jd/metrics.hpp"   // now_ns
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <signal.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace jd {
+
+namespace {
+bool pid_alive(uint32_t pid) {
+    if (pid == 0) return false;
+#ifdef _WIN32
+    HANDLE h = ::OpenProcess(SYNCHRONIZE, FALSE, pid);
+    if (!h) return ::GetLastError() == ERROR_ACCESS_DENIED;
+    const bool alive = ::WaitForSingleObject(h, 0) == WAIT_TIMEOUT;
+    ::CloseHandle(h);
+    return alive;
+#else
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
+// Var olan segmentin başlığı geçerli ve yazarı hâlâ çalışıyorsa yazar pid'i, değilse 0
+uint32_t live_writer(const void* base) {
+    EventRingHeader h;
+    std::memcpy(&h, base, sizeof(h));
+    if (h.magic != kEventRingMagic) return 0;
+    return pid_alive(h.writer_pid) ? h.writer_pid : 0;
+}
+} // namespace
+
+EventRing& EventRing::instance() {
+    static EventRing r;
+    return r;
+}
+
+EventRing::~EventRing() { close(); }
+
+bool EventRing::open(const EventRingConfig& cfg) {
+    if (ok()) return true;
+    cfg_ = cfg;
+    uint32_t cap = 2;
+    while (cap < std::max<uint32_t>(cfg.capacity, 2)) cap <<= 1;
+    bytes_ = sizeof(EventRingHeader) + static_cast<size_t>(cap) * sizeof(EventRecord);
+
+    // Segment yalnız bu süreç oluşturduysa sıfırlanır/kaldırılır. Aynı adla çalışan
+    // başka bir yazar varsa açılış başarısız olur; yazarı ölmüş kalıntı yeniden kurulur.
+    void* base = nullptr;
+#ifdef _WIN32
+    map_ = ::CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                static_cast<DWORD>(static_cast<uint64_t>(bytes_) >> 32),
+                                static_cast<DWORD>(bytes_ & 0xFFFFFFFFu), cfg.name.c_str());
+    if (!map_) return false;
+    const bool existed = ::GetLastError() == ERROR_ALREADY_EXISTS;
+    if (existed) {
+        // Ad, bir okuyucu ya da yazar tutamacı açık tuttukça yaşar; boyut o ilk
+        // oluşturanın boyutudur, bu yüzden önce yalnız başlık eşlenir
+        const void* hv = ::MapViewOfFile(map_, FILE_MAP_READ, 0, 0, sizeof(EventRingHeader));
+        EventRingHeader h{};
+        if (hv) { std::memcpy(&h, hv, sizeof(h)); ::UnmapViewOfFile(hv); }
+        const uint32_t pid = hv ? live_writer(&h) : 0;
+        if (pid || h.magic != kEventRingMagic || h.capacity != cap) {
+            if (pid) std::fprintf(stderr, "[EVT] '%s' halkası pid %u tarafından kullanılıyor.\n", cfg.name.c_str(), pid);
+            ::CloseHandle(map_); map_ = nullptr;
+            return false;
+        }
+    }
+    base = ::MapViewOfFile(map_, FILE_MAP_ALL_ACCESS, 0, 0, bytes_);
+    if (!base) { ::CloseHandle(map_); map_ = nullptr; return false; }
+#else
+    const std::string shm = "/" + cfg.name;
+    fd_ = ::shm_open(shm.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd_ < 0 && errno == EEXIST) {
+        // Var olan segment: yazarı yaşıyorsa dokunma, ölmüşse (önceki çalışmadan
+        // kalan, farklı boyutlu olabilir) kaldırıp bir kez daha dene
+        uint32_t pid = 0;
+        const int efd = ::shm_open(shm.c_str(), O_RDONLY, 0);
+        if (efd >= 0) {
+            struct stat st{};
+            if (::fstat(efd, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(EventRingHeader))) {
+                void* hv = ::mmap(nullptr, sizeof(EventRingHeader), PROT_READ, MAP_SHARED, efd, 0);
+                if (hv != MAP_FAILED) { pid = live_writer(hv); ::munmap(hv, sizeof(EventRingHeader)); }
+            }
+            ::close(efd);
+        }
+        if (pid) {
+            std::fprintf(stderr, "[EVT] '%s' halkası pid %u tarafından kullanılıyor.\n", cfg.name.c_str(), pid);
+            return false;
+        }
+        ::shm_unlink(shm.c_str());
+        fd_ = ::shm_open(shm.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd_ < 0) return false;
+    if (::ftruncate(fd_, static_cast<off_t>(bytes_)) != 0) {
+        ::close(fd_); fd_ = -1; ::shm_unlink(shm.c_str());
+        return false;
+    }
+    base = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd_); fd_ = -1; ::shm_unlink(shm.c_str());
+        return false;
+    }
+#endif
+    std::memset(base, 0, bytes_);
+    hdr_  = static_cast<EventRingHeader*>(base);
+    recs_ = reinterpret_cast<EventRecord*>(static_cast<uint8_t*>(base) + sizeof(EventRingHeader));
+    head_ = reinterpret_cast<std::atomic<uint64_t>*>(&hdr_->head);
+    mask_ = cap - 1;
+    pw_n_ = 0;
+
+    EventRingHeader h{};
+    h.magic    = 0;             // okuyucular magic'i en son görür
+    h.capacity = cap;
+    const int64_t m0 = static_cast<int64_t>(now_ns());
+    h.created_unix_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const int64_t m1 = static_cast<int64_t>(now_ns());
+    h.unix_off_ns = h.created_unix_ns - (m0 + (m1 - m0) / 2);
+#ifdef _WIN32
+    h.writer_pid = static_cast<uint32_t>(::GetCurrentProcessId());
+#else
+    h.writer_pid = static_cast<uint32_t>(::getpid());
+#endif
+    std::memcpy(hdr_, &h, sizeof(h));
+    std::atomic_thread_fence(std::memory_order_release);
+    reinterpret_cast<std::atomic<uint32_t>*>(&hdr_->magic)->store(kEventRingMagic, std::memory_order_release);
+
+    ok_.store(true, std::memory_order_release);
+    return true;
+}
+
+void EventRing::close() {
+    if (!ok_.exchange(false, std::memory_order_acq_rel)) return;
+#ifdef _WIN32
+    ::UnmapViewOfFile(hdr_);
+    ::CloseHandle(map_);
+    map_ = nullptr;
+#else
+    ::munmap(hdr_, bytes_);
+    // Yalnız bizim oluşturduğumuz segment kaldırılır: ad bu arada başka bir segmente
+    // geçmişse (elle silinip yeniden açılmış) dokunulmaz
+    const std::string shm = "/" + cfg_.name;
+    const int cfd = ::shm_open(shm.c_str(), O_RDONLY, 0);
+    if (cfd >= 0) {
+        struct stat mine{}, cur{};
+        if (::fstat(fd_, &mine) == 0 && ::fstat(cfd, &cur) == 0 &&
+            mine.st_dev == cur.st_dev && mine.st_ino == cur.st_ino)
+            ::shm_unlink(shm.c_str());
+        ::close(cfd);
+    }
+    ::close(fd_);
+    fd_ = -1;
+#endif
+    hdr_ = nullptr; recs_ = nullptr; head_ = nullptr;
+}
+
+uint64_t EventRing::published() const {
+    return ok() ? head_->load(std::memory_order_relaxed) : 0;
+}
+
+bool EventRing::publish(EventType type, const void* payload, uint32_t size, uint8_t version) {
+    if (!ok_.load(std::memory_order_relaxed) || size > sizeof(EventRecord::payload)) return false;
+    const uint64_t t = head_->fetch_add(1, std::memory_order_relaxed);
+    EventRecord& r = recs_[t & mask_];
+    auto* seq = reinterpret_cast<std::atomic<uint64_t>*>(&r.seq);
+
+    seq->store(2 * t + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    r.t_ns    = now_ns();
+    r.type    = static_cast<uint16_t>(type);
+    r.version = version;
+    r._r      = 0;
+    r.size    = size;
+    std::memcpy(r.payload, payload, size);
+    seq->store(2 * t + 2, std::memory_order_release);
+    return true;
+}
+
+void EventRing::detect(uint64_t session, uint8_t state, uint64_t frame, double power_dbm, double threshold_dbm) {
+    if (!ok()) return;
+    EvDetectV1 e{};
+    e.session = session; e.frame = frame; e.state = state;
+    e.power_dbm = static_cast<float>(power_dbm);
+    e.threshold_dbm = static_cast<float>(threshold_dbm);
+    publish(EventType::Detect, &e, sizeof(e));
+}
+
+void EventRing::power(uint64_t frame, double power_dbm, double threshold_dbm, bool jammed) {
+    if (!ok_.load(std::memory_order_relaxed) || cfg_.power_every <= 0) return;
+    if (++pw_n_ < static_cast<uint32_t>(cfg_.power_every)) return;
+    pw_n_ = 0;
+    EvPowerV1 e{};
+    e.frame = frame;
+    e.power_dbm = static_cast<float>(power_dbm);
+    e.threshold_dbm = static_cast<float>(threshold_dbm);
+    e.over = power_dbm > threshold_dbm ? 1 : 0;
+    e.jammed = jammed ? 1 : 0;
+    publish(EventType::Power, &e, sizeof(e));
+}
+
+void EventRing::hop(uint64_t session, uint64_t slot, int64_t slot_start_ns, uint32_t dwell_us, int value) {
+    if (!ok()) return;
+    EvHopV1 e{};
+    e.session = session; e.slot = slot; e.slot_start_ns = slot_start_ns;
+    e.dwell_us = dwell_us; e.value = value;
+    publish(EventType::Hop, &e, sizeof(e));
+}
+
+void EventRing::channel(uint64_t hz, uint64_t frame, double power_dbm, double threshold_dbm, bool jammed) {
+    if (!ok()) return;
+    EvChannelV1 e{};
+    e.hz = hz; e.frame = frame; e.jammed = jammed ? 1 : 0;
+    e.power_dbm = static_cast<float>(power_dbm);
+    e.threshold_dbm = static_cast<float>(threshold_dbm);
+    publish(EventType::Channel, &e, sizeof(e));
+}
+
+} // namespace jd
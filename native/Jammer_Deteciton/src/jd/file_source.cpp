@@ -0,0 +1,303 @@
+// jd/file_source.cpp
+#include "jd/file_source.hpp"
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+namespace jd {
+
+// ------------------------------------------------------------
+// SigMF meta (tam JSON ayrıştırıcı yerine ihtiyaç duyulan anahtarlar)
+static bool ends_with(const std::string& s, const char* suf) {
+    const size_t n = std::strlen(suf);
+    return s.size() >= n && s.compare(s.size() - n, n, suf) == 0;
+}
+
+static bool json_find_string(const std::string& js, const char* key, std::string& out) {
+    const std::string k = std::string("\"") + key + "\"";
+    size_t p = js.find(k);
+    if (p == std::string::npos) return false;
+    p = js.find(':', p + k.size());
+    if (p == std::string::npos) return false;
+    p = js.find('"', p);
+    if (p == std::string::npos) return false;
+    const size_t e = js.find('"', p + 1);
+    if (e == std::string::npos) return false;
+    out = js.substr(p + 1, e - p - 1);
+    return true;
+}
+
+static bool json_find_number(const std::string& js, const char* key, double& out) {
+    const std::string k = std::string("\"") + key + "\"";
+    size_t p = js.find(k);
+    if (p == std::string::npos) return false;
+    p = js.find(':', p + k.size());
+    if (p == std::string::npos) return false;
+    char* end = nullptr;
+    out = std::strtod(js.c_str() + p + 1, &end);
+    return end != js.c_str() + p + 1;
+}
+
+bool sigmf_read_meta(const std::string& meta_path, SigmfMeta& out) {
+    std::ifstream f(meta_path);
+    if (!f) return false;
+    std::stringstream ss; ss << f.rdbuf();
+    const std::string js = ss.str();
+
+    std::string dt;
+    if (!json_find_string(js, "core:datatype", dt)) return false;
+    if      (dt == "ci16_le" || dt == "ci16") out.format = SampleFormat::CS16;
+    else if (dt == "cf32_le" || dt == "cf32") out.format = SampleFormat::CF32;
+    else {
+        std::fprintf(stderr, "[FILE] desteklenmeyen core:datatype: %s\n", dt.c_str());
+        return false;
+    }
+    json_find_number(js, "core:sample_rate", out.samp_hz);
+    json_find_number(js, "core:frequency",   out.center_hz);  // ilk capture
+    json_find_string(js, "core:description", out.description);
+    return true;
+}
+
+bool sigmf_write_meta(const std::string& meta_path, const SigmfMeta& m,
+                      const std::vector<std::pair<uint64_t, double>>& captures) {
+    FILE* fp = std::fopen(meta_path.c_str(), "w");
+    if (!fp) return false;
+    std::fprintf(fp,
+        "{\n"
+        "  \"global\": {\n"
+        "    \"core:datatype\": \"%s\",\n"
+        "    \"core:sample_rate\": %.1f,\n"
+        "    \"core:version\": \"1.0.0\",\n"
+        "    \"core:hw\": \"ADALM-Pluto\",\n"
+        "    \"core:description\": \"%s\"\n"
+        "  },\n"
+        "  \"captures\": [\n",
+        m.format == SampleFormat::CS16 ? "ci16_le" : "cf32_le",
+        m.samp_hz, m.description.c_str());
+    for (size_t i = 0; i < captures.size(); ++i) {
+        std::fprintf(fp, "    { \"core:sample_start\": %llu, \"core:frequency\": %.1f }%s\n",
+                     static_cast<unsigned long long>(captures[i].first), captures[i].second,
+                     (i + 1 < captures.size()) ? "," : "");
+    }
+    std::fprintf(fp, "  ],\n  \"annotations\": []\n}\n");
+    std::fclose(fp);
+    return true;
+}
+
+// ------------------------------------------------------------
+bool MappedFile::open(const std::string& path) {
+    close();
+#ifdef _WIN32
+    HANDLE hf = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hf == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER sz;
+    if (!::GetFileSizeEx(hf, &sz) || sz.QuadPart == 0) { ::CloseHandle(hf); return false; }
+    HANDLE hm = ::CreateFileMappingA(hf, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!hm) { ::CloseHandle(hf); return false; }
+    void* p = ::MapViewOfFile(hm, FILE_MAP_READ, 0, 0, 0);
+    if (!p) { ::CloseHandle(hm); ::CloseHandle(hf); return false; }
+    hfile_ = hf; hmap_ = hm;
+    data_ = static_cast<const uint8_t*>(p);
+    size_ = static_cast<size_t>(sz.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) { ::close(fd); return false; }
+    void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // eşleme dosya kapanınca da geçerli
+    if (p == MAP_FAILED) return false;
+    ::madvise(p, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    data_ = static_cast<const uint8_t*>(p);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close() {
+    if (!data_) return;
+#ifdef _WIN32
+    ::UnmapViewOfFile(data_);
+    if (hmap_)  ::CloseHandle(static_cast<HANDLE>(hmap_));
+    if (hfile_) ::CloseHandle(static_cast<HANDLE>(hfile_));
+    hmap_ = hfile_ = nullptr;
+#else
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+// ------------------------------------------------------------
+FileSource::FileSource(const FileSourceConfig& cfg) : cfg_(cfg) {
+    std::string data_path = cfg_.path;
+    std::string meta_path;
+    if (ends_with(cfg_.path, ".sigmf-meta")) {
+        meta_path = cfg_.path;
+        data_path = cfg_.path.substr(0, cfg_.path.size() - 4) + "data";
+    } else if (ends_with(cfg_.path, ".sigmf-data")) {
+        meta_path = cfg_.path.substr(0, cfg_.path.size() - 4) + "meta";
+    }
+
+    meta_.format = cfg_.format;
+    if (!meta_path.empty() && !sigmf_read_meta(meta_path, meta_)) {
+        std::fprintf(stderr, "[FILE] SigMF meta okunamadı: %s (CLI formatı kullanılacak)\n", meta_path.c_str());
+        meta_.format = cfg_.format;
+    }
+    if (cfg_.samp_hz > 0.0) meta_.samp_hz = cfg_.samp_hz;
+    if (cfg_.realtime && meta_.samp_hz <= 0.0) {
+        std::fprintf(stderr, "[FILE] realtime için sample rate bilinmiyor; tam hızda oynatılacak.\n");
+        cfg_.realtime = false;
+    }
+
+    if (!map_.open(data_path)) {
+        std::fprintf(stderr, "[FILE] veri dosyası açılamadı: %s\n", data_path.c_str());
+        return;
+    }
+    const size_t bps = (meta_.format == SampleFormat::CS16) ? 4 : 8;
+    total_ = map_.size() / bps;
+    std::fprintf(stderr, "[FILE] %s: %zu samples (%s, %.0f S/s)%s%s\n", data_path.c_str(), total_,
+                 meta_.format == SampleFormat::CS16 ? "ci16_le" : "cf32_le", meta_.samp_hz,
+                 cfg_.realtime ? " realtime" : "", cfg_.loop ? " loop" : "");
+}
+
+bool FileSource::next_view(FrameView& v) {
+    if (!map_.data()) return false;
+    const size_t n = static_cast<size_t>(cfg_.frame_len);
+    if (pos_ + n > total_) {
+        if (!cfg_.loop || total_ < n) return false;
+        pos_ = 0;   // artık örnekler atlanır: frameler dosya sonunu aşmaz
+        ++loops_;
+    }
+
+    if (cfg_.realtime) {
+        if (played_ == 0) t0_ = std::chrono::steady_clock::now();
+        const auto due = t0_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                   std::chrono::duration<double>(static_cast<double>(played_ + n) / meta_.samp_hz));
+        std::this_thread::sleep_until(due);
+    }
+
+    const size_t bps = (meta_.format == SampleFormat::CS16) ? 4 : 8;
+    v.data    = map_.data() + pos_ * bps;
+    v.samples = n;
+    v.format  = meta_.format;
+    pos_    += n;
+    played_ += n;
+    ++frames_;
+    return true;
+}
+
+bool FileSource::get_frame(std::vector<std::complex<float>>& out) {
+    FrameView v;
+    if (!next_view(v)) return false;
+    out.resize(v.samples);
+    if (v.format == SampleFormat::CF32) {
+        std::memcpy(out.data(), v.data, v.samples * sizeof(std::complex<float>));
+    } else {
+        const int16_t* s = v.cs16();
+        const float scale = 1.0f / 32768.0f;
+        for (size_t i = 0; i < v.samples; ++i) out[i] = { s[2*i] * scale, s[2*i + 1] * scale };
+    }
+    return true;
+}
+
+// ------------------------------------------------------------
+SigmfRecorder::SigmfRecorder(const std::string& base_path, double samp_hz, double center_hz,
+                             size_t block_bytes, int pool_blocks)
+    : base_(base_path) {
+    meta_.format      = SampleFormat::CS16;
+    meta_.samp_hz     = samp_hz;
+    meta_.center_hz   = center_hz;
+    meta_.description = "jammer_detect RX capture";
+    captures_.push_back({0, center_hz});
+
+    fp_ = std::fopen((base_ + ".sigmf-data").c_str(), "wb");
+    if (!fp_) {
+        std::fprintf(stderr, "[REC] %s.sigmf-data açılamadı.\n", base_.c_str());
+        return;
+    }
+    pool_.resize(static_cast<size_t>(std::max(2, pool_blocks)));
+    for (auto& b : pool_) { b.bytes.resize(block_bytes); free_.push_back(&b); }
+    th_ = std::thread([this]{ writer_loop(); });
+}
+
+SigmfRecorder::~SigmfRecorder() { close(); }
+
+void SigmfRecorder::write(const int16_t* iq, size_t samples) {
+    if (!fp_) return;
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(iq);
+    size_t left = samples * 4;
+    std::unique_lock<std::mutex> lk(m_);
+    while (left) {
+        if (!cur_) {
+            if (free_.empty()) {               // yazıcı yetişemiyor: kalan veriyi düşür
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            cur_ = free_.back(); free_.pop_back();
+            cur_->used = 0;
+        }
+        const size_t take = std::min(left, cur_->bytes.size() - cur_->used);
+        std::memcpy(cur_->bytes.data() + cur_->used, src, take);
+        cur_->used += take; src += take; left -= take;
+        samples_.fetch_add(take / 4, std::memory_order_relaxed);
+        if (cur_->used == cur_->bytes.size()) {
+            full_.push_back(cur_);
+            cur_ = nullptr;
+            cv_.notify_one();
+        }
+    }
+}
+
+void SigmfRecorder::note_retune(double center_hz) {
+    std::lock_guard<std::mutex> lk(m_);
+    captures_.push_back({samples_.load(std::memory_order_relaxed), center_hz});
+}
+
+void SigmfRecorder::writer_loop() {
+    std::unique_lock<std::mutex> lk(m_);
+    for (;;) {
+        cv_.wait(lk, [&]{ return quit_ || !full_.empty(); });
+        while (!full_.empty()) {
+            Block* b = full_.front(); full_.pop_front();
+            lk.unlock();
+            std::fwrite(b->bytes.data(), 1, b->used, fp_);
+            lk.lock();
+            free_.push_back(b);
+        }
+        if (quit_) break;
+    }
+}
+
+void SigmfRecorder::close() {
+    if (!fp_) return;
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        if (cur_ && cur_->used) full_.push_back(cur_);
+        cur_ = nullptr;
+        quit_ = true;
+    }
+    cv_.notify_one();
+    if (th_.joinable()) th_.join();
+    std::fclose(fp_);
+    fp_ = nullptr;
+
+    sigmf_write_meta(base_ + ".sigmf-meta", meta_, captures_);
+    std::fprintf(stderr, "[REC] %s: %llu samples, %llu blocks dropped\n", base_.c_str(),
+                 static_cast<unsigned long long>(samples_written()),
+                 static_cast<unsigned long long>(blocks_dropped()));
+}
+
+} // namespace jd
@@ -0,0 +1,140 @@
+#include "jd/hop_clock.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace jd {
+
+namespace {
+constexpr uint8_t kLegacy[5] = {1, 3, 5, 4, 2};
+constexpr int     kMaxChannels = 256;
+}
+
+// ------------------------------------------------------------
+HopSequence::HopSequence(uint64_t key, int channels)
+    : key_(key), n_(key ? std::clamp(channels, 2, kMaxChannels) : 5) {}
+
+uint64_t HopSequence::mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void HopSequence::perm(uint64_t cycle, uint8_t* p) const {
+    for (int i = 0; i < n_; ++i) p[i] = static_cast<uint8_t>(i);
+    uint64_t st = mix(key_ ^ mix(cycle));
+    for (int j = n_ - 1; j > 0; --j) {
+        st += 0x9E3779B97F4A7C15ull;
+        const int k = static_cast<int>(mix(st) % static_cast<uint64_t>(j + 1));
+        std::swap(p[j], p[k]);
+    }
+}
+
+int HopSequence::value(uint64_t slot) const {
+    const uint64_t n = static_cast<uint64_t>(n_);
+    if (!key_) return kLegacy[slot % n];
+
+    const uint64_t c = (n_ == 2) ? 0 : slot / n;
+    const int      i = static_cast<int>(slot % n);
+    uint8_t p[kMaxChannels];
+    perm(c, p);
+    if (n_ > 2 && i >= n_ - 2) {
+        // Devir sınırında aynı kanal iki slot sürmesin: sonraki devrin ilk değeri
+        // sabit kalır, bu devrin son iki değeri yer değiştirir
+        uint8_t q[kMaxChannels];
+        perm(c + 1, q);
+        if (p[n_ - 1] == q[0]) std::swap(p[n_ - 2], p[n_ - 1]);
+    }
+    return p[i] + 1;
+}
+
+// ------------------------------------------------------------
+HopClock::HopClock(const HopConfig& cfg)
+    : cfg_(cfg),
+      seq_(cfg.key, cfg.channels),
+      dwell_ns_(1000ll * std::max<uint32_t>(cfg.dwell_us, 1000)) {
+    cfg_.channels = seq_.channels();
+    cfg_.dwell_us = static_cast<uint32_t>(dwell_ns_ / 1000);
+    // İki okuma arası ortalaması: ofset hatası okuma süresinin yarısıyla sınırlı
+    const int64_t m0 = now();
+    const int64_t u  = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const int64_t m1 = now();
+    unix_off_ = u - (m0 + (m1 - m0) / 2);
+    epoch_.store(now(), std::memory_order_release);
+}
+
+void HopClock::arm() {
+    epoch_.store(cfg_.epoch_unix_ns ? cfg_.epoch_unix_ns - unix_off_ : now(), std::memory_order_release);
+}
+
+bool HopClock::slot_at(int64_t t, uint64_t& slot) const {
+    const int64_t d = t - epoch_ns();
+    if (d < 0) return false;
+    slot = static_cast<uint64_t>(d / dwell_ns_);
+    return true;
+}
+
+// ------------------------------------------------------------
+HopTimer::HopTimer(const HopClock& clock, Fn fn) : clk_(clock), fn_(std::move(fn)) {}
+
+HopTimer::~HopTimer() { stop(); }
+
+void HopTimer::start() {
+    if (th_.joinable()) return;
+    { std::lock_guard<std::mutex> lk(m_); quit_ = false; }
+    th_ = std::thread(&HopTimer::loop, this);
+}
+
+void HopTimer::stop() {
+    { std::lock_guard<std::mutex> lk(m_); quit_ = true; }
+    cv_.notify_all();
+    if (th_.joinable()) th_.join();
+}
+
+void HopTimer::enable(bool on) {
+    { std::lock_guard<std::mutex> lk(m_); on_ = on; ++gen_; }
+    cv_.notify_all();
+}
+
+void HopTimer::loop() {
+    using clock = std::chrono::steady_clock;
+    const int64_t refresh = 1000000ll * std::max(0, clk_.config().refresh_ms);
+
+    std::unique_lock<std::mutex> lk(m_);
+    while (!quit_) {
+        if (!on_) { cv_.wait(lk, [&] { return quit_ || on_; }); continue; }
+
+        // (Yeniden) etkinleşme: epoch öncesiyse ilk sınırı, değilse içinde bulunulan slotu hemen yayınla
+        const uint64_t g = gen_;
+        uint64_t slot = 0;
+        int64_t  dl   = clk_.epoch_ns();
+        if (clk_.slot_at(HopClock::now(), slot)) dl = HopClock::now();
+
+        while (!quit_ && on_ && gen_ == g) {
+            const clock::time_point tp{std::chrono::nanoseconds(dl)};
+            if (cv_.wait_until(lk, tp, [&] { return quit_ || gen_ != g; })) break;
+
+            int64_t t = HopClock::now();
+            uint64_t cur = slot;
+            if (clk_.slot_at(t, cur) && cur > slot) {
+                // Bir slottan fazla geç: ara slotları yayınlamadan güncel slota atla
+                missed_.fetch_add(cur - slot, std::memory_order_relaxed);
+                slot = cur;
+                dl   = clk_.slot_start(slot);
+            }
+            late_.record(static_cast<uint64_t>(std::max<int64_t>(0, t - dl)));
+            fired_.fetch_add(1, std::memory_order_relaxed);
+
+            lk.unlock();        // fn yayın kilidini alır; enable() onun altında çağrılabilir
+            fn_(slot);
+            lk.lock();
+
+            const int64_t next = clk_.slot_start(slot + 1);
+            dl = (refresh > 0) ? dl + refresh : next;
+            if (dl >= next) { dl = next; ++slot; }
+        }
+    }
+}
+
+} // namespace jd
@@ -58,6 +58,8 @@ DetectOutcome JammerDetector::run_detection() {
     dc.threshold_dbm     = threshold_dbm_;                // kalibrasyondan geliyor
     dc.jammer_consecutive= p_.detect_jammer_consecutive;
     dc.max_frames        = p_.detect_max_frames;
+    dc.live_threshold    = live_thr_;
+    dc.stop              = stop_;
 
     Detector det(src_, pm, dc);
     return det.run();
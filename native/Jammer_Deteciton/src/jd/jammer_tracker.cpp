@@ -0,0 +1,94 @@
+// jd/jammer_tracker.cpp
+#include "jd/jammer_tracker.hpp"
+#include "jd/metrics.hpp"
+#include "jd/logger.hpp"
+#include "jd/event_ring.hpp"
+#include "jd/telemetry.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace jd {
+
+JammerTracker::JammerTracker(const TrackerConfig& cfg) : cfg_(cfg) {
+    cfg_.on_frames  = std::max(1, cfg_.on_frames);
+    cfg_.off_frames = std::max(1, cfg_.off_frames);
+    reset(now_ns());
+}
+
+void JammerTracker::reset(uint64_t t_ns) {
+    state_    = JamState::Clear;
+    run_      = 0;
+    since_ns_ = t_ns;
+}
+
+bool JammerTracker::update(double power_dbm, uint64_t t_ns, JammerEvent* ev) {
+    ++frame_;
+    const bool jammed = (state_ == JamState::Jammed);
+
+    // Mevcut durumun tersini gösteren frame'ler sayılır; aksi halde sayaç sıfırlanır
+    const bool toward = jammed ? (power_dbm < cfg_.threshold_dbm - cfg_.off_margin_db)
+                               : (power_dbm > cfg_.threshold_dbm + cfg_.on_margin_db);
+    run_ = toward ? run_ + 1 : 0;
+
+    const int need = jammed ? cfg_.off_frames : cfg_.on_frames;
+    const double dwell_ms = 1e-6 * static_cast<double>(t_ns - since_ns_);
+    if (run_ < need || dwell_ms < cfg_.min_dwell_ms) return false;
+
+    state_ = jammed ? JamState::Clear : JamState::Jammed;
+    if (state_ == JamState::Jammed) ++onsets_;
+    run_ = 0;
+    since_ns_ = t_ns;
+
+    if (ev) {
+        ev->state         = state_;
+        ev->frame         = frame_;
+        ev->power_dbm     = power_dbm;
+        ev->t_ns          = t_ns;
+        ev->wall_us       = std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::system_clock::now().time_since_epoch()).count();
+        ev->prev_state_ms = dwell_ms;
+        ev->onsets        = onsets_;
+    }
+    return true;
+}
+
+DetectOutcome ContinuousDetector::run(const std::atomic<bool>& stop) {
+    std::vector<std::complex<float>> frame;
+    HotPathMetrics& hm = hot_metrics();
+    AsyncLogger&    lg = logger();
+    EventRing&      ev_ring = events();
+    Telemetry&      tm = telemetry();
+    tracker_.reset(now_ns());
+
+    while (!stop.load(std::memory_order_acquire)) {
+        const uint64_t t0 = now_ns();
+        if (!src_.get_frame(frame)) {
+            lg.text(LogLevel::Warn, "Source exhausted/error.");
+            return DetectOutcome::SourceEnded;
+        }
+        if (src_.last_frame_stale()) continue;   // eski frekanstan kalan tampon
+        const uint64_t t1 = now_ns();
+        const double pd = pm_.power_dbm(frame);
+        const uint64_t t2 = now_ns();
+        hm.record(Stage::Power, t2 - t1);
+        hm.frames.fetch_add(1, std::memory_order_relaxed);
+
+        if (live_thr_) tracker_.set_threshold_dbm(live_thr_->load(std::memory_order_relaxed));
+        JammerEvent ev;
+        const bool changed = tracker_.update(pd, t2, &ev);
+        const bool jammed  = tracker_.state() == JamState::Jammed;
+        if (jammed) hm.jammed_frames.fetch_add(1, std::memory_order_relaxed);
+        lg.power_sample(pd, pd > tracker_.config().threshold_dbm);
+        ev_ring.power(tracker_.frames(), pd, tracker_.config().threshold_dbm, jammed);
+        tm.frame(tracker_.frames(), pd, tracker_.config().threshold_dbm, jammed);
+        if (changed && on_event_) on_event_(ev);
+        if (on_frame_) on_frame_(t2);
+
+        const uint64_t t3 = now_ns();
+        hm.record(Stage::Decide, t3 - t2);
+        hm.record(Stage::Frame,  t3 - t0);
+    }
+    return DetectOutcome::CompletedNoSustain;
+}
+
+} // namespace jd
@@ -0,0 +1,189 @@
+// jd/logger.cpp
+#include "jd/logger.hpp"
+#include "jd/metrics.hpp"   // now_ns
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+
+namespace jd {
+
+AsyncLogger& AsyncLogger::instance() {
+    static AsyncLogger lg;
+    return lg;
+}
+
+AsyncLogger::~AsyncLogger() { stop(); }
+
+void AsyncLogger::start(const LoggerConfig& cfg) {
+    if (running_.load()) return;
+    size_t cap = 2;
+    while (cap < std::max<size_t>(cfg.capacity, 2)) cap <<= 1;
+    cells_.reset(new Cell[cap]);
+    for (size_t i = 0; i < cap; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+    mask_ = cap - 1;
+    head_.store(0);
+    tail_.store(0);
+    level_.store(cfg.level);
+    out_ = cfg.out ? cfg.out : stdout;
+    summary_ms_ = cfg.summary_ms;
+    quit_.store(false);
+    closed_.store(false);
+    running_.store(true, std::memory_order_release);
+    th_ = std::thread([this] { drain_loop(); });
+}
+
+void AsyncLogger::stop() {
+    if (!running_.load()) return;
+    // Üreticileri kapat: closed_ görülmeden kuyruğa girmiş olanlar bitene kadar bekle,
+    // böylece son boşaltma tüm kayıtları kapsar
+    closed_.store(true);
+    while (inflight_.load() != 0) std::this_thread::yield();
+    quit_.store(true, std::memory_order_release);
+    if (th_.joinable()) th_.join();
+    running_.store(false, std::memory_order_release);
+    std::fflush(out_);
+}
+
+void AsyncLogger::flush() {
+    if (!running_.load(std::memory_order_acquire)) { std::fflush(out_); return; }
+    const uint64_t target = pushed_.load(std::memory_order_acquire);
+    while (written_.load(std::memory_order_acquire) < target && running_.load())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+// closed_ ve inflight_ seq_cst: üretici sayaç artışından sonra closed_'ı, stop()
+// closed_'dan sonra sayacı okur; ikisinden biri diğerini mutlaka görür.
+void AsyncLogger::submit(const LogRecord& r) {
+    if (!running_.load(std::memory_order_acquire)) { emit(r); return; }
+    inflight_.fetch_add(1);
+    if (closed_.load()) {
+        inflight_.fetch_sub(1, std::memory_order_release);
+        emit(r);
+        return;
+    }
+    if (!push(r)) dropped_.fetch_add(1, std::memory_order_relaxed);
+    inflight_.fetch_sub(1, std::memory_order_release);
+}
+
+// Vyukov sınırlı kuyruk: hücre seq'i sahipliği belirler
+bool AsyncLogger::push(const LogRecord& r) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& c = cells_[pos & mask_];
+        const size_t seq = c.seq.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                c.rec = r;
+                c.seq.store(pos + 1, std::memory_order_release);
+                pushed_.fetch_add(1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;          // dolu
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogger::pop(LogRecord& r) {
+    const size_t pos = tail_.load(std::memory_order_relaxed);
+    Cell& c = cells_[pos & mask_];
+    const size_t seq = c.seq.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) return false;
+    r = c.rec;
+    c.seq.store(pos + mask_ + 1, std::memory_order_release);
+    tail_.store(pos + 1, std::memory_order_relaxed);
+    return true;
+}
+
+void AsyncLogger::drain_loop() {
+    LogRecord r;
+    for (;;) {
+        bool any = false;
+        while (pop(r)) {
+            emit(r);
+            written_.fetch_add(1, std::memory_order_release);
+            any = true;
+        }
+        const uint64_t d = dropped_.load(std::memory_order_relaxed);
+        if (d != reported_drops_) {
+            std::fprintf(out_, "[LOG] %llu records dropped (ring full)\n",
+                         static_cast<unsigned long long>(d - reported_drops_));
+            reported_drops_ = d;
+            any = true;
+        }
+        if (any) std::fflush(out_);
+        if (quit_.load(std::memory_order_acquire) && head_.load() == tail_.load()) break;
+        if (!any) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+void AsyncLogger::emit(const LogRecord& r) {
+    switch (r.kind) {
+        case LogKind::Text:
+            std::fprintf(out_, "%s\n", r.text);   // tek çağrı: eşzamanlı yazımla satır bölünmez
+            break;
+        case LogKind::FrameState:
+            if (r.flag)
+                std::fprintf(out_, "Frame %d - JAMMER (%.2f dBm)  [count=%d/%d]\n", r.i0, r.d0, r.i1, r.i2);
+            else
+                std::fprintf(out_, "Frame %d - Normal (%.2f dBm)  [after %d positive]\n", r.i0, r.d0, r.i1);
+            break;
+        case LogKind::PowerSummary:
+            std::fprintf(out_, "[DET] %.2f s: frames=%d jammed=%d power min/mean/max=%.2f/%.2f/%.2f dBm\n",
+                         r.d2, r.i0, r.i1, r.d0, r.d1 / std::max(1, r.i0), r.d3);
+            break;
+    }
+}
+
+void AsyncLogger::text(LogLevel l, const char* fmt, ...) {
+    if (!enabled(l)) return;
+    LogRecord r;
+    r.t_ns  = now_ns();
+    r.level = l;
+    r.kind  = LogKind::Text;
+    va_list ap;
+    va_start(ap, fmt);
+    std::vsnprintf(r.text, sizeof(r.text), fmt, ap);
+    va_end(ap);
+    submit(r);
+}
+
+void AsyncLogger::frame_state(int frame, double dbm, int count, int consec, bool jammed) {
+    if (!enabled(LogLevel::Info)) return;
+    LogRecord r;
+    r.t_ns  = now_ns();
+    r.level = LogLevel::Info;
+    r.kind  = LogKind::FrameState;
+    r.flag  = jammed ? 1 : 0;
+    r.i0 = frame; r.i1 = count; r.i2 = consec;
+    r.d0 = dbm;
+    submit(r);
+}
+
+void AsyncLogger::power_sample(double dbm, bool jammed) {
+    if (summary_ms_ <= 0 || !enabled(LogLevel::Info)) return;
+    const uint64_t t = now_ns();
+    if (sum_n_ == 0) { sum_t0_ = t; sum_min_ = sum_max_ = dbm; sum_acc_ = 0.0; sum_jam_ = 0; }
+    sum_min_ = std::min(sum_min_, dbm);
+    sum_max_ = std::max(sum_max_, dbm);
+    sum_acc_ += dbm;
+    ++sum_n_;
+    if (jammed) ++sum_jam_;
+
+    const uint64_t span = t - sum_t0_;
+    if (span < static_cast<uint64_t>(summary_ms_) * 1000000ull) return;
+
+    LogRecord r;
+    r.t_ns  = t;
+    r.level = LogLevel::Info;
+    r.kind  = LogKind::PowerSummary;
+    r.i0 = sum_n_; r.i1 = sum_jam_;
+    r.d0 = sum_min_; r.d1 = sum_acc_; r.d2 = 1e-9 * static_cast<double>(span); r.d3 = sum_max_;
+    sum_n_ = 0;
+    submit(r);
+}
+
+} // namespace jd
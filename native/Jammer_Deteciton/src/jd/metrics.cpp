@@ -0,0 +1,102 @@
+// jd/metrics.cpp
+#include "jd/metrics.hpp"
+#include <cstdio>
+#include <limits>
+
+namespace jd {
+
+double LatencyHistogram::Snapshot::percentile_us(double p) const {
+    if (count == 0) return 0.0;
+    if (p >= 100.0) return 1e-3 * static_cast<double>(max_ns);
+    const double target = (p <= 0.0 ? 0.0 : p / 100.0) * static_cast<double>(count);
+    uint64_t acc = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+        acc += buckets[i];
+        if (buckets[i] && static_cast<double>(acc) >= target) {
+            // Kova ortası; uçlar gerçek min/max ile sınırlı
+            const uint64_t lo = bucket_low(i);
+            const uint64_t hi = (i + 1 < kBuckets) ? bucket_low(i + 1) : lo;
+            uint64_t v = lo + (hi - lo) / 2;
+            if (v > max_ns) v = max_ns;
+            if (v < min_ns) v = min_ns;
+            return 1e-3 * static_cast<double>(v);
+        }
+    }
+    return 1e-3 * static_cast<double>(max_ns);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+    Snapshot s;
+    for (int i = 0; i < kBuckets; ++i) s.buckets[i] = b_[i].load(std::memory_order_relaxed);
+    s.count  = count_.load(std::memory_order_relaxed);
+    s.sum_ns = sum_.load(std::memory_order_relaxed);
+    s.max_ns = max_.load(std::memory_order_relaxed);
+    s.min_ns = s.count ? min_.load(std::memory_order_relaxed) : 0;
+    return s;
+}
+
+void LatencyHistogram::reset() {
+    for (auto& b : b_) b.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+}
+
+const char* stage_name(Stage s) {
+    switch (s) {
+        case Stage::Refill:   return "refill";
+        case Stage::Convert:  return "convert";
+        case Stage::Power:    return "power";
+        case Stage::Decide:   return "decide";
+        case Stage::Frame:    return "frame";
+        case Stage::Interval: return "interval";
+        default:              return "?";
+    }
+}
+
+void HotPathMetrics::reset() {
+    for (auto& h : stage) h.reset();
+    frames.store(0);
+    jammed_frames.store(0);
+    refill_errors.store(0);
+    stale_frames.store(0);
+    t0_ns.store(now_ns());
+}
+
+HotPathMetrics& hot_metrics() {
+    static HotPathMetrics m;
+    return m;
+}
+
+std::string format_stats(const HotPathMetrics& m) {
+    char buf[256];
+    std::string out;
+    out.reserve(1400);
+
+    const double up_s = 1e-9 * static_cast<double>(now_ns() - m.t0_ns.load());
+    const uint64_t frames = m.frames.load();
+    std::snprintf(buf, sizeof(buf),
+                  "{\"uptime_s\":%.3f,\"frames\":%llu,\"fps\":%.1f,\"jammed\":%llu,\"refill_err\":%llu,\"stale\":%llu,\"stages\":{",
+                  up_s, static_cast<unsigned long long>(frames), up_s > 0.0 ? frames / up_s : 0.0,
+                  static_cast<unsigned long long>(m.jammed_frames.load()),
+                  static_cast<unsigned long long>(m.refill_errors.load()),
+                  static_cast<unsigned long long>(m.stale_frames.load()));
+    out += buf;
+
+    for (size_t i = 0; i < m.stage.size(); ++i) {
+        const auto s = m.stage[i].snapshot();
+        std::snprintf(buf, sizeof(buf),
+                      "%s\"%s\":{\"n\":%llu,\"mean_us\":%.2f,\"p50_us\":%.2f,\"p90_us\":%.2f,"
+                      "\"p99_us\":%.2f,\"p999_us\":%.2f,\"max_us\":%.2f}",
+                      i ? "," : "", stage_name(static_cast<Stage>(i)),
+                      static_cast<unsigned long long>(s.count), s.mean_us(),
+                      s.percentile_us(50), s.percentile_us(90), s.percentile_us(99),
+                      s.percentile_us(99.9), 1e-3 * static_cast<double>(s.max_ns));
+        out += buf;
+    }
+    out += "}}";
+    return out;
+}
+
+} // namespace jd
@@ -0,0 +1,309 @@
+// jd/pluto_sink.cpp
+#include "jd/pluto_sink.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace jd {
+
+static void log_err(const char* msg) { std::fprintf(stderr, "[PlutoTx] %s\n", msg); }
+
+// ------------------------------------------------------------
+// Cs16FileProducer
+
+// ofdm_cache.hpp CacheHeader alanları (Ofdm_Modem'e bağımlılık olmasın diye ofsetle okunur)
+static constexpr uint32_t kOcsMagic = 0x3153434Fu;   // "OCS1"
+
+Cs16FileProducer::Cs16FileProducer(const std::string& path, bool loop) : loop_(loop) {
+#if defined(_WIN32)
+    HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                           nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE) { log_err("cs16 dosyası açılamadı."); return; }
+    LARGE_INTEGER li;
+    if (!GetFileSizeEx(f, &li) || li.QuadPart < 4) { CloseHandle(f); log_err("cs16 dosyası boş."); return; }
+    HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void*  v = m ? MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!v) {
+        if (m) CloseHandle(m);
+        CloseHandle(f);
+        log_err("cs16 dosyası eşlenemedi.");
+        return;
+    }
+    file_ = f;
+    map_  = m;
+    size_ = static_cast<uint64_t>(li.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { log_err("cs16 dosyası açılamadı."); return; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 4) { ::close(fd); log_err("cs16 dosyası boş."); return; }
+    void* v = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (v == MAP_FAILED) { log_err("cs16 dosyası eşlenemedi."); return; }
+    madvise(v, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    size_ = static_cast<uint64_t>(st.st_size);
+#endif
+    base_ = static_cast<const uint8_t*>(v);
+
+    uint64_t off = 0;
+    uint32_t magic = 0;
+    std::memcpy(&magic, base_, 4);
+    if (magic == kOcsMagic && size_ >= 40) {
+        uint16_t hb = 0;
+        uint64_t ns = 0;
+        std::memcpy(&hb, base_ + 10, 2);
+        std::memcpy(&ns, base_ + 32, 8);
+        if (hb < 40 || hb + ns * 4 != size_) { log_err("ofdm_cache başlığı tutarsız."); return; }
+        off = hb;
+    }
+    n_  = (size_ - off) / 4;
+    iq_ = reinterpret_cast<const int16_t*>(base_ + off);
+    if (n_ == 0) iq_ = nullptr;
+}
+
+Cs16FileProducer::~Cs16FileProducer() {
+    if (!base_) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(map_));
+    CloseHandle(static_cast<HANDLE>(file_));
+#else
+    munmap(const_cast<uint8_t*>(base_), static_cast<size_t>(size_));
+#endif
+}
+
+size_t Cs16FileProducer::fill(int16_t* iq, size_t n) {
+    if (!iq_) return 0;
+    size_t done = 0;
+    while (done < n) {
+        if (pos_ >= n_) {
+            if (!loop_) break;
+            pos_ = 0;
+        }
+        const size_t take = static_cast<size_t>(std::min<uint64_t>(n - done, n_ - pos_));
+        std::memcpy(iq + 2 * done, iq_ + 2 * pos_, take * 4);
+        done += take;
+        pos_ += take;
+    }
+    return done;
+}
+
+// ------------------------------------------------------------
+// PlutoSink
+
+PlutoSink::PlutoSink(const PlutoSinkConfig& cfg, iio_context* shared_ctx) : cfg_(cfg) {
+    if (!init_context(shared_ctx)) { log_err("TX context/cihaz hazırlanamadı."); txdev_ = nullptr; return; }
+    if (cfg_.apply_config && !apply_static_config()) { log_err("TX ayarları uygulanamadı."); txdev_ = nullptr; return; }
+}
+
+PlutoSink::~PlutoSink() {
+    stop();
+    if (tx_i_) iio_channel_disable(tx_i_);
+    if (tx_q_) iio_channel_disable(tx_q_);
+    if (own_ctx_ && ctx_) iio_context_destroy(ctx_);
+    ctx_ = nullptr;
+}
+
+bool PlutoSink::init_context(iio_context* shared_ctx) {
+    if (shared_ctx) {
+        ctx_ = shared_ctx;
+    } else {
+        ctx_ = cfg_.uri.empty() ? iio_create_default_context()
+                                : iio_create_context_from_uri(cfg_.uri.c_str());
+        if (!ctx_) { log_err("iio context null"); return false; }
+        own_ctx_ = true;
+        iio_context_set_timeout(ctx_, 1000); // ms
+    }
+
+    phy_   = iio_context_find_device(ctx_, "ad9361-phy");
+    txdev_ = iio_context_find_device(ctx_, "cf-ad9361-dds-core-lpc");
+    if (!phy_ || !txdev_) { log_err("ad9361-phy/cf-ad9361-dds-core-lpc bulunamadı."); return false; }
+
+    lo_ch_     = iio_device_find_channel(phy_, "altvoltage1", true);
+    phy_tx_ch_ = iio_device_find_channel(phy_, "voltage0", true);
+    tx_i_      = iio_device_find_channel(txdev_, "voltage0", true);
+    tx_q_      = iio_device_find_channel(txdev_, "voltage1", true);
+    if (!lo_ch_ || !phy_tx_ch_ || !tx_i_ || !tx_q_) { log_err("TX kanalları bulunamadı."); return false; }
+    iio_channel_enable(tx_i_);
+    iio_channel_enable(tx_q_);
+    return true;
+}
+
+bool PlutoSink::apply_static_config() {
+    // AD9361'de örnek hızı RX/TX ortak saat zincirinden gelir; TX kanalına yazmak yeterli
+    std::lock_guard<std::mutex> lk(attr_m_);
+    if (iio_channel_attr_write_longlong(phy_tx_ch_, "sampling_frequency", static_cast<long long>(cfg_.samp_hz)) < 0) {
+        log_err("sampling_frequency yazılamadı.");
+        return false;
+    }
+    if (iio_channel_attr_write_longlong(phy_tx_ch_, "rf_bandwidth", static_cast<long long>(cfg_.rfbw_hz)) < 0) {
+        log_err("rf_bandwidth yazılamadı.");
+        return false;
+    }
+    if (iio_channel_attr_write_longlong(lo_ch_, "frequency", static_cast<long long>(cfg_.center_hz)) < 0) {
+        log_err("TX LO frequency yazılamadı.");
+        return false;
+    }
+    if (iio_channel_attr_write_longlong(phy_tx_ch_, "hardwaregain", -static_cast<long long>(cfg_.atten_db)) < 0) {
+        log_err("hardwaregain yazılamadı.");
+        return false;
+    }
+    return true;
+}
+
+bool PlutoSink::set_center_freq(uint64_t hz) {
+    if (!lo_ch_) return false;
+    std::lock_guard<std::mutex> lk(attr_m_);
+    if (iio_channel_attr_write_longlong(lo_ch_, "frequency", static_cast<long long>(hz)) < 0) return false;
+    cfg_.center_hz = hz;
+    return true;
+}
+
+bool PlutoSink::set_atten_db(int db) {
+    if (!phy_tx_ch_) return false;
+    std::lock_guard<std::mutex> lk(attr_m_);
+    if (iio_channel_attr_write_longlong(phy_tx_ch_, "hardwaregain", -static_cast<long long>(db)) < 0) return false;
+    cfg_.atten_db = db;
+    return true;
+}
+
+bool PlutoSink::start(std::shared_ptr<ITxProducer> producer) {
+    if (!ok() || !producer || cfg_.buffer_samples <= 0) return false;
+    stop();
+
+    if (cfg_.kernel_buffers > 0)
+        iio_device_set_kernel_buffers_count(txdev_, static_cast<unsigned int>(cfg_.kernel_buffers));
+    txbuf_ = iio_device_create_buffer(txdev_, static_cast<size_t>(cfg_.buffer_samples), false);
+    if (!txbuf_) { log_err("iio_device_create_buffer() başarısız."); return false; }
+    if (iio_buffer_step(txbuf_) != 4) {
+        log_err("TX tamponu I/Q cs16 değil (adım != 4).");
+        iio_buffer_destroy(txbuf_);
+        txbuf_ = nullptr;
+        return false;
+    }
+
+    prod_ = std::move(producer);
+    stop_.store(false);
+    finished_.store(false);
+    pushes_ = 0; samples_ = 0; prod_under_ = 0; queue_under_ = 0; push_err_ = 0;
+    push_hist_.reset(); intv_hist_.reset(); fill_hist_.reset();
+    running_.store(true, std::memory_order_release);
+    th_ = std::thread(&PlutoSink::push_loop, this);
+    return true;
+}
+
+void PlutoSink::stop() {
+    stop_.store(true);
+    if (txbuf_) iio_buffer_cancel(txbuf_);   // bloklu push'u kes
+    if (th_.joinable()) th_.join();
+    if (txbuf_) {
+        iio_buffer_destroy(txbuf_);
+        txbuf_ = nullptr;
+    }
+    prod_.reset();
+    running_.store(false, std::memory_order_release);
+}
+
+void PlutoSink::report(TxUnderrun::Kind k, uint64_t sample, uint64_t missing) {
+    const uint64_t n = (k == TxUnderrun::Kind::Producer ? prod_under_ : queue_under_).fetch_add(1) + 1;
+    if ((n & (n - 1)) == 0)   // 1, 2, 4, 8... log seli olmasın
+        std::fprintf(stderr, "[PlutoTx] underrun (%s) #%llu @%llu, %llu samples\n",
+                     k == TxUnderrun::Kind::Producer ? "producer" : "queue",
+                     static_cast<unsigned long long>(n), static_cast<unsigned long long>(sample),
+                     static_cast<unsigned long long>(missing));
+    if (on_underrun_) on_underrun_(TxUnderrun{k, sample, missing});
+}
+
+void PlutoSink::push_loop() {
+    const size_t n      = static_cast<size_t>(cfg_.buffer_samples);
+    const double fs_ns  = static_cast<double>(cfg_.samp_hz) * 1e-9;   // örnek / ns
+    const double full   = static_cast<double>(std::max(cfg_.kernel_buffers, 1)) * static_cast<double>(n);
+    const uint64_t blk_ns = static_cast<uint64_t>(static_cast<double>(n) / fs_ns);
+
+    // Kuyruk kestirimi: çapa anında q0 örnek kuyrukta; sonra pushlanan eklenir, tüketim düşülür
+    uint64_t anchor_ns = 0, last_done = 0;
+    double   q0 = 0.0, since = 0.0;
+    uint64_t total = 0;
+
+    while (!stop_.load(std::memory_order_relaxed)) {
+        auto* p = static_cast<int16_t*>(iio_buffer_start(txbuf_));
+
+        const uint64_t t_fill = now_ns();
+        const size_t got = prod_->fill(p, n);
+        const bool   eof = prod_->eof();
+        fill_hist_.record(now_ns() - t_fill);
+        if (got == 0 && eof) break;
+        if (got < n) {
+            std::memset(p + 2 * got, 0, (n - got) * 4);
+            if (!eof) report(TxUnderrun::Kind::Producer, total, n - got);
+        }
+
+        // Push öncesi (üretici gecikmesi) ve sonrası (push'ta uzun bekleme / thread askıda)
+        // kestirilen kuyruk boşalmışsa underrun; sonraki çapa yalnız bu blokla başlar
+        auto queued = [&](uint64_t t) {
+            return q0 + since - static_cast<double>(t - anchor_ns) * fs_ns;
+        };
+        const double slack = -0.25 * static_cast<double>(n);
+        const uint64_t t_push = now_ns();
+        if (anchor_ns && queued(t_push) < slack) {
+            report(TxUnderrun::Kind::Queue, total, static_cast<uint64_t>(-queued(t_push)));
+            anchor_ns = 0;
+        }
+
+        const ssize_t r = iio_buffer_push(txbuf_);
+        const uint64_t t_done = now_ns();
+        if (r < 0) {
+            if (stop_.load()) break;
+            push_err_.fetch_add(1, std::memory_order_relaxed);
+            log_err("iio_buffer_push() başarısız; TX durdu.");
+            break;
+        }
+        if (anchor_ns && queued(t_done) + static_cast<double>(n) < slack) {
+            report(TxUnderrun::Kind::Queue, total, static_cast<uint64_t>(-queued(t_done) - static_cast<double>(n)));
+            anchor_ns = 0;
+        }
+
+        // Normal süreli bloklu push: kuyruk dolu, çapa yenilenir (host/radyo saat kaymasını sıfırlar)
+        const uint64_t dur = t_done - t_push;
+        if (!anchor_ns)                                { anchor_ns = t_done; q0 = static_cast<double>(n); since = 0.0; }
+        else if (dur > blk_ns / 4 && dur < 2 * blk_ns) { anchor_ns = t_done; q0 = full; since = 0.0; }
+        else                                             since += static_cast<double>(n);
+
+        push_hist_.record(t_done - t_push);
+        if (last_done) intv_hist_.record(t_done - last_done);
+        last_done = t_done;
+        total += n;
+        pushes_.fetch_add(1, std::memory_order_relaxed);
+        samples_.store(total, std::memory_order_relaxed);
+        if (eof && got < n) break;
+    }
+    if (!stop_.load()) finished_.store(true);
+    running_.store(false, std::memory_order_release);
+}
+
+TxStats PlutoSink::stats() const {
+    TxStats s;
+    s.pushes             = pushes_.load();
+    s.samples            = samples_.load();
+    s.producer_underruns = prod_under_.load();
+    s.queue_underruns    = queue_under_.load();
+    s.push_errors        = push_err_.load();
+    s.running            = running_.load();
+    s.finished           = finished_.load();
+    return s;
+}
+
+} // namespace jd
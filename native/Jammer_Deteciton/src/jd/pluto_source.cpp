@@ -1,13 +1,25 @@
 // jd/pluto_source.cpp
 #include "jd/pluto_source.hpp"
+#include "jd/file_source.hpp"   // SigmfRecorder
+#include "jd/metrics.hpp"
 #include <cstdio>
 #include <cstring>
 #include <string>
+#include <algorithm>
 
 namespace jd {
 
 static void log_err(const char* msg) { std::fprintf(stderr, "[Pluto] %s\n", msg); }
 
+bool PlutoSource::write_attr_ll(AttrTarget at, const char* attr, long long val) {
+    switch (at) {
+        case AttrTarget::RxChan: return write_chan_ll(phy_rx_ch_, attr, val);
+        case AttrTarget::TxChan: return write_chan_ll(phy_tx_ch_, attr, val);
+        case AttrTarget::Device: return write_dev_ll(phy_, attr, val);
+        default: return false;
+    }
+}
+
 bool PlutoSource::write_dev_ll(iio_device* dev, const char* attr, long long val) {
     if (!dev) return false;
     return iio_device_attr_write_longlong(dev, attr, val) >= 0;
@@ -80,6 +92,10 @@ bool PlutoSource::init_context() {
         return false;
     }
 
+    // PHY kanal tutamaçları: her set_* çağrısında yeniden aranmasın
+    phy_rx_ch_ = iio_device_find_channel(phy_, "voltage0", false); // RX input
+    phy_tx_ch_ = iio_device_find_channel(phy_, "voltage0", true);  // bazı FW'lerde gerekir
+
     // 6) RX data kanalı: voltage0 (input=false)
     rx_ch_ = iio_device_find_channel(rxdev_, "voltage0", false);
     if (!rx_ch_) { log_err("RX dev üzerinde 'voltage0' kanalı yok."); return false; }
@@ -88,30 +104,23 @@ bool PlutoSource::init_context() {
 }
 
 bool PlutoSource::apply_static_config() {
-    // Kanallar
-    iio_channel* phy_rx_ch = iio_device_find_channel(phy_, "voltage0", false); // RX input
-    iio_channel* phy_tx_ch = iio_device_find_channel(phy_, "voltage0", true);  // bazı FW'lerde gerekir
-
-    auto try_set_rate = [&](long long hz) -> bool {
-        if (phy_rx_ch && iio_channel_attr_write_longlong(phy_rx_ch, "sampling_frequency", hz) >= 0) return true;
-        if (phy_tx_ch && iio_channel_attr_write_longlong(phy_tx_ch, "sampling_frequency", hz) >= 0) return true;
-        if (iio_device_attr_write_longlong(phy_, "sampling_frequency", hz) >= 0) return true;
-        return false;
-    };
-    auto try_set_rfbw = [&](long long hz) -> bool {
-        if (phy_rx_ch && iio_channel_attr_write_longlong(phy_rx_ch, "rf_bandwidth", hz) >= 0) return true;
-        if (phy_tx_ch && iio_channel_attr_write_longlong(phy_tx_ch, "rf_bandwidth", hz) >= 0) return true;
-        if (iio_device_attr_write_longlong(phy_, "rf_bandwidth", hz) >= 0) return true;
-        return false;
+    // Yazılabilen ilk hedefi bul ve sonraki değişimler için hatırla
+    auto pick_target = [&](const char* attr, long long val) -> AttrTarget {
+        if (write_chan_ll(phy_rx_ch_, attr, val)) return AttrTarget::RxChan;
+        if (write_chan_ll(phy_tx_ch_, attr, val)) return AttrTarget::TxChan;
+        if (write_dev_ll(phy_, attr, val))        return AttrTarget::Device;
+        return AttrTarget::None;
     };
 
     // 1) Sample rate
-    if (!try_set_rate(static_cast<long long>(cfg_.samp_hz))) {
+    rate_at_ = pick_target("sampling_frequency", static_cast<long long>(cfg_.samp_hz));
+    if (rate_at_ == AttrTarget::None) {
         std::fprintf(stderr, "[Pluto] sampling_frequency yazılamadı.\n");
         return false;
     }
     // 2) RF bandwidth
-    if (!try_set_rfbw(static_cast<long long>(cfg_.rfbw_hz))) {
+    rfbw_at_ = pick_target("rf_bandwidth", static_cast<long long>(cfg_.rfbw_hz));
+    if (rfbw_at_ == AttrTarget::None) {
         std::fprintf(stderr, "[Pluto] rf_bandwidth yazılamadı.\n");
         return false;
     }
@@ -121,15 +130,18 @@ bool PlutoSource::apply_static_config() {
         return false;
     }
     // 4) Gain: manual + dB
-    iio_channel* gain_ch = phy_rx_ch ? phy_rx_ch : iio_device_find_channel(phy_, "voltage0", false);
-    if (!gain_ch) { log_err("gain channel bulunamadı"); return false; }
-    if (!write_chan_str(gain_ch, "gain_control_mode", "manual")) { log_err("gain_control_mode=manual yazılamadı."); return false; }
-    if (!write_chan_ll (gain_ch, "hardwaregain", static_cast<long long>(cfg_.rx_gain_db))) { log_err("hardwaregain yazılamadı."); return false; }
+    if (!phy_rx_ch_) { log_err("gain channel bulunamadı"); return false; }
+    if (!write_chan_str(phy_rx_ch_, "gain_control_mode", "manual")) { log_err("gain_control_mode=manual yazılamadı."); return false; }
+    gain_mode_ = "manual";
+    if (!write_chan_ll (phy_rx_ch_, "hardwaregain", static_cast<long long>(cfg_.rx_gain_db))) { log_err("hardwaregain yazılamadı."); return false; }
 
     return true;
 }
 
 bool PlutoSource::alloc_buffer() {
+    // Retune sonrası atılacak eski tampon sayısı bu değere eşittir
+    if (cfg_.kernel_buffers > 0)
+        iio_device_set_kernel_buffers_count(rxdev_, static_cast<unsigned int>(cfg_.kernel_buffers));
     rxbuf_ = iio_device_create_buffer(rxdev_, cfg_.frame_len, false);
     if (!rxbuf_) { log_err("iio_device_create_buffer() başarısız."); return false; }
     return true;
@@ -138,8 +150,48 @@ bool PlutoSource::alloc_buffer() {
 bool PlutoSource::get_frame(std::vector<std::complex<float>>& out) {
     if (!rxbuf_) return false;
 
-    const ssize_t nbytes = iio_buffer_refill(rxbuf_);
-    if (nbytes <= 0) return false;
+    HotPathMetrics& hm = hot_metrics();
+
+    // Kontrol düzleminden gelen retune RX thread'inde uygulanır
+    if (pend_flag_.load(std::memory_order_acquire)) {
+        RetuneRequest rq;
+        {
+            std::lock_guard<std::mutex> lk(pend_m_);
+            rq = pend_;
+            pend_ = RetuneRequest{};
+            pend_flag_.store(false, std::memory_order_relaxed);
+        }
+        RetuneResult rr;
+        if (!retune(rq, &rr)) log_err("post_retune: ayar yazılamadı.");
+    }
+
+    // Retune öncesinden kalan tamponlar: Drain -> at, Tag -> işaretle
+    for (;;) {
+        const uint64_t t_req = now_ns();
+        const ssize_t nbytes = iio_buffer_refill(rxbuf_);
+        const uint64_t t_got = now_ns();
+        if (nbytes <= 0) { hm.refill_errors.fetch_add(1, std::memory_order_relaxed); return false; }
+        hm.record(Stage::Refill, t_got - t_req);
+        if (last_refill_ns_) hm.record(Stage::Interval, t_got - last_refill_ns_);
+        last_refill_ns_ = t_got;
+        if (stale_left_ > 0) {
+            --stale_left_;
+            ++timing_.stale_dropped;
+            hm.stale_frames.fetch_add(1, std::memory_order_relaxed);
+            if (cfg_.flush == RetuneFlush::Drain) continue;
+            last_stale_ = true;
+            frame_gen_  = gen_ - 1;
+        } else {
+            last_stale_ = false;
+            frame_gen_  = gen_;
+            if (awaiting_data_) {
+                awaiting_data_ = false;
+                timing_.to_data_ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - retune_t0_).count();
+            }
+        }
+        break;
+    }
 
     auto* start = reinterpret_cast<int16_t*>(iio_buffer_start(rxbuf_));
     auto* end   = reinterpret_cast<int16_t*>(iio_buffer_end(rxbuf_));
@@ -148,6 +200,10 @@ bool PlutoSource::get_frame(std::vector<std::complex<float>>& out) {
     const size_t take = (static_cast<size_t>(cfg_.frame_len) <= nsamples)
                         ? static_cast<size_t>(cfg_.frame_len) : nsamples;
 
+    if (rec_ && !last_stale_) rec_->write(start, take);
+
+    const uint64_t t_cv = now_ns();
+
     out.resize(static_cast<size_t>(cfg_.frame_len));
     const float scale = 1.0f / 32768.0f;
 
@@ -158,6 +214,7 @@ bool PlutoSource::get_frame(std::vector<std::complex<float>>& out) {
         out[i] = { i16 * scale, q16 * scale };
     }
     for (; i < static_cast<size_t>(cfg_.frame_len); ++i) out[i] = {0.0f, 0.0f};
+    hm.record(Stage::Convert, now_ns() - t_cv);
 
     return true;
 }
@@ -177,6 +234,8 @@ void PlutoSource::release() {
     rxdev_ = nullptr;
 
     // Referansları bırak
+    phy_rx_ch_ = nullptr;
+    phy_tx_ch_ = nullptr;
     phy_ = nullptr;
     lo_ch_ = nullptr;
     rx_open_.store(false);
@@ -238,39 +297,106 @@ void PlutoSource::set_timeout_ms(int ms) {
     if (ctx_) iio_context_set_timeout(ctx_, ms < 0 ? 0 : ms);
 }
 
+bool PlutoSource::retune(const RetuneRequest& req, RetuneResult* out) {
+    std::lock_guard<std::mutex> lk(m_);
+    if (!phy_) return false;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    bool ok = true;
+    bool lo_changed = false;
+
+    // Sıra: gain modu/kazanç -> bant genişliği -> LO (oturma süresi en uzun olan en sonda)
+    std::string mode = req.rx_gain_db ? std::string("manual") : req.gain_mode.value_or(gain_mode_);
+    if (mode != gain_mode_) {
+        if (write_chan_str(phy_rx_ch_, "gain_control_mode", mode.c_str())) gain_mode_ = mode;
+        else ok = false;
+    }
+    if (ok && req.rx_gain_db && *req.rx_gain_db != cfg_.rx_gain_db) {
+        if (write_chan_ll(phy_rx_ch_, "hardwaregain", static_cast<long long>(*req.rx_gain_db)))
+            cfg_.rx_gain_db = *req.rx_gain_db;
+        else ok = false;
+    }
+    if (ok && req.rfbw_hz && *req.rfbw_hz != cfg_.rfbw_hz) {
+        if (write_attr_ll(rfbw_at_, "rf_bandwidth", static_cast<long long>(*req.rfbw_hz)))
+            cfg_.rfbw_hz = *req.rfbw_hz;
+        else ok = false;
+    }
+    if (ok && req.center_hz && *req.center_hz != cfg_.center_hz) {
+        if (write_chan_ll(lo_ch_, "frequency", static_cast<long long>(*req.center_hz))) {
+            cfg_.center_hz = *req.center_hz;
+            lo_changed = true;
+            if (rec_) rec_->note_retune(static_cast<double>(*req.center_hz));
+        } else ok = false;
+    }
+
+    const auto t1 = std::chrono::steady_clock::now();
+    const double write_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+    // Eski frekansın tamponları: kernel kuyruğu + kullanıcıya map'li olan
+    if (lo_changed && rxbuf_) {
+        ++gen_;
+        retune_t0_      = t0;
+        awaiting_data_  = true;
+        timing_.stale_dropped = 0;
+        if (cfg_.flush == RetuneFlush::Recreate) {
+            iio_buffer_cancel(rxbuf_);
+            iio_buffer_destroy(rxbuf_);
+            rxbuf_ = iio_device_create_buffer(rxdev_, cfg_.frame_len, false);
+            stale_left_ = 0;
+            if (!rxbuf_) { log_err("retune: iio buffer yeniden oluşturulamadı."); ok = false; }
+        } else {
+            stale_left_ = std::max(1, cfg_.kernel_buffers);
+        }
+    }
+
+    timing_.write_ms = write_ms;
+    timing_.count++;
+
+    if (out) {
+        out->ok         = ok;
+        out->write_ms   = write_ms;
+        out->generation = gen_;
+    }
+    return ok;
+}
+
+RetuneTiming PlutoSource::retune_timing() const { return timing_; }
+
+void PlutoSource::post_retune(const RetuneRequest& req) {
+    std::lock_guard<std::mutex> lk(pend_m_);
+    if (req.center_hz)  pend_.center_hz  = req.center_hz;
+    if (req.rfbw_hz)    pend_.rfbw_hz    = req.rfbw_hz;
+    if (req.rx_gain_db) pend_.rx_gain_db = req.rx_gain_db;
+    if (req.gain_mode)  pend_.gain_mode  = req.gain_mode;
+    pend_flag_.store(true, std::memory_order_release);
+}
+
 bool PlutoSource::set_center_freq(uint64_t hz) {
-    if (!lo_ch_) return false;
-    if (!write_chan_ll(lo_ch_, "frequency", static_cast<long long>(hz))) return false;
-    cfg_.center_hz = hz;
-    return true;
+    RetuneRequest r;
+    r.center_hz = hz;
+    return retune(r);
 }
 bool PlutoSource::set_rf_bw(uint64_t hz) {
-    iio_channel* phy_rx_ch = iio_device_find_channel(phy_, "voltage0", false);
-    if (phy_rx_ch) {
-        if (!write_chan_ll(phy_rx_ch, "rf_bandwidth", static_cast<long long>(hz))) return false;
-    } else {
-        if (!write_dev_ll(phy_, "rf_bandwidth", static_cast<long long>(hz))) return false;
-    }
-    cfg_.rfbw_hz = hz;
-    return true;
+    RetuneRequest r;
+    r.rfbw_hz = hz;
+    return retune(r);
 }
 bool PlutoSource::set_sample_rate(uint64_t hz) {
-    if (!write_dev_ll(phy_, "sampling_frequency", static_cast<long long>(hz))) return false;
+    std::lock_guard<std::mutex> lk(m_);
+    if (!write_attr_ll(rate_at_, "sampling_frequency", static_cast<long long>(hz))) return false;
     cfg_.samp_hz = hz;
     return true;
 }
 bool PlutoSource::set_rx_gain_db(int db) {
-    iio_channel* phy_rx_ch = iio_device_find_channel(phy_, "voltage0", false);
-    if (!phy_rx_ch) return false;
-    if (!write_chan_str(phy_rx_ch, "gain_control_mode", "manual")) return false;
-    if (!write_chan_ll (phy_rx_ch, "hardwaregain", static_cast<long long>(db))) return false;
-    cfg_.rx_gain_db = db;
-    return true;
+    RetuneRequest r;
+    r.rx_gain_db = db;
+    return retune(r);
 }
 bool PlutoSource::set_gain_mode(const char* mode) {
-    iio_channel* phy_rx_ch = iio_device_find_channel(phy_, "voltage0", false);
-    if (!phy_rx_ch) return false;
-    return write_chan_str(phy_rx_ch, "gain_control_mode", mode);
+    if (!mode) return false;
+    RetuneRequest r;
+    r.gain_mode = std::string(mode);
+    return retune(r);
 }
 
 } // namespace jd
@@ -0,0 +1,101 @@
+// jd/scanner.cpp
+#include "jd/scanner.hpp"
+#include "jd/utils.hpp"   // TicToc
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+
+namespace jd {
+
+Scanner::Scanner(ISource& src, TuneFn tune, PowerMeter pm, ScanConfig cfg)
+    : src_(src), tune_(std::move(tune)), pm_(std::move(pm)), cfg_(std::move(cfg)) {
+    table_.reserve(cfg_.freqs_hz.size());
+    for (uint64_t hz : cfg_.freqs_hz) {
+        ScanEntry e;
+        e.hz = hz;
+        table_.push_back(e);
+    }
+    cfg_.dwell_frames      = std::max(1, cfg_.dwell_frames);
+    cfg_.max_settle_frames = std::max(1, cfg_.max_settle_frames);
+    settle_ = std::clamp(cfg_.settle_frames, 0, cfg_.max_settle_frames);
+    // Settle ayrıca ölçülüp atıldığından dwell yalnız karar için gereken geçerli
+    // frameleri kapsar; dwell_frames bunun üst sınırıdır.
+    dwell_ = cfg_.auto_dwell ? std::clamp(cfg_.required_frames, 1, cfg_.dwell_frames) : cfg_.dwell_frames;
+}
+
+bool Scanner::visit(ScanEntry& e) {
+    TicToc t; t.tic();
+    if (!tune_(e.hz)) {
+        std::fprintf(stderr, "[SCAN] retune %llu Hz başarısız.\n", static_cast<unsigned long long>(e.hz));
+        return true; // bu frekansı atla, taramaya devam
+    }
+
+    // Retune -> geçerli veri: önceki frekanstan tamponda kalan ve LO oturmamış
+    // frameler güçte sıçrama yapar; ardışık iki frame tol içinde kalınca geçerli say.
+    // auto_settle kapalıysa sabit settle_ kadar frame atılır.
+    int dropped = 0;
+    double prev = std::nan("");
+    double pd   = 0.0;
+    const int limit = cfg_.auto_settle ? cfg_.max_settle_frames : settle_;
+    for (;;) {
+        if (!src_.get_frame(frame_)) return false;
+        if (src_.last_frame_stale()) continue;   // Tag: eski tampon, settle sayımına girmez
+        pd = pm_.power_dbm(frame_);
+        if (cfg_.auto_settle) {
+            if (dropped >= settle_ && !std::isnan(prev) && std::fabs(pd - prev) < cfg_.settle_tol_db) break;
+        } else if (dropped >= settle_) {
+            break;
+        }
+        if (dropped >= limit) break;
+        prev = pd;
+        ++dropped;
+    }
+    const double ms = t.toc_ms();
+
+    rs_.count++;
+    rs_.mean_ms     += (ms - rs_.mean_ms) / static_cast<double>(rs_.count);
+    rs_.max_ms       = std::max(rs_.max_ms, ms);
+    rs_.mean_frames  = (rs_.count == 1) ? dropped : (0.9 * rs_.mean_frames + 0.1 * dropped);
+    if (cfg_.auto_settle) {
+        // Sonraki ziyarette (ortalama - 1) frame koşulsuz atılır, kalanı yakınsama ile beklenir
+        settle_ = std::clamp(static_cast<int>(std::ceil(rs_.mean_frames)) - 1, 0, cfg_.max_settle_frames);
+    }
+
+    // Dwell: ilk geçerli frame dahil ortalama güç
+    double acc = std::pow(10.0, pd / 10.0);
+    int n = 1;
+    while (n < dwell_) {
+        if (!src_.get_frame(frame_)) return false;
+        if (src_.last_frame_stale()) continue;
+        acc += std::pow(10.0, pm_.power_dbm(frame_) / 10.0);
+        ++n;
+    }
+    const double dwell_dbm = 10.0 * std::log10(acc / n);
+
+    e.ewma_dbm = (e.visits == 0)
+        ? static_cast<float>(dwell_dbm)
+        : static_cast<float>(e.ewma_dbm + cfg_.ewma_alpha * (dwell_dbm - e.ewma_dbm));
+    if (e.visits < UINT16_MAX) ++e.visits;
+    e.jammed = (e.ewma_dbm > cfg_.threshold_dbm) ? 1 : 0;
+    return true;
+}
+
+bool Scanner::sweep() {
+    for (auto& e : table_) {
+        if (!visit(e)) return false;
+    }
+    ++sweeps_;
+    return true;
+}
+
+std::vector<int> Scanner::ranked() const {
+    std::vector<int> idx(table_.size());
+    for (size_t i = 0; i < idx.size(); ++i) idx[i] = static_cast<int>(i);
+    std::stable_sort(idx.begin(), idx.end(), [&](int a, int b) {
+        if (table_[a].jammed != table_[b].jammed) return table_[a].jammed < table_[b].jammed;
+        return table_[a].ewma_dbm < table_[b].ewma_dbm;
+    });
+    return idx;
+}
+
+} // namespace jd
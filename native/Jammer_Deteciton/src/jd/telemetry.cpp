@@ -0,0 +1,146 @@
+// jd/telemetry.cpp
+#include "jd/telemetry.hpp"
+#include "jd/counter.hpp"
+#include "jd/event_ring.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace jd {
+
+static_assert(kJdxStages == static_cast<int>(Stage::Count), "JdxTelemetryV2 stage table");
+static_assert(sizeof(JdxTelemetryV2) == 136, "JdxTelemetryV2 layout");
+static_assert(sizeof(EvTelemetryV1) <= sizeof(EventRecord::payload), "EvTelemetryV1 size");
+
+static int16_t to_cdbm(double dbm) {
+    if (!(dbm == dbm)) return INT16_MIN;
+    return static_cast<int16_t>(std::clamp(std::lround(dbm * 100.0), -32767L, 32767L));
+}
+
+Telemetry& Telemetry::instance() {
+    static Telemetry t;
+    return t;
+}
+
+void Telemetry::start(const TelemetryConfig& cfg, UdpIndex* udp, const Counter* ctr) {
+    cfg_ = cfg;
+    cfg_.max_frames = std::clamp(cfg.max_frames, 1, 255);
+    udp_ = udp;
+    ctr_ = ctr;
+    ring_.reset(new JdxTelemetryFrameV2[cfg_.max_frames]);
+    ring_frame_.reset(new uint64_t[cfg_.max_frames]);
+    out_.reset(new JdxTelemetryFrameV2[cfg_.max_frames]);
+    prev_.reset(new std::array<LatencyHistogram::Snapshot, kJdxStages>());
+    cur_.reset(new std::array<LatencyHistogram::Snapshot, kJdxStages>());
+    for (int s = 0; s < kJdxStages; ++s) (*prev_)[s] = hot_metrics().stage[s].snapshot();
+
+    const int64_t m0 = static_cast<int64_t>(now_ns());
+    const int64_t u  = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const int64_t m1 = static_cast<int64_t>(now_ns());
+    unix_off_ = u - (m0 + (m1 - m0) / 2);
+    n_ = 0;
+    on_ = cfg_.period_ms > 0;
+}
+
+void Telemetry::stop() { on_ = false; }
+
+void Telemetry::frame(uint64_t frame, double power_dbm, double threshold_dbm, bool jammed) {
+    if (!on_) return;
+    const uint64_t t = now_ns();
+    const bool over = power_dbm > threshold_dbm;
+    if (n_ == 0) {
+        t0_ = t; over_ = 0; acc_ = 0.0;
+        min_ = max_ = power_dbm;
+    }
+    const int cap = cfg_.max_frames;
+    JdxTelemetryFrameV2& e = ring_[n_ % static_cast<uint32_t>(cap)];
+    e.dt_us = static_cast<uint32_t>(std::min<uint64_t>((t - t0_) / 1000, UINT32_MAX));
+    e.cdbm  = to_cdbm(power_dbm);
+    e.flags = static_cast<uint8_t>((over ? 1 : 0) | (jammed ? 2 : 0));
+    ring_frame_[n_ % static_cast<uint32_t>(cap)] = frame;
+    ++n_;
+    if (over) ++over_;
+    min_ = std::min(min_, power_dbm);
+    max_ = std::max(max_, power_dbm);
+    acc_ += power_dbm;
+    thr_ = threshold_dbm;
+    jam_ = jammed;
+
+    if (t - t0_ >= static_cast<uint64_t>(cfg_.period_ms) * 1000000ull) flush(t);
+}
+
+// Periyot farkı: kümülatif histogramlardan bu periyodun kovaları
+void Telemetry::stage_delta(JdxTelemetryV2& h) {
+    HotPathMetrics& hm = hot_metrics();
+    for (int s = 0; s < kJdxStages; ++s) {
+        LatencyHistogram::Snapshot& c = (*cur_)[s];
+        const LatencyHistogram::Snapshot& p = (*prev_)[s];
+        c = hm.stage[s].snapshot();
+        LatencyHistogram::Snapshot d;
+        if (c.count >= p.count) {      // STATS RESET arada olduysa fark yerine güncel değer
+            d.count = c.count - p.count;
+            for (int i = 0; i < LatencyHistogram::kBuckets; ++i)
+                d.buckets[i] = c.buckets[i] >= p.buckets[i] ? c.buckets[i] - p.buckets[i] : 0;
+        } else {
+            d.count   = c.count;
+            d.buckets = c.buckets;
+        }
+        d.max_ns = c.max_ns;
+        h.stage_p50_us[s] = static_cast<uint32_t>(d.percentile_us(50.0));
+        h.stage_p99_us[s] = static_cast<uint32_t>(d.percentile_us(99.0));
+    }
+    prev_.swap(cur_);
+}
+
+void Telemetry::flush(uint64_t t) {
+    const uint32_t cap = static_cast<uint32_t>(cfg_.max_frames);
+    const uint32_t cnt = std::min(n_, cap);
+    const uint32_t beg = n_ - cnt;                  // son cnt girdi, eskiden yeniye
+    for (uint32_t i = 0; i < cnt; ++i) out_[i] = ring_[(beg + i) % cap];
+
+    JdxTelemetryV2 h{};
+    h.header_size = static_cast<uint16_t>(sizeof(h));
+    h.pkt         = ++pkt_;
+    h.t0_ns       = static_cast<int64_t>(t0_);
+    h.t_ns        = static_cast<int64_t>(t);
+    h.unix_off_ns = unix_off_;
+    h.first_frame = ring_frame_[beg % cap];
+    h.frames      = n_;
+    h.over        = over_;
+    h.thr_cdbm    = to_cdbm(thr_);
+    h.min_cdbm    = to_cdbm(min_);
+    h.mean_cdbm   = to_cdbm(acc_ / n_);
+    h.max_cdbm    = to_cdbm(max_);
+    h.count       = static_cast<uint8_t>(cnt);
+    const bool active = ctr_ && ctr_->active();
+    h.state       = static_cast<uint8_t>((jam_ ? 1 : 0) | (active ? 2 : 0));
+    if (ctr_) {
+        h.session = ctr_->seq();
+        uint64_t slot = 0;
+        if (active && ctr_->clock().slot_at(HopClock::now(), slot)) {
+            h.hop_slot  = slot;
+            h.hop_value = static_cast<int16_t>(ctr_->clock().value(slot));
+        }
+    }
+    stage_delta(h);
+    // Girdiler son cnt frame'i kapsar; dt_us'ler periyot başına (t0) göredir
+    if (udp_) udp_->publish_telemetry(h, out_.get());
+
+    EvTelemetryV1 e{};
+    e.pkt = h.pkt; e.session = h.session; e.hop_slot = h.hop_slot;
+    e.frames = h.frames; e.over = h.over;
+    e.threshold_dbm = static_cast<float>(thr_);
+    e.min_dbm  = static_cast<float>(min_);
+    e.mean_dbm = static_cast<float>(acc_ / n_);
+    e.max_dbm  = static_cast<float>(max_);
+    e.frame_p99_us = h.stage_p99_us[static_cast<int>(Stage::Frame)];
+    e.hop_value = h.hop_value;
+    e.state = h.state;
+    events().publish(EventType::Telemetry, &e, sizeof(e));
+
+    n_ = 0;
+}
+
+} // namespace jd
@@ -1,5 +1,6 @@
 #include "jd/udp_index.hpp"
 #include <cstring>
+#include <vector>
 
 #ifdef _WIN32
   #include <winsock2.h>
@@ -66,6 +67,11 @@ void UdpIndex::tick(const Counter& ctr) {
     send(JdxState::TICK, ctr.seq(), static_cast<uint64_t>(val));
 }
 
+void UdpIndex::tick(const Counter& ctr, uint64_t slot) {
+    if (!ctr.active()) return;
+    send(JdxState::TICK, ctr.seq(), static_cast<uint64_t>(ctr.clock().value(slot)));
+}
+
 void UdpIndex::stop(const Counter& ctr) {
     int val=0;
     if (!ctr.current_value(val)) return;
@@ -86,4 +92,35 @@ void UdpIndex::send(JdxState st, uint64_t seq, uint64_t val) {
 #endif
 }
 
+void UdpIndex::publish_ranking(uint64_t sweep, const JdxRankEntryV1* entries, uint16_t count) {
+    if (!_ok) return;
+    JdxRankHeaderV1 h{};
+    h.sweep = sweep;
+    h.count = count;
+
+    std::vector<uint8_t> buf(sizeof(h) + sizeof(JdxRankEntryV1) * count);
+    std::memcpy(buf.data(), &h, sizeof(h));
+    if (count) std::memcpy(buf.data() + sizeof(h), entries, sizeof(JdxRankEntryV1) * count);
+
+#ifdef _WIN32
+    ::send((SOCKET)_fd, reinterpret_cast<const char*>(buf.data()), (int)buf.size(), 0);
+#else
+    ::send(_fd, buf.data(), buf.size(), 0);
+#endif
+}
+
+void UdpIndex::publish_telemetry(const JdxTelemetryV2& h, const JdxTelemetryFrameV2* frames) {
+    if (!_ok) return;
+    uint8_t buf[sizeof(JdxTelemetryV2) + sizeof(JdxTelemetryFrameV2) * 255];
+    const size_t n = sizeof(h) + sizeof(JdxTelemetryFrameV2) * h.count;
+    std::memcpy(buf, &h, sizeof(h));
+    if (h.count) std::memcpy(buf + sizeof(h), frames, sizeof(JdxTelemetryFrameV2) * h.count);
+
+#ifdef _WIN32
+    ::send((SOCKET)_fd, reinterpret_cast<const char*>(buf), (int)n, 0);
+#else
+    ::send(_fd, buf, n, 0);
+#endif
+}
+
 } // namespace jd
@@ -3,9 +3,23 @@
 #include "jd/jammer_detector.hpp"
 #include "jd/config.hpp"
 #include "jd/counter.hpp"
+#include "jd/hop_clock.hpp"
 #include "jd/udp_index.hpp"
+#include "jd/channelizer.hpp"
+#include "jd/scanner.hpp"
+#include "jd/file_source.hpp"
+#include "jd/metrics.hpp"
+#include "jd/logger.hpp"
+#include "jd/jammer_tracker.hpp"
+#include "jd/control_plane.hpp"
+#include "jd/event_ring.hpp"
+#include "jd/telemetry.hpp"
+#ifdef JD_MOCK_IIO
+  #include "iio_mock.hpp"
+#endif
 
 #include <string>
+#include <vector>
 #include <cstring>
 #include <cstdlib>
 #include <cstdio>
@@ -14,21 +28,11 @@
 #include <atomic>
 #include <chrono>
 #include <csignal>
-
-#ifdef _WIN32
-  #include <winsock2.h>
-  #include <ws2tcpip.h>
-  #pragma comment(lib, "Ws2_32.lib")
-  static bool g_wsastarted=false;
-  static void wsainit(){ if(!g_wsastarted){ WSADATA w; WSAStartup(MAKEWORD(2,2), &w); g_wsastarted=true; } }
-  static void closesock(SOCKET s){ if(s!=INVALID_SOCKET) ::closesocket(s); }
-#else
-  #include <unistd.h>
-  #include <fcntl.h>
-  #include <arpa/inet.h>
-  #include <sys/socket.h>
-  static void closesock(int s){ if(s>=0) ::close(s); }
-#endif
+#include <memory>
+#include <mutex>
+#include <cctype>
+#include <algorithm>
+#include <cmath>
 
 // ------------------------------------------------------------
 // Basit CLI
@@ -39,6 +43,51 @@ struct CliRadio {
     double      rfbw  = 4e6;       // Hz
     int         gain  = -20;       // dB
     int         fsize = 4096;      // samples per frame
+    int         kbufs = 4;         // iio kernel tampon sayısı
+    jd::RetuneFlush flush = jd::RetuneFlush::Drain;
+
+    // Kayıt / kayıttan oynatma
+    std::string replay;              // .sigmf-meta | .sigmf-data | ham dosya (boş: Pluto)
+    jd::SampleFormat replay_fmt = jd::SampleFormat::CS16;
+    bool        replay_rt   = false; // gerçek zaman temposu
+    bool        replay_loop = false;
+    std::string record;              // SigMF kayıt taban yolu (boş: kapalı)
+
+    // Kanalizer (boşsa tek kanal güç tespiti)
+    std::vector<uint64_t> channels;  // FHSS kanal frekansları (Hz)
+    int         chz_m    = 64;       // kanal sayısı (2'nin kuvveti)
+    int         chz_taps = 8;        // dal başına tap
+
+    // Tarama modu (boşsa sabit frekans)
+    std::vector<uint64_t> scan;      // hop tablosu (Hz)
+    int         dwell      = 8;      // frekans başına frame (auto_dwell: üst sınır)
+    bool        auto_dwell = true;   // dwell = --detect-consec
+    int         settle     = 2;      // retune sonrası başlangıç atılan frame
+    bool        auto_settle= true;
+    double      scan_alpha = 0.25;   // EWMA katsayısı
+    int         rank_port  = 6001;   // sıralı temiz kanal listesi UDP portu
+
+    // Sürekli mod (histerezisli START/STOP, cihaz açık kalır)
+    bool        continuous   = false;
+    double      on_margin    = 0.0;    // dB, eşik üstü giriş payı
+    double      off_margin   = 1.0;    // dB, eşik altı çıkış payı
+    int         on_frames    = -1;     // -1: --detect-consec
+    int         off_frames   = 10;
+    double      min_dwell_ms = 200.0;
+
+    // Hop saati (JDX TICK değeri)
+    jd::HopConfig hop;
+
+    // Paylaşımlı bellek olay halkası (boş ad: kapalı)
+    jd::EventRingConfig events;
+
+    // Telemetri V2 (JDX2 datagramı, ayrı port)
+    jd::TelemetryConfig telem;
+    int         telem_port = 6002;
+
+    // Log
+    jd::LogLevel log_level  = jd::LogLevel::Info;
+    int         log_summary_ms = 1000; // güç özeti periyodu
 };
 
 static bool looks_number(const char* s) {
@@ -48,6 +97,25 @@ static bool looks_number(const char* s) {
     return end && *end=='\0';
 }
 
+// "2.402e9,2.412e9,..." -> Hz listesi
+static bool parse_freq_list(const char* s, std::vector<uint64_t>& out) {
+    out.clear();
+    std::string item;
+    for (const char* c = s; ; ++c) {
+        if (*c == ',' || *c == '\0') {
+            if (!item.empty()) {
+                if (!looks_number(item.c_str())) return false;
+                out.push_back(static_cast<uint64_t>(std::strtod(item.c_str(), nullptr)));
+                item.clear();
+            }
+            if (*c == '\0') break;
+        } else if (*c != ' ') {
+            item.push_back(*c);
+        }
+    }
+    return !out.empty();
+}
+
 static void print_help() {
     std::puts(
 "Usage: jammer_detect [options] | [gain]\n"
@@ -59,6 +127,33 @@ static void print_help() {
 "   -b, --rfbw <Hz>           RF bandwidth (e.g. 4e6)\n"
 "       --uri <str>           iio uri (ip:192.168.2.1 | usb:)\n"
 "   -n, --framesize <int>     samples per frame (default 4096)\n"
+"       --kbufs <int>         iio kernel buffers (default 4)\n"
+"       --retune-flush <m>    stale buffers after retune: drain|tag|recreate (default drain)\n"
+#ifdef JD_MOCK_IIO
+"       --mock <spec>         mock iio signal, e.g. noise=-60,tone=<Hz>:<dBFS>,burst=<Hz>:<dBFS>:<on_ms>:<period_ms>\n"
+"                             (also JD_MOCK_IIO env; keys: realtime latency_us attr_latency_us fail_after fail_prob seed)\n"
+#endif
+"\n"
+" Record / replay (SigMF):\n"
+"       --replay <path>       replay .sigmf-meta/.sigmf-data or raw capture instead of Pluto\n"
+"       --replay-fmt <f>      raw file format without meta: cs16|cf32 (default cs16)\n"
+"       --replay-rt           pace replay at the recorded sample rate\n"
+"       --loop                restart replay at end of file\n"
+"       --record <base>       record RX to <base>.sigmf-data/.sigmf-meta\n"
+"\n"
+" Channelizer (wideband, one capture -> all FHSS channels):\n"
+"       --channels <list>     comma separated channel centers in Hz\n"
+"       --chz-m <int>         filterbank channels M, power of two (default 64)\n"
+"       --chz-taps <int>      taps per polyphase branch (default 8)\n"
+"\n"
+" Scan (sweep the hop table, publish ranked clean channels):\n"
+"       --scan <list>         comma separated frequencies in Hz\n"
+"       --dwell <int>         max frames measured per frequency (default 8)\n"
+"       --fixed-dwell         always measure --dwell frames instead of --detect-consec\n"
+"       --settle <int>        frames dropped after retune (default 2)\n"
+"       --fixed-settle        disable automatic settle minimisation\n"
+"       --scan-alpha <dbl>    per-frequency EWMA alpha (default 0.25)\n"
+"       --rank-port <int>     UDP port for ranking on 127.0.0.1 (default 6001)\n"
 "\n"
 " Calibration:\n"
 "   -T, --calib-secs <dbl>    target seconds (default 5.0)\n"
@@ -82,8 +177,43 @@ static void print_help() {
 "       --detect-consec <int> consecutive positives (default 5)\n"
 "       --detect-max <int>    max detection frames (default 1500)\n"
 "\n"
-" Control:\n"
-"       Program STOP icin UDP 127.0.0.1:25000'a 'STOP' gonderin (veya Ctrl+C).\n"
+" Continuous mode (track onset/offset until STOP, UDP START/STOP per transition):\n"
+"       --continuous          keep the device open and track jammer state\n"
+"       --on-margin <dB>      enter JAMMED above threshold+margin (default 0)\n"
+"       --off-margin <dB>     leave JAMMED below threshold-margin (default 1)\n"
+"       --on-frames <int>     consecutive frames to enter (default --detect-consec)\n"
+"       --off-frames <int>    consecutive frames to leave (default 10)\n"
+"       --min-dwell-ms <dbl>  minimum time in a state before switching (default 200)\n"
+"\n"
+" Hop clock (JDX TICK value; TX/RX with the same settings derive the same slot):\n"
+"       --hop-key <u64>       keyed hop sequence (0x.. ok); 0 = legacy 1,3,5,4,2 (default 0)\n"
+"       --hop-dwell-ms <dbl>  slot length, >= 1 ms (default 1000)\n"
+"       --hop-channels <int>  values 1..N with a key, 2..256 (default 5)\n"
+"       --hop-epoch <ns|now>  shared epoch in UNIX ns; 'now' prints it (default: detection time)\n"
+"       --hop-refresh-ms <n>  repeat TICK within a slot, 0 = boundaries only (default 100)\n"
+"\n"
+" Shared-memory events (detections, power, hop slots; reader: services/jd_events.py):\n"
+"       --events <name|off>   segment name (default jd_events; /dev/shm/<name> on Linux)\n"
+"       --events-cap <int>    ring records, power of two (default 4096)\n"
+"       --events-power <int>  one power event every N frames, 0 = off (default 1)\n"
+"\n"
+" Telemetry V2 (JDX2: last N frame powers, threshold, state, stage latency; V1 unchanged):\n"
+"       --telemetry-ms <int>  packet period, 0 = off (default 100)\n"
+"       --telemetry-frames <n> frame entries per packet, 1..255 (default 32)\n"
+"       --telemetry-port <n>  UDP port on 127.0.0.1 (default 6002)\n"
+"\n"
+" Logging (async; per-frame lines only on state changes):\n"
+"       --log-level <l>       debug|info|warn|error|off (default info)\n"
+"       --log-summary-ms <n>  power min/mean/max summary period, 0=off (default 1000)\n"
+"\n"
+" Control (UDP 127.0.0.1:25000, cevap gonderene 'OK ...' / 'ERR ...'):\n"
+"       STOP | EXIT | QUIT    programi durdur (veya Ctrl+C)\n"
+"       STATS [RESET]         JSON asama gecikme histogramlari\n"
+"       PING                  'PONG'\n"
+"       THRESHOLD [dBm]       tespit esigini oku/degistir (tek kanal modlari)\n"
+"       RETUNE <hz> [gain]    RX LO (ve kazanc) degistir; tespit surerken, yalniz Pluto\n"
+"       GAIN <dB> | RFBW <hz> RX kazanc / RF bant genisligi\n"
+"       HOPCLOCK              hop saati ayari, epoch, guncel slot ve zamanlayici gecikmesi\n"
     );
 }
 
@@ -102,6 +232,78 @@ static bool parse_cli(int argc, char** argv, CliRadio& r, jd::Params& p) {
         else if (a=="-b"||a=="--rfbw")       { if(!need(a.c_str())) return false; r.rfbw  = std::strtod(argv[++i], nullptr); }
         else if (a=="--uri")                 { if(!need(a.c_str())) return false; r.uri   = argv[++i]; }
         else if (a=="-n"||a=="--framesize")  { if(!need(a.c_str())) return false; r.fsize = std::atoi(argv[++i]); }
+        else if (a=="--kbufs")               { if(!need(a.c_str())) return false; r.kbufs = std::atoi(argv[++i]); }
+        else if (a=="--retune-flush")        { if(!need(a.c_str())) return false;
+                                               std::string m = argv[++i];
+                                               if      (m=="drain")    r.flush = jd::RetuneFlush::Drain;
+                                               else if (m=="tag")      r.flush = jd::RetuneFlush::Tag;
+                                               else if (m=="recreate") r.flush = jd::RetuneFlush::Recreate;
+                                               else { std::fprintf(stderr,"bad --retune-flush: %s\n", m.c_str()); return false; } }
+#ifdef JD_MOCK_IIO
+        else if (a=="--mock")               { if(!need(a.c_str())) return false;
+                                               jd::mock::MockIioConfig mc;
+                                               if(!jd::mock::parse_config(argv[++i], mc)) { std::fprintf(stderr,"bad --mock spec\n"); return false; }
+                                               jd::mock::configure(mc); }
+#endif
+        else if (a=="--replay")             { if(!need(a.c_str())) return false; r.replay = argv[++i]; }
+        else if (a=="--replay-fmt")         { if(!need(a.c_str())) return false;
+                                               std::string f = argv[++i];
+                                               if      (f=="cs16") r.replay_fmt = jd::SampleFormat::CS16;
+                                               else if (f=="cf32") r.replay_fmt = jd::SampleFormat::CF32;
+                                               else { std::fprintf(stderr,"bad --replay-fmt: %s\n", f.c_str()); return false; } }
+        else if (a=="--replay-rt")          { r.replay_rt = true; }
+        else if (a=="--loop")               { r.replay_loop = true; }
+        else if (a=="--record")             { if(!need(a.c_str())) return false; r.record = argv[++i]; }
+        else if (a=="--channels")           { if(!need(a.c_str())) return false;
+                                               if(!parse_freq_list(argv[++i], r.channels)) { std::fprintf(stderr,"bad --channels list\n"); return false; } }
+        else if (a=="--chz-m")              { if(!need(a.c_str())) return false; r.chz_m    = std::atoi(argv[++i]); }
+        else if (a=="--chz-taps")           { if(!need(a.c_str())) return false; r.chz_taps = std::atoi(argv[++i]); }
+        else if (a=="--scan")               { if(!need(a.c_str())) return false;
+                                               if(!parse_freq_list(argv[++i], r.scan)) { std::fprintf(stderr,"bad --scan list\n"); return false; } }
+        else if (a=="--dwell")              { if(!need(a.c_str())) return false; r.dwell      = std::atoi(argv[++i]); }
+        else if (a=="--settle")             { if(!need(a.c_str())) return false; r.settle     = std::atoi(argv[++i]); }
+        else if (a=="--fixed-settle")       { r.auto_settle = false; }
+        else if (a=="--fixed-dwell")        { r.auto_dwell = false; }
+        else if (a=="--scan-alpha")         { if(!need(a.c_str())) return false; r.scan_alpha = std::strtod(argv[++i], nullptr); }
+        else if (a=="--continuous")         { r.continuous = true; }
+        else if (a=="--on-margin")          { if(!need(a.c_str())) return false; r.on_margin    = std::strtod(argv[++i], nullptr); }
+        else if (a=="--off-margin")         { if(!need(a.c_str())) return false; r.off_margin   = std::strtod(argv[++i], nullptr); }
+        else if (a=="--on-frames")          { if(!need(a.c_str())) return false; r.on_frames    = std::atoi(argv[++i]); }
+        else if (a=="--off-frames")         { if(!need(a.c_str())) return false; r.off_frames   = std::atoi(argv[++i]); }
+        else if (a=="--min-dwell-ms")       { if(!need(a.c_str())) return false; r.min_dwell_ms = std::strtod(argv[++i], nullptr); }
+        else if (a=="--hop-key")            { if(!need(a.c_str())) return false; r.hop.key = std::strtoull(argv[++i], nullptr, 0); }
+        else if (a=="--hop-dwell-ms")       { if(!need(a.c_str())) return false;
+                                               const double ms = std::strtod(argv[++i], nullptr);
+                                               if (ms < 1.0) { std::fprintf(stderr,"bad --hop-dwell-ms (>= 1)\n"); return false; }
+                                               r.hop.dwell_us = static_cast<uint32_t>(ms * 1000.0 + 0.5); }
+        else if (a=="--hop-channels")       { if(!need(a.c_str())) return false; r.hop.channels = std::atoi(argv[++i]); }
+        else if (a=="--hop-epoch")          { if(!need(a.c_str())) return false;
+                                               std::string e = argv[++i];
+                                               if (e == "now") {
+                                                   r.hop.epoch_unix_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                       std::chrono::system_clock::now().time_since_epoch()).count();
+                                               } else if (looks_number(e.c_str())) {
+                                                   r.hop.epoch_unix_ns = std::strtoll(e.c_str(), nullptr, 10);
+                                               } else { std::fprintf(stderr,"bad --hop-epoch: %s\n", e.c_str()); return false; } }
+        else if (a=="--hop-refresh-ms")     { if(!need(a.c_str())) return false; r.hop.refresh_ms = std::atoi(argv[++i]); }
+        else if (a=="--events")             { if(!need(a.c_str())) return false;
+                                               r.events.name = argv[++i];
+                                               if (r.events.name == "off") r.events.name.clear(); }
+        else if (a=="--events-cap")         { if(!need(a.c_str())) return false; r.events.capacity    = static_cast<uint32_t>(std::atoi(argv[++i])); }
+        else if (a=="--events-power")       { if(!need(a.c_str())) return false; r.events.power_every = std::atoi(argv[++i]); }
+        else if (a=="--telemetry-ms")       { if(!need(a.c_str())) return false; r.telem.period_ms  = std::atoi(argv[++i]); }
+        else if (a=="--telemetry-frames")   { if(!need(a.c_str())) return false; r.telem.max_frames = std::atoi(argv[++i]); }
+        else if (a=="--telemetry-port")     { if(!need(a.c_str())) return false; r.telem_port       = std::atoi(argv[++i]); }
+        else if (a=="--log-level")          { if(!need(a.c_str())) return false;
+                                               std::string l = argv[++i];
+                                               if      (l=="debug") r.log_level = jd::LogLevel::Debug;
+                                               else if (l=="info")  r.log_level = jd::LogLevel::Info;
+                                               else if (l=="warn")  r.log_level = jd::LogLevel::Warn;
+                                               else if (l=="error") r.log_level = jd::LogLevel::Error;
+                                               else if (l=="off")   r.log_level = jd::LogLevel::Off;
+                                               else { std::fprintf(stderr,"bad --log-level: %s\n", l.c_str()); return false; } }
+        else if (a=="--log-summary-ms")     { if(!need(a.c_str())) return false; r.log_summary_ms = std::atoi(argv[++i]); }
+        else if (a=="--rank-port")          { if(!need(a.c_str())) return false; r.rank_port  = std::atoi(argv[++i]); }
         else if (a=="-T"||a=="--calib-secs") { if(!need(a.c_str())) return false; p.calib_target_seconds    = std::strtod(argv[++i], nullptr); }
         else if (a=="-D"||a=="--calib-dummy"){ if(!need(a.c_str())) return false; p.calib_dummy_frames      = std::atoi(argv[++i]); }
         else if (a=="-P"||a=="--calib-probes"){if(!need(a.c_str())) return false; p.calib_time_probe_frames = std::atoi(argv[++i]); }
@@ -122,88 +324,13 @@ static bool parse_cli(int argc, char** argv, CliRadio& r, jd::Params& p) {
     return true;
 }
 
-// ------------------------------------------------------------
-// UDP kontrol dinleyici: 127.0.0.1:25000 'STOP'|'EXIT'|'QUIT' -> stop_flag=true
-class CtrlServer {
-public:
-#ifdef _WIN32
-    using sock_t = SOCKET;
-    static constexpr sock_t BAD = INVALID_SOCKET;
-#else
-    using sock_t = int;
-    static constexpr sock_t BAD = -1;
-#endif
-
-    CtrlServer(std::atomic<bool>& stop_flag, uint16_t port=25000)
-      : stop_(stop_flag), port_(port) {}
-
-    bool start() {
-#ifdef _WIN32
-        wsainit();
-#endif
-        sock_ = ::socket(AF_INET, SOCK_DGRAM, 0);
-        if (sock_ == BAD) return false;
-
-        sockaddr_in sa{};
-        sa.sin_family = AF_INET;
-        sa.sin_port   = htons(port_);
-        sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK); // 127.0.0.1
-
-        if (::bind(sock_, (sockaddr*)&sa, sizeof(sa)) != 0) {
-            closesock(sock_); sock_=BAD; return false;
-        }
-
-#ifndef _WIN32
-        int fl = fcntl(sock_, F_GETFL, 0);
-        fcntl(sock_, F_SETFL, fl | O_NONBLOCK);
-#else
-        u_long m=1; ioctlsocket(sock_, FIONBIO, &m);
-#endif
-        th_ = std::thread([this]{ loop(); });
-        return true;
-    }
-
-    void stop() {
-        quit_.store(true, std::memory_order_release);
-        if (th_.joinable()) th_.join();
-        if (sock_!=BAD) { closesock(sock_); sock_=BAD; }
-    }
-
-    ~CtrlServer(){ stop(); }
-
-private:
-    void loop() {
-        char buf[256];
-        while (!quit_.load(std::memory_order_acquire) && !stop_.load(std::memory_order_acquire)) {
-            sockaddr_in from{}; socklen_t flen=sizeof(from);
-#ifdef _WIN32
-            int n = ::recvfrom(sock_, buf, (int)sizeof(buf)-1, 0, (sockaddr*)&from, &flen);
-#else
-            int n = (int)::recvfrom(sock_, buf, sizeof(buf)-1, 0, (sockaddr*)&from, &flen);
-#endif
-            if (n>0) {
-                buf[n]=0;
-                for (int i=0;i<n;i++) if (buf[i]>='a'&&buf[i]<='z') buf[i]-=32; // upper
-                if (std::strstr(buf,"STOP") || std::strstr(buf,"EXIT") || std::strstr(buf,"QUIT")) {
-                    std::cout << "[CTRL] STOP komutu alindi.\n";
-                    stop_.store(true, std::memory_order_release);
-                    break;
-                }
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        }
-    }
-
-    std::atomic<bool>& stop_;
-    std::atomic<bool>  quit_{false};
-    uint16_t port_;
-    sock_t   sock_ = BAD;
-    std::thread th_;
-};
-
-// Ctrl+C -> stop_flag
+// Ctrl+C -> stop_flag + kontrol düzlemini uyandır (self-pipe)
 static std::atomic<bool> g_stop{false};
-static void on_sigint(int){ g_stop.store(true, std::memory_order_release); }
+static jd::ControlPlane* g_ctrl = nullptr;
+static void on_sigint(int){
+    g_stop.store(true, std::memory_order_release);
+    if (g_ctrl) g_ctrl->notify_signal();
+}
 
 // ------------------------------------------------------------
 int main(int argc, char** argv) {
@@ -236,6 +363,21 @@ int main(int argc, char** argv) {
         return (argc==1) ? 0 : 1;
     }
 
+    // Asenkron log: tespit döngüsü stdout'a doğrudan yazmaz
+    jd::LoggerConfig lcfg;
+    lcfg.level      = r.log_level;
+    lcfg.summary_ms = r.log_summary_ms;
+    jd::logger().start(lcfg);
+
+    // Yerel denetleyiciler için olay halkası (UDP yolu ayrıca sürer)
+    if (!r.events.name.empty()) {
+        if (jd::events().open(r.events))
+            std::cout << "[INFO] Event ring '" << r.events.name << "' (" << jd::events().config().capacity
+                      << " records requested)\n";
+        else
+            std::cerr << "[WARN] Olay halkasi acilamadi: " << r.events.name << "\n";
+    }
+
     // Pluto konfig
     jd::PlutoConfig pcfg;
     pcfg.uri        = r.uri;
@@ -244,6 +386,8 @@ int main(int argc, char** argv) {
     pcfg.rfbw_hz    = static_cast<uint64_t>(r.rfbw);
     pcfg.frame_len  = p.samples_per_frame;
     pcfg.rx_gain_db = r.gain;
+    pcfg.kernel_buffers = r.kbufs;
+    pcfg.flush      = r.flush;
 
     std::cout << "[INFO] Pluto URI=" << pcfg.uri
               << " | Freq=" << pcfg.center_hz
@@ -254,13 +398,109 @@ int main(int argc, char** argv) {
               << "\n";
 
     // Sayaç + UDP
-    jd::Counter  counter;
+    jd::Counter  counter(r.hop);
     jd::UdpIndex udp("127.0.0.1", 6000);   // veri UDP hedefi
+    std::mutex   pub_m;                     // START/TICK/STOP sırası (tespit thread'i + zamanlayıcı)
+    {
+        const auto& hc = counter.clock().config();
+        std::cout << "[HOP] key=" << (hc.key ? "keyed" : "legacy") << " | dwell=" << hc.dwell_us / 1000.0
+                  << " ms | channels=" << hc.channels << " | refresh=" << hc.refresh_ms << " ms";
+        if (hc.epoch_unix_ns) std::cout << " | epoch_unix_ns=" << hc.epoch_unix_ns;
+        std::cout << "\n";
+    }
+    // Yayın takvimi: jammer sürerken slot sınırlarında mutlak son tarihle TICK (tespit döngüsünden bağımsız)
+    uint64_t ev_sess = 0, ev_slot = ~0ull;      // halkaya slot başına tek Hop olayı
+    jd::HopTimer hop_timer(counter.clock(), [&](uint64_t slot) {
+        std::lock_guard<std::mutex> lk(pub_m);
+        if (!counter.active()) return;
+        udp.tick(counter, slot);
+        if (counter.seq() != ev_sess || slot != ev_slot) {
+            const jd::HopClock& hc = counter.clock();
+            jd::events().hop(counter.seq(), slot, hc.slot_start(slot), hc.config().dwell_us, hc.value(slot));
+            ev_sess = counter.seq();
+            ev_slot = slot;
+        }
+    });
+    hop_timer.start();
+
+    // Telemetri V2: tespit thread'inden periyodik, V1 akışından ayrı soket
+    jd::UdpIndex telem_udp("127.0.0.1", static_cast<uint16_t>(r.telem_port));
+    jd::telemetry().start(r.telem, &telem_udp, &counter);
+    if (jd::telemetry().enabled())
+        std::cout << "[INFO] Telemetry V2 every " << r.telem.period_ms << " ms -> 127.0.0.1:" << r.telem_port << "\n";
     static uint64_t seq=0;
-    bool detected_once = false;
 
-    // Dış kontrol kanalı
-    CtrlServer ctrl(g_stop, 25000);
+    // Çalışırken değiştirilebilir durum (kontrol düzlemi -> tespit thread'i)
+    std::atomic<double> live_thr{-100.0};
+    std::atomic<bool>   rx_live{false};     // RETUNE yalnız RX açıkken anlamlı
+
+    std::unique_ptr<jd::PlutoSource>   pluto;
+    std::unique_ptr<jd::FileSource>    file;
+    std::unique_ptr<jd::SigmfRecorder> rec;
+
+    // Dış kontrol kanalı: poll() tabanlı olay döngüsü
+    jd::ControlPlane ctrl(g_stop, 25000);
+    ctrl.on("STATS", [](const std::string& args) {
+        // Anlık sayaç/histogram özeti gönderene JSON olarak döner
+        std::string a = args;
+        for (auto& c : a) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        if (a == "RESET") jd::hot_metrics().reset();
+        return jd::format_stats(jd::hot_metrics());
+    });
+    ctrl.on("THRESHOLD", [&](const std::string& args) -> std::string {
+        if (args.empty()) return "OK " + std::to_string(live_thr.load());
+        if (!looks_number(args.c_str())) return "ERR usage: THRESHOLD <dBm>";
+        live_thr.store(std::atof(args.c_str()), std::memory_order_relaxed);
+        jd::logger().text(jd::LogLevel::Info, "[CTRL] threshold -> %.2f dBm", live_thr.load());
+        return "OK " + std::to_string(live_thr.load());
+    });
+    auto post = [&](const jd::RetuneRequest& rq) -> std::string {
+        if (!pluto) return "ERR unsupported source";
+        if (!rx_live.load(std::memory_order_acquire)) return "ERR rx closed";
+        pluto->post_retune(rq);
+        return "OK queued";
+    };
+    ctrl.on("RETUNE", [&, post](const std::string& args) -> std::string {
+        // RETUNE <hz> [gain_dB]
+        double hz = 0.0; int gain = 0;
+        const int n = std::sscanf(args.c_str(), "%lf %d", &hz, &gain);
+        if (n < 1 || hz <= 0.0) return "ERR usage: RETUNE <hz> [gain_dB]";
+        jd::RetuneRequest rq;
+        rq.center_hz = static_cast<uint64_t>(hz);
+        if (n == 2) rq.rx_gain_db = gain;
+        return post(rq);
+    });
+    ctrl.on("GAIN", [&, post](const std::string& args) -> std::string {
+        if (!looks_number(args.c_str())) return "ERR usage: GAIN <dB>";
+        jd::RetuneRequest rq;
+        rq.rx_gain_db = std::atoi(args.c_str());
+        return post(rq);
+    });
+    ctrl.on("RFBW", [&, post](const std::string& args) -> std::string {
+        if (!looks_number(args.c_str()) || std::atof(args.c_str()) <= 0.0) return "ERR usage: RFBW <hz>";
+        jd::RetuneRequest rq;
+        rq.rfbw_hz = static_cast<uint64_t>(std::atof(args.c_str()));
+        return post(rq);
+    });
+    ctrl.on("HOPCLOCK", [&](const std::string&) -> std::string {
+        const jd::HopClock& hc = counter.clock();
+        const auto late = hop_timer.lateness().snapshot();
+        uint64_t slot = 0;
+        const bool in = counter.active() && hc.slot_at(jd::HopClock::now(), slot);
+        char b[384];
+        std::snprintf(b, sizeof(b),
+                      "OK {\"keyed\":%s,\"dwell_us\":%u,\"channels\":%d,\"epoch_unix_ns\":%lld,"
+                      "\"active\":%s,\"slot\":%lld,\"value\":%d,\"fired\":%llu,\"missed\":%llu,"
+                      "\"late_p50_us\":%.1f,\"late_p99_us\":%.1f,\"late_max_us\":%.1f}",
+                      hc.config().key ? "true" : "false", hc.config().dwell_us, hc.config().channels,
+                      static_cast<long long>(hc.epoch_unix_ns()), counter.active() ? "true" : "false",
+                      in ? static_cast<long long>(slot) : -1LL, in ? hc.value(slot) : 0,
+                      static_cast<unsigned long long>(hop_timer.fired()),
+                      static_cast<unsigned long long>(hop_timer.missed()),
+                      late.percentile_us(50), late.percentile_us(99), 1e-3 * static_cast<double>(late.max_ns));
+        return b;
+    });
+    g_ctrl = &ctrl;
     if (!ctrl.start()) {
         std::cerr << "[WARN] Kontrol sunucusu baslamadi (127.0.0.1:25000). Ctrl+C ile durdurabilirsiniz.\n";
     } else {
@@ -268,25 +508,176 @@ int main(int argc, char** argv) {
     }
 
     // Kaynak + Detector
-    jd::PlutoSource   src(pcfg);
+    if (!r.replay.empty()) {
+        jd::FileSourceConfig fcfg;
+        fcfg.path      = r.replay;
+        fcfg.frame_len = p.samples_per_frame;
+        fcfg.format    = r.replay_fmt;
+        fcfg.samp_hz   = 0.0;
+        fcfg.realtime  = r.replay_rt;
+        fcfg.loop      = r.replay_loop;
+        file = std::make_unique<jd::FileSource>(fcfg);
+        if (!file->ok()) std::cerr << "[ERR] Replay kaynagi acilamadi: " << r.replay << "\n";
+    } else {
+        pluto = std::make_unique<jd::PlutoSource>(pcfg);
+        if (!r.record.empty()) {
+            rec = std::make_unique<jd::SigmfRecorder>(r.record, static_cast<double>(pcfg.samp_hz),
+                                                      static_cast<double>(pcfg.center_hz));
+            if (rec->ok()) pluto->set_record_tap(rec.get());
+        }
+    }
+    jd::ISource& src = pluto ? static_cast<jd::ISource&>(*pluto) : static_cast<jd::ISource&>(*file);
     jd::JammerDetector det(src, p);
+    det.set_live_control(&live_thr, &g_stop);
+
+    // Kanalizer modu: tek geniş bant yakalamadan tüm hop kanalları
+    const bool channelized = !r.channels.empty();
+    jd::ChannelizerConfig ccfg;
+    ccfg.num_channels    = r.chz_m;
+    ccfg.taps_per_branch = r.chz_taps;
+    ccfg.floor_watt      = p.floor_watt;
+    ccfg.calib_db        = p.calib_db_offset;
+    jd::Channelizer chz(ccfg);
+    jd::ChannelPlan plan{pcfg.center_hz, pcfg.samp_hz, r.channels};
+    if (file && file->meta().samp_hz > 0.0) {   // kayıttan oynatmada bant bilgisi meta'dan
+        plan.samp_hz = static_cast<uint64_t>(file->meta().samp_hz);
+        if (file->meta().center_hz > 0.0) plan.center_hz = static_cast<uint64_t>(file->meta().center_hz);
+    }
+    jd::ChannelBank bank(chz, plan, p.detect_jammer_consecutive);
+    jd::DetectConfig chdc;
+    chdc.jammer_consecutive = p.detect_jammer_consecutive;
+    chdc.max_frames         = p.detect_max_frames;
+    chdc.stop               = &g_stop;
+    jd::ChannelDetector chdet(src, bank, chdc);
 
     // Kalibrasyon
-    auto calib = det.calibrate();
-    if (!calib) {
-        std::cerr << "[ERR] Kalibrasyon basarisiz. Yine de bekleme/publish dongusune gecilecek.\n";
+    if (channelized) {
+        std::cout << "[INFO] Channelizer M=" << chz.num_channels() << " | taps=" << r.chz_taps
+                  << " | channels=" << bank.channels().size() << "\n";
+        jd::GmmThreshold gmm({p.gmm_p_low, p.gmm_p_high, p.gmm_max_iter, p.gmm_eps});
+        if (!bank.ok() || !bank.calibrate(src, gmm, p.calib_target_seconds))
+            std::cerr << "[ERR] Kanal kalibrasyonu basarisiz/eksik.\n";
     } else {
-        std::cout << "[INFO] Threshold(dBm)=" << calib->threshold_dbm
-                  << " | clean=" << (calib->clean_found ? "yes" : "no")
-                  << " | mean_rx_ms=" << calib->mean_rx_ms
-                  << " | mean_frame_ms=" << calib->mean_frame_ms
-                  << " | frames_used=" << calib->frames_used << "\n";
+        auto calib = det.calibrate();
+        if (!calib) {
+            std::cerr << "[ERR] Kalibrasyon basarisiz. Yine de bekleme/publish dongusune gecilecek.\n";
+        } else {
+            std::cout << "[INFO] Threshold(dBm)=" << calib->threshold_dbm
+                      << " | clean=" << (calib->clean_found ? "yes" : "no")
+                      << " | mean_rx_ms=" << calib->mean_rx_ms
+                      << " | mean_frame_ms=" << calib->mean_frame_ms
+                      << " | frames_used=" << calib->frames_used << "\n";
+        }
+    }
+
+    // Tarama modu: STOP gelene kadar hop tablosunu süpür, her turda sıralama yayınla
+    if (!r.scan.empty()) {
+        jd::ScanConfig scfg;
+        scfg.freqs_hz        = r.scan;
+        scfg.dwell_frames    = r.dwell;
+        scfg.auto_dwell      = r.auto_dwell;
+        scfg.required_frames = p.detect_jammer_consecutive;
+        scfg.settle_frames   = r.settle;
+        scfg.auto_settle     = r.auto_settle;
+        scfg.ewma_alpha      = r.scan_alpha;
+        scfg.threshold_dbm   = det.threshold_dbm();
+        jd::Scanner scanner(src, [&src](uint64_t hz){ jd::RetuneRequest rq; rq.center_hz = hz; return src.retune(rq); },
+                            jd::PowerMeter({p.remove_dc, p.dc_alpha, p.floor_watt, p.calib_db_offset}),
+                            scfg);
+        jd::UdpIndex rank_udp("127.0.0.1", static_cast<uint16_t>(r.rank_port));
+        std::cout << "[SCAN] " << r.scan.size() << " frequencies, dwell=" << scanner.dwell_frames()
+                  << " frames, ranking -> 127.0.0.1:" << r.rank_port << "\n";
+
+        std::vector<jd::JdxRankEntryV1> ranked;
+        while (!g_stop.load(std::memory_order_acquire)) {
+            if (!scanner.sweep()) {
+                std::cout << "[WARN] Kaynak kapandi/hata. Tarama durdu.\n";
+                break;
+            }
+            ranked.clear();
+            for (int idx : scanner.ranked()) {
+                const auto& e = scanner.table()[idx];
+                jd::JdxRankEntryV1 re{};
+                re.hz        = e.hz;
+                re.ewma_cdbm = static_cast<int16_t>(std::clamp(e.ewma_dbm * 100.0f, -32768.0f, 32767.0f));
+                re.jammed    = e.jammed;
+                ranked.push_back(re);
+            }
+            rank_udp.publish_ranking(scanner.sweeps(), ranked.data(), static_cast<uint16_t>(ranked.size()));
+
+            const auto& rs = scanner.retune_stats();
+            const auto  rt = pluto ? pluto->retune_timing() : jd::RetuneTiming{};
+            std::printf("[SCAN] sweep=%llu best=%llu Hz (%.2f dBm) retune=%.2f ms (max %.2f, write %.2f ms, to-data %.2f ms) settle=%d+dwell=%d frames\n",
+                        static_cast<unsigned long long>(scanner.sweeps()),
+                        static_cast<unsigned long long>(ranked.front().hz),
+                        ranked.front().ewma_cdbm / 100.0, rs.mean_ms, rs.max_ms,
+                        rt.write_ms, rt.to_data_ms, scanner.settle_frames(), scanner.dwell_frames());
+        }
     }
 
-    // 1) Tespit asamasi (tek seferlik kosul): SustainedJammer gorunce sayaci baslat
+    // Tespit aşamaları: eşik ve RX ayarı kontrol kanalından değiştirilebilir
+    live_thr.store(det.threshold_dbm(), std::memory_order_relaxed);
+    rx_live.store(pluto != nullptr && r.scan.empty(), std::memory_order_release);
+
+    // 1a) Sürekli mod: her geçişte START/STOP, cihaz STOP'a kadar açık
+    const bool continuous = r.continuous && !channelized && r.scan.empty();
+    if (r.continuous && !continuous)
+        std::cerr << "[WARN] --continuous yalniz tek kanal modunda; tek seferlik tespit kullanilacak.\n";
+    if (continuous) {
+        jd::TrackerConfig tc;
+        tc.threshold_dbm = det.threshold_dbm();
+        tc.on_margin_db  = r.on_margin;
+        tc.off_margin_db = r.off_margin;
+        tc.on_frames     = (r.on_frames > 0) ? r.on_frames : p.detect_jammer_consecutive;
+        tc.off_frames    = r.off_frames;
+        tc.min_dwell_ms  = r.min_dwell_ms;
+        std::cout << "[INFO] Continuous mode: on>" << tc.threshold_dbm + tc.on_margin_db << " dBm x" << tc.on_frames
+                  << " | off<" << tc.threshold_dbm - tc.off_margin_db << " dBm x" << tc.off_frames
+                  << " | dwell=" << tc.min_dwell_ms << " ms\n";
+
+        jd::ContinuousDetector cdet(src, jd::PowerMeter({p.remove_dc, p.dc_alpha, p.floor_watt, p.calib_db_offset}), tc,
+            [&](const jd::JammerEvent& ev) {
+                std::lock_guard<std::mutex> lk(pub_m);
+                // STOP istendiyse yeni oturum açma: kapanıştaki udp.stop'tan sonra START gitmesin
+                if (ev.state == jd::JamState::Jammed && g_stop.load(std::memory_order_acquire)) return;
+                if (ev.state == jd::JamState::Jammed) {
+                    counter.start(++seq);
+                    udp.start(counter.seq());
+                    jd::events().detect(seq, static_cast<uint8_t>(jd::JdxState::START), ev.frame, ev.power_dbm,
+                                        tc.threshold_dbm);
+                    hop_timer.enable(true);
+                    jd::logger().text(jd::LogLevel::Info, "[INFO] Jammer bulundu, sayaç basladi (seq=%llu)",
+                                      static_cast<unsigned long long>(seq));
+                } else {
+                    hop_timer.enable(false);
+                    udp.stop(counter);
+                    jd::events().detect(counter.seq(), static_cast<uint8_t>(jd::JdxState::STOP), ev.frame, ev.power_dbm,
+                                        tc.threshold_dbm);
+                    counter.stop();
+                }
+                jd::logger().text(jd::LogLevel::Info, "[EVT] %s frame=%llu p=%.2f dBm t=%lld us prev=%.1f ms",
+                                  ev.state == jd::JamState::Jammed ? "JAMMER_ON" : "JAMMER_OFF",
+                                  static_cast<unsigned long long>(ev.frame), ev.power_dbm,
+                                  static_cast<long long>(ev.wall_us), ev.prev_state_ms);
+            });
+        cdet.set_live_threshold(&live_thr);
+        if (cdet.run(g_stop) == jd::DetectOutcome::SourceEnded)
+            std::cout << "[WARN] Kaynak kapandi/hata. Surekli mod sonlandi.\n";
+        jd::logger().flush();
+        std::lock_guard<std::mutex> lk(pub_m);
+        if (counter.active()) {
+            hop_timer.enable(false);
+            udp.stop(counter);
+            jd::events().detect(counter.seq(), static_cast<uint8_t>(jd::JdxState::STOP), 0, std::nan(""), tc.threshold_dbm);
+            counter.stop();
+        }   // publish aşaması pattern göndermesin
+    }
+
+    // 1b) Tespit asamasi (tek seferlik kosul): SustainedJammer gorunce sayaci baslat
     bool leave_detection=false;
-    while (!g_stop.load(std::memory_order_acquire) && !leave_detection) {
-        auto out = det.run_detection();
+    while (!g_stop.load(std::memory_order_acquire) && !leave_detection && r.scan.empty() && !continuous) {
+        auto out = channelized ? chdet.run() : det.run_detection();
+        jd::logger().flush();   // tespit logları [INFO] satırlarından önce görünsün
 
         if (out == jd::DetectOutcome::SourceEnded) {
             std::cout << "[WARN] Kaynak kapandi/hata. Pluto kapatilip publish moduna gecilecek.\n";
@@ -295,9 +686,14 @@ int main(int argc, char** argv) {
         }
 
         if (out == jd::DetectOutcome::SustainedJammer) {
-            counter.start(++seq);
-            udp.start(counter.seq());
-            detected_once = true;
+            {
+                std::lock_guard<std::mutex> lk(pub_m);
+                if (g_stop.load(std::memory_order_acquire)) break;   // STOP tespitle yarıştı: START yok
+                counter.start(++seq);
+                udp.start(counter.seq());
+                jd::events().detect(seq, static_cast<uint8_t>(jd::JdxState::START), 0, std::nan(""), live_thr.load());
+                hop_timer.enable(true);
+            }
             std::cout << "[INFO] Jammer bulundu, sayaç basladi (seq=" << seq << ")\n";
             // Bir kez tespit istendi: detection'i bitirip publish moduna gec
             leave_detection = true;
@@ -308,25 +704,30 @@ int main(int argc, char** argv) {
     }
 
     // 2) Pluto'yu kapat (publish modunda cihaza ihtiyac yok)
-    if (src.shutdown_rx_only())
-        std::cout << "[INFO] RX kapatildi (shutdown_rx_only)\n";
-    else
-        std::cout << "[WARN] RX kapatilirken sorun olustu (shutdown_rx_only)\n";
+    rx_live.store(false, std::memory_order_release);
+    if (pluto) {
+        pluto->set_record_tap(nullptr);
+        if (rec) rec->close();
+        if (pluto->shutdown_rx_only())
+            std::cout << "[INFO] RX kapatildi (shutdown_rx_only)\n";
+        else
+            std::cout << "[WARN] RX kapatilirken sorun olustu (shutdown_rx_only)\n";
+    }
 
     src.release();
     std::cout << "[INFO] Context serbest birakildi\n";
 
     // 3) Publish modu: Kullanici STOP diyene kadar calis
-    //    - Eğer tespit gerçekleştiyse pattern sürekli UDP'ye akar.
-    //    - Tespit hiç olmadıysa idle bekler (STOP komutunu dinler).
-    using namespace std::chrono_literals;
-    while (!g_stop.load(std::memory_order_acquire)) {
-        if (detected_once) {
-            udp.tick(counter);   // pattern (1,3,5,4,2) degeri UDP'ye gider
-        }
-        std::this_thread::sleep_for(100ms); // publish frekansi (10 Hz)
-    }
+    //    - Eğer tespit gerçekleştiyse pattern hop zamanlayıcısıyla slot sınırlarında UDP'ye akar.
+    //    - Tespit hiç olmadıysa idle bekler; STOP/sinyal bekleyeni anında uyandırır.
+    ctrl.wait_stop();
+    ctrl.stop();
+    g_ctrl = nullptr;
+    hop_timer.stop();
+    jd::telemetry().stop();
+    jd::events().close();
 
     std::cout << "[INFO] STOP istendi, cikiliyor.\n";
+    jd::logger().stop();
     return 0;
 }
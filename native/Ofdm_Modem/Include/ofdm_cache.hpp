@@ -0,0 +1,103 @@
+#pragma once
+#include "ofdm_tx.hpp"
+#include <cstdint>
+#include <string>
+
+#ifndef OFDM_API
+  #if defined(_WIN32)
+    #define OFDM_API extern "C" __declspec(dllexport)
+  #else
+    #define OFDM_API extern "C"
+  #endif
+#endif
+
+// Önceden hesaplanmış baseband önbelleği: aynı dosyanın başka bir hop frekansında
+// yeniden gönderimi modülasyonu tekrar çalıştırmaz. Anahtar = içerik SHA-256'sı +
+// (modülasyon, packet_len, CP, amp); dosya adı anahtardan türetilir, yani aynı içerik
+// farklı yoldan gelse de aynı önbellek girdisine düşer.
+// Dosya düzeni (LE): CacheHeader (64 bayt) + samples * {int16 I, int16 Q}.
+// cs16 ölçeği fmcomms2_sink ile aynı: 1.0 -> 2048 (12 bit DAC), 4 bit sola hizalı.
+namespace ofdm {
+
+constexpr uint32_t kCacheMagic   = 0x3153434Fu;   // "OCS1"
+constexpr uint32_t kCacheVersion = 1;
+
+#pragma pack(push, 1)
+struct CacheHeader {
+    uint32_t magic        = kCacheMagic;
+    uint32_t version      = kCacheVersion;
+    uint8_t  bps          = 0;
+    uint8_t  cp_len       = 0;        // gerçek CP (0 -> 16 çözülmüş olarak)
+    uint16_t header_bytes = 64;
+    uint32_t packet_len   = 0;
+    float    amp          = 0.f;
+    uint32_t packet_samples = 0;
+    uint64_t packets      = 0;
+    uint64_t samples      = 0;        // packets * packet_samples
+    uint8_t  sha256[16]   = {};       // içerik özetinin ilk yarısı (dosya adıyla aynı)
+    uint8_t  reserved[8]  = {};
+};
+#pragma pack(pop)
+static_assert(sizeof(CacheHeader) == 64, "CacheHeader 64 bayt olmali");
+
+// Interleaved cf32 -> cs16 (doyumlu, 12 bit sola hizalı)
+void to_cs16(const cf32* in, int16_t* out, size_t n);
+
+class WaveformCache {
+public:
+    explicit WaveformCache(std::string dir);
+
+    // Önbellek yolu: <dir>/<sha256[0:32]>-<mod>-p<len>-cp<cp>-a<amp bitleri>.cs16
+    std::string entry_path(const std::string& in_path, const TxParams& p) const;
+
+    // Girdi varsa dokunup (LRU) yolunu döner, yoksa render eder (.tmp + atomik rename).
+    // hit: önbellekten mi geldi. Hata: std::runtime_error
+    std::string ensure(const std::string& in_path, const TxParams& p, bool* hit = nullptr);
+
+    // En eski erişilenden başlayarak toplam boyu max_bytes altına indirir; silinen sayısı
+    int prune(uint64_t max_bytes);
+
+    const std::string& dir() const { return dir_; }
+
+private:
+    std::string dir_;
+};
+
+// Önbellek dosyasını salt okunur eşler; örnekler kopyalanmadan TX tamponuna akıtılır
+class MappedWaveform {
+public:
+    MappedWaveform() = default;
+    explicit MappedWaveform(const std::string& path) { open(path); }
+    ~MappedWaveform() { close(); }
+    MappedWaveform(const MappedWaveform&) = delete;
+    MappedWaveform& operator=(const MappedWaveform&) = delete;
+
+    void open(const std::string& path);   // başlık/boyut tutarsızsa std::runtime_error
+    void close();
+
+    bool               is_open() const { return base_ != nullptr; }
+    const CacheHeader& header()  const { return hdr_; }
+    const int16_t*     iq()      const { return iq_; }   // samples() * 2 int16
+    uint64_t           samples() const { return hdr_.samples; }
+
+private:
+    const uint8_t* base_ = nullptr;
+    uint64_t       size_ = 0;
+    const int16_t* iq_   = nullptr;
+    CacheHeader    hdr_;
+#if defined(_WIN32)
+    void* file_ = nullptr;
+    void* map_  = nullptr;
+#endif
+};
+
+} // namespace ofdm
+
+// ---- DLL arayüzü ----
+// in_path için önbellek girdisini hazırlar; yolu out_path'e yazar.
+// Dönüş: 1 önbellekten, 0 yeni render; <0 hata (-1 giriş, -2 dizin, -3 yazma, -4 parametre, -5 out_cap)
+OFDM_API int ofdm_cache_get(const char* cache_dir, const char* in_path,
+                            int bits_per_symbol, int packet_len, int cp_len, float amp,
+                            char* out_path, int out_cap);
+// Önbelleği max_bytes altına indirir (LRU); dönüş silinen dosya sayısı, <0 hata
+OFDM_API int ofdm_cache_prune(const char* cache_dir, std::uint64_t max_bytes);
@@ -0,0 +1,94 @@
+#pragma once
+#include "ofdm_frame.hpp"
+#include "ofdm_fft.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ofdm {
+
+// Paket düzeyi pilot destekli eşitleyici (ofdm_equalizer_simpledfe + pilot CPE).
+// simpledfe sembol başına sanal çağrıyla, taşıyıcı taşıyıcı karmaşık bölme ve
+// constellation decision_maker ile çalışır; burada bir paketin tüm sembolleri tek
+// çağrıda işlenir:
+//  1) pilot geçişi (skaler): pilot kanalları yalnız bilinen sembollerle güncellendiği
+//     için veri taşıyıcılarından bağımsızdır; her sembolün ortak faz hatası (CPE,
+//     artık CFO) baştan hesaplanır
+//  2) veri geçişi (SIMD): 48 veri taşıyıcısı SoA düzleminde şerit şerit; H döndürme,
+//     y/H, eksen eşikli dilimleyici (en yakın nokta ile aynı karar), karar yönlü
+//     H = (1-alpha)*H + alpha*y/karar. Semboller arası özyineleme taşıyıcı başına
+//     olduğundan vektörleşme taşıyıcı ekseninde (AVX-512: 3x16, AVX2: 6x8).
+// Çekirdek BatchFft gibi kurulumda CPU'ya göre seçilir. Çağrılar tahsis yapmaz
+// (reserve ile ayrılan çalışma alanı); nesne başına tek iş parçacığı.
+class PacketEqualizer {
+public:
+    using Isa = BatchFft::Isa;
+
+    explicit PacketEqualizer(float alpha = 0.1f, Isa isa = Isa::Auto);
+
+    Isa  isa() const { return isa_; }
+    void reserve(int max_syms);               // equalize_batch için en çok sembol
+
+    // İlk kestirim: sync_word2 sembolünün shift'li 64 bin FFT'si (LS, y / sync2)
+    void init(const cf32* sync2_fft);
+    // Kanal durumu (shift'li 64 bin; kullanılmayan bin'ler 0)
+    void channel(cf32* h64) const;
+
+    // Tek sembol, shift'li 64 bin (header). idx: n_data karar indeksi;
+    // eq/gain (ikisi birlikte, isteğe bağlı): y/H ve |H|^2
+    void equalize(const cf32* y64, int n_data, Modulation m, uint8_t* idx,
+                  cf32* eq = nullptr, float* gain = nullptr);
+    // BatchFft SoA bloklarından n_syms sembol (blok b, satır = doğal bin, şerit = sembol;
+    // Receiver::fft_payload düzeni). n_data: toplam kullanılan veri taşıyıcısı (son
+    // sembol kısmi olabilir); idx/eq/gain n_data eleman, sembol s taşıyıcı k -> s*48+k.
+    // Kısmi son sembolün boş taşıyıcıları da güncellenir (paket sonu; sonraki paket init ile).
+    void equalize_batch(const float* re, const float* im, int n_syms, int n_data, Modulation m,
+                        uint8_t* idx, cf32* eq = nullptr, float* gain = nullptr);
+
+    // Karar yönlü gürültü birikimi: sum |y - H*karar|^2 ve sayı (yalnız eq istendiğinde)
+    void   reset_noise() { nv_acc_ = 0.0; nv_n_ = 0; }
+    double noise_sum()   const { return nv_acc_; }
+    uint64_t noise_count() const { return nv_n_; }
+
+    // Veri geçişi çekirdeği (dahili; ofdm_eq.cpp)
+    struct Slicer {
+        float thr_r[3], thr_i[3];        // eksen eşikleri (kullanılmayan: +inf)
+        float lev_r, step_r, lev_i, step_i;
+        float alpha;
+        uint8_t lut[16];                 // li_i*4 + li_r -> nokta indeksi
+    };
+    struct Job {
+        float*       hr;  float* hi;     // 48 veri taşıyıcısının kanalı (yerinde)
+        const float* yr;  const float* yi;   // n_syms x 48
+        const float* rot;                // n_syms x (re, im) CPE döndürmesi
+        int          n_syms;
+        float*       code;               // n_syms x 48 dilimleyici kodu (lut indeksi)
+        float*       er;  float* ei;  float* gain;  float* err;   // soft: er != nullptr
+    };
+    using Kernel = void (*)(const Job&, const Slicer&);
+
+private:
+    void run(int n_syms, int n_data, Modulation m, uint8_t* idx, cf32* eq, float* gain);
+    void set_mod(Modulation m);
+
+    float  alpha_;
+    Isa    isa_ = Isa::Scalar;
+    Kernel kern_ = nullptr;
+    Slicer sl_{};
+    Modulation sl_mod_ = Modulation::BPSK;
+    bool   sl_ok_ = false;
+
+    alignas(64) float hr_[kNumOccupied];
+    alignas(64) float hi_[kNumOccupied];
+    cf32   hp_[kNumPilots];
+    int    row_[kNumOccupied];           // veri taşıyıcısının BatchFft satırı
+    int    prow_[kNumPilots];
+    int    max_syms_ = 0;
+    size_t plane_    = 0;                // max_syms_ * 48
+    std::vector<float> ws_;              // yr | yi | code | er | ei | gain | err, her biri plane_
+    std::vector<float> rot_;             // sembol başına CPE döndürmesi (re, im)
+    std::vector<cf32>  py_;              // sembol başına 4 pilot girdisi
+    double   nv_acc_ = 0.0;
+    uint64_t nv_n_   = 0;
+};
+
+} // namespace ofdm
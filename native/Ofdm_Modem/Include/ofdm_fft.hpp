@@ -0,0 +1,79 @@
+#pragma once
+#include "ofdm_frame.hpp"
+#include <vector>
+
+namespace ofdm {
+
+// Küçük 2'nin kuvveti boyutlu karmaşık FFT (N <= 1024).
+// fft_vcc(N, forward, (), shift=True) eşleniği:
+//  - ters yön: giriş shift'li (DC = N/2), ifftshift sonra ölçeksiz IFFT
+//  - ileri yön: ölçeksiz FFT sonra fftshift (çıkışta DC = N/2)
+class Fft {
+public:
+    explicit Fft(int n);
+
+    int size() const { return n_; }
+
+    // in ve out aynı tampon olamaz
+    void inverse_shifted(const cf32* in, cf32* out) const;
+    void forward_shifted(const cf32* in, cf32* out) const;
+
+private:
+    void transform(cf32* x, bool inverse) const;   // yerinde, doğal sıra
+
+    int  n_ = 0;
+    int  log2n_ = 0;
+    cf32 tw_[1024 / 2];     // e^{-j 2 pi k / N}
+    int  rev_[1024];        // bit ters sıra
+};
+
+// Toplu FFT: kBatchLanes sembol tek çağrıda, yapı-dizisi (SoA) blok düzeninde.
+// Blok b: re[b*N*16 + k*16 + s], im aynı (k: bin/örnek, s: blok içi sembol).
+// Kelebekler sembol ekseninde vektörel (AVX-512: 1x16, AVX2: 2x8, skaler: 16x1);
+// çekirdek kurulumda CPU'ya göre seçilir. Yönler Fft ile aynı: ölçeksiz, ters
+// yön e^{+j}. Çağrılar tahsis yapmaz; AoS yardımcıları nesnenin tamponunu
+// kullandığından nesne başına tek iş parçacığı.
+constexpr int kBatchLanes = 16;
+
+class BatchFft {
+public:
+    enum class Isa { Auto, Scalar, Avx2, Avx512 };
+
+    explicit BatchFft(int n, Isa isa = Isa::Auto);
+
+    int  size() const { return n_; }
+    Isa  isa()  const { return isa_; }
+    static const char* isa_name(Isa isa);
+    static bool supported(Isa isa);
+
+    // SoA, doğal sıra, yerinde
+    void forward(float* re, float* im, size_t blocks) const;
+    void inverse(float* re, float* im, size_t blocks) const;
+
+    // Girişi doğrudan bit-ters (ve istenirse ifftshift'li) satırlara yazan
+    // çağıranlar için: shift'li/doğal i indeksinin SoA satırı, sonra yalnız kelebekler.
+    // Çıkış her zaman doğal sıradadır (shift'li k -> satır (k + N/2) % N).
+    int  input_row(int i, bool shifted) const { return shifted ? srow_[i] : rev_[i]; }
+    void transform_permuted(float* re, float* im, size_t blocks, bool inverse) const;
+
+    // AoS cf32 yardımcıları (count sembol, her biri N ardışık örnek), fft_vcc(shift=True):
+    // forward_shifted = FFT sonra fftshift, inverse_shifted = ifftshift sonra IFFT
+    void forward_shifted(const cf32* in, cf32* out, size_t count);
+    void inverse_shifted(const cf32* in, cf32* out, size_t count);
+
+private:
+    using Kernel = void (*)(float*, float*, int, const float*, const float*, float, size_t);
+
+    void aos(const cf32* in, cf32* out, size_t count, bool inverse);
+
+    int    n_ = 0;
+    Isa    isa_ = Isa::Scalar;
+    Kernel kern_ = nullptr;
+    float  twr_[1024 / 2];   // e^{-j 2 pi k / N}
+    float  twi_[1024 / 2];
+    int    rev_[1024];
+    int    srow_[1024];      // rev_[(i + N/2) % N]
+    std::vector<float> blk_;   // AoS yardımcıları için tek blok: re, pay, im (4K örtüşmesini önler)
+};
+
+} // namespace ofdm
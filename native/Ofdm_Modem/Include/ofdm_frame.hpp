@@ -0,0 +1,58 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+// scripts/ofdmtransmitter.py / ofdmreciever.py ile aynı OFDM çerçeve düzeni.
+// Tüm indeksler fftshift'li düzendedir (DC = fft_len/2), GNU Radio'daki
+// ofdm_carrier_allocator_cvc(..., output_is_shifted=True) ile aynı.
+namespace ofdm {
+
+using cf32 = std::complex<float>;
+
+constexpr int kFftLen       = 64;
+constexpr int kDefaultCp    = kFftLen / 4;   // rolloff=0 -> 16
+constexpr int kNumOccupied  = 48;
+constexpr int kNumPilots    = 4;
+constexpr int kNumSyncWords = 2;
+constexpr int kHeaderBits   = kNumOccupied;  // packet_header_ofdm(n_syms=1): 48 bit, BPSK
+constexpr int kCrcLenUnpacked = 32;          // crc32_bb(packed=False): 32 ayrı bit-baytı
+
+// Payload modülasyonu (değer = sembol başına bit)
+enum class Modulation : uint8_t { BPSK = 1, QPSK = 2, QAM16 = 4 };
+
+// Çerçeve sabitleri (ofdm_frame.cpp)
+extern const int  kOccupiedIdx[kNumOccupied];   // tahsis sırası, shift'li indeks
+extern const int  kPilotIdx[kNumPilots];
+extern const cf32 kPilotSym[kNumPilots];
+extern const cf32 kSyncWord1[kFftLen];
+extern const cf32 kSyncWord2[kFftLen];
+
+// digital.constellation_*().points() ile aynı noktalar (GNU Radio sabitleri dahil)
+const cf32* constellation(Modulation m);
+inline int bits_per_symbol(Modulation m) { return static_cast<int>(m); }
+bool parse_modulation(const char* name, Modulation& out);   // "bpsk"|"qpsk"|"16qam" (ve b/q)
+
+// Standart CRC-32 (yansıtılmış 0x04C11DB7, init/xorout 0xFFFFFFFF)
+uint32_t crc32(const uint8_t* data, size_t n);
+
+// crc32_bb(packed=False) eşleniği: her giriş baytı bir "bit" olarak LSB-önce
+// paketlenir (maskeleme yok, GNU Radio ile aynı), yalnız tam baytlar hesaba katılır.
+uint32_t crc32_unpacked(const uint8_t* in, size_t n_items);
+
+// packet_header_default::header_formatter eşleniği (bits_per_byte=1):
+// 12 bit uzunluk + 12 bit paket no + 8 bit CRC8 (poly 0x07, init 0xFF), kalan sıfır.
+void header_bits(uint32_t packet_len, uint16_t header_number, uint8_t out[kHeaderBits]);
+uint8_t header_crc8(uint16_t packet_len, uint16_t header_number);
+
+// Bir paketin çerçeve ölçüleri (packet_len bayt girdi için)
+struct FrameDims {
+    int payload_items  = 0;   // CRC sonrası bayt (packet_len + 32)
+    int payload_syms   = 0;   // konstelasyon sembolü
+    int data_ofdm_syms = 0;   // payload OFDM sembolü
+    int ofdm_syms      = 0;   // sync(2) + header(1) + payload
+    int samples        = 0;   // (fft_len + cp) * ofdm_syms
+};
+FrameDims frame_dims(int packet_len, Modulation m, int cp_len);
+
+} // namespace ofdm
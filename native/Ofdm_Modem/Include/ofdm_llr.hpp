@@ -0,0 +1,50 @@
+#pragma once
+#include "ofdm_frame.hpp"
+#include <cstdint>
+
+#ifndef OFDM_API
+  #if defined(_WIN32)
+    #define OFDM_API extern "C" __declspec(dllexport)
+  #else
+    #define OFDM_API extern "C"
+  #endif
+#endif
+
+// Yumuşak karar (LLR) demapper'ı: constellation_decoder_cb'nin sert kararı yerine
+// bit başına log-olabilirlik oranı üretir. İşaret: LLR > 0 -> bit 1 (sert kararla
+// aynı), |LLR| güven. Bit k, nokta indeksinin k. biti (repack_bits_bb LSB önce ile aynı).
+namespace ofdm {
+
+// 64QAM yalnız demapper tarafında: Gray kare (I: bit 0..2, Q: bit 3..5), birim ortalama
+// güç. digital.constellation_64qam ile birebir doğrulanmadı; TX 8 % bps != 0 yüzünden
+// 64QAM üretmez.
+constexpr int kQam64Bits = 6;
+const cf32* qam64_points();
+
+class LlrDemapper {
+public:
+    explicit LlrDemapper(int bits_per_symbol);   // 1, 2, 4, 6
+    explicit LlrDemapper(Modulation m) : LlrDemapper(bits_per_symbol(m)) {}
+
+    // Max-log LLR: llr[i*bps + k] = (min_{bit0} |eq-s|^2 - min_{bit1} |eq-s|^2) * scale[i]
+    // eq: eşitlenmiş sembol (y/H); scale[i] = |H_i|^2 / sigma^2 (y alanı gürültüsü)
+    void demap(const cf32* eq, const float* scale, int n, float* llr) const;
+    // Sabit ölçek (AWGN, kanal düz): scale = 1 / noise_var
+    void demap(const cf32* eq, float noise_var, int n, float* llr) const;
+
+    int bps() const { return bps_; }
+
+private:
+    int         bps_;
+    const cf32* pts_;
+};
+
+// Bir baytın (8 LLR) doğru çözülmüş olma olasılığı, 0..255'e ölçekli:
+// P = prod_k 1/(1+exp(-|L_k|)) (bitler bağımsız kabul)
+uint8_t byte_reliability(const float* llr8);
+
+} // namespace ofdm
+
+// ---- DLL arayüzü ----
+// iq: n eşitlenmiş sembol (interleaved float), llr: n*bps çıktı. Dönüş: yazılan LLR sayısı, <0 hata
+OFDM_API int ofdm_demap_llr(int bits_per_symbol, const float* iq, int n, float noise_var, float* llr);
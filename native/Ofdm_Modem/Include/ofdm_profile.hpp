@@ -0,0 +1,100 @@
+#pragma once
+#include "ofdm_frame.hpp"
+#include <cstdint>
+#include <memory>
+
+#ifndef OFDM_API
+  #if defined(_WIN32)
+    #define OFDM_API extern "C" __declspec(dllexport)
+  #else
+    #define OFDM_API extern "C"
+  #endif
+#endif
+
+// Çok hızlı OFDM profilleri: FFT boyu, CP ve taşıyıcı haritası çalışma anında seçilir,
+// her profil x modülasyon derleme anı sabitli (şablon) bir modem çekirdeğine gider.
+//  std64        ofdm_frame.hpp düzeninin aynısı (GNU Radio grafiğiyle birebir)
+//  std64-cp8    aynı harita, kısa CP (düşük gecikme yayılımlı kanal)
+//  wide128      128 FFT, ±52 kullanılan (96 veri + 8 pilot), CP 16
+//  wide256      256 FFT, ±100 kullanılan (192 veri + 8 pilot), CP 32
+//  wide256-cp64 wide256, uzun CP (çok yollu)
+// Geniş profillerin sync kelimeleri sabit LFSR (x^7 + x^4 + 1) dizisinden üretilir;
+// bunlar yalnız native uçlar arasında geçerlidir (GNU Radio grafiği 64 ile sabit).
+// Genlik kullanılan taşıyıcı sayısına göre ölçeklenir: aynı amp ile tüm profillerin
+// ortalama örnek gücü std64 ile aynıdır (PA geri çekilmesi değişmez).
+namespace ofdm {
+
+struct Profile {
+    const char* name       = nullptr;
+    int         fft_len    = 0;
+    int         cp_len     = 0;
+    int         n_occupied = 0;        // veri taşıyıcısı (header biti de bu kadar)
+    int         n_pilots   = 0;
+    const int*  occupied   = nullptr;  // shift'li indeks, tahsis sırası
+    const int*  pilots     = nullptr;
+    const cf32* pilot_sym  = nullptr;
+    const cf32* sync1      = nullptr;  // fft_len eleman, shift'li
+    const cf32* sync2      = nullptr;
+};
+
+int            profile_count();
+const Profile* profile_at(int i);               // nullptr: aralık dışı
+const Profile* find_profile(const char* name);  // nullptr: tanımsız
+
+FrameDims frame_dims(const Profile& pf, int packet_len, Modulation m);
+// samp_hz örnek hızında art arda paketlerle payload bit hızı (CRC/header/sync/CP hariç)
+double profile_bitrate(const Profile& pf, int packet_len, Modulation m, double samp_hz);
+
+// Profil modemi: paket (packet_len bayt) <-> taban bant. Somut sınıf profil ve
+// modülasyonla özelleşmiş şablondur; döngü sınırları, kayma ve dilimleyici derleme
+// anında sabittir. Modulator gibi çağrılar tahsis yapmaz, nesne başına tek iş parçacığı.
+class ProfileModem {
+public:
+    virtual ~ProfileModem() = default;
+
+    const Profile&   profile()    const { return pf_; }
+    Modulation       mod()        const { return mod_; }
+    int              packet_len() const { return packet_len_; }
+    const FrameDims& dims()       const { return dims_; }
+    int  packet_samples() const { return dims_.samples; }
+
+    // packet_len bayt -> packet_samples() örnek (Modulator::modulate ile aynı zincir)
+    virtual void modulate(const uint8_t* packet, cf32* out) = 0;
+
+    // Zamanlaması bilinen paket: in[0] sync1'in CP başı, packet_samples() örnek.
+    // Kanal sync2'den (LS), sembol başına ortak faz hatası pilotlardan düzeltilir;
+    // zamanlama/CFO araması yapılmaz (akış alıcısı Receiver, yalnız std64).
+    // Dönüş: packet_len (CRC geçti), -1 header hatası, -2 CRC hatası
+    virtual int demodulate(const cf32* in, uint8_t* out, uint16_t* number = nullptr) = 0;
+
+    uint16_t header_number() const { return hdr_num_; }
+    void     reset() { hdr_num_ = 0; }
+
+protected:
+    ProfileModem(const Profile& pf, Modulation m, int packet_len)
+        : pf_(pf), mod_(m), packet_len_(packet_len), dims_(frame_dims(pf, packet_len, m)) {}
+
+    const Profile& pf_;
+    Modulation     mod_;
+    int            packet_len_;
+    FrameDims      dims_;
+    uint16_t       hdr_num_ = 0;
+};
+
+// Profil x modülasyon -> özelleşmiş çekirdek. Geçersiz parametrede std::invalid_argument.
+std::unique_ptr<ProfileModem> make_profile_modem(const Profile& pf, Modulation m, int packet_len, float amp = 0.03f);
+
+} // namespace ofdm
+
+// ---- DLL arayüzü ----
+OFDM_API int ofdm_profile_count();
+// out: fft_len, cp_len, n_occupied, n_pilots. Dönüş 0; -1 aralık dışı, -5 name cap yetersiz
+OFDM_API int ofdm_profile_info(int index, char* name, int name_cap, int out[4]);
+
+// Profil modemi tutamacı (profile: ad, ör. "wide256"); geçersiz parametrede nullptr
+OFDM_API void* ofdm_pm_create(const char* profile, int bits_per_symbol, int packet_len, float amp);
+OFDM_API int   ofdm_pm_packet_samples(void* h);
+OFDM_API int   ofdm_pm_modulate(void* h, const std::uint8_t* packet, float* out_iq);
+// in_iq: packet_samples() örnek; dönüş ProfileModem::demodulate ile aynı
+OFDM_API int   ofdm_pm_demodulate(void* h, const float* in_iq, std::uint8_t* out);
+OFDM_API void  ofdm_pm_destroy(void* h);
@@ -0,0 +1,155 @@
+#pragma once
+#include "ofdm_frame.hpp"
+#include "ofdm_eq.hpp"
+#include "ofdm_fft.hpp"
+#include "ofdm_llr.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#ifndef OFDM_API
+  #if defined(_WIN32)
+    #define OFDM_API extern "C" __declspec(dllexport)
+  #else
+    #define OFDM_API extern "C"
+  #endif
+#endif
+
+namespace ofdm {
+
+struct RxParams {
+    Modulation mod            = Modulation::QPSK;
+    int        cp_len         = 0;       // 0 -> fft_len/4
+    float      sync_threshold = 0.7f;    // normalize Schmidl-Cox metrik eşiği (ofdmreciever.py: 0.9, ~8 dB altı kaçırır)
+    float      dfe_alpha      = 0.1f;    // simpledfe güncelleme katsayısı (yeni kestirimin ağırlığı)
+    int        max_carrier_offset = 3;   // ofdm_chanest_vcvc tamsayı taşıyıcı araması
+    int        max_items      = 0x0FFF;  // header'daki 12 bit uzunluk sınırı (tampon boyu)
+    bool       soft           = false;   // LLR + bayt güvenilirliği (RxPacket::llr / reliability)
+    bool       deliver_crc_fail = false; // CRC'si tutmayan payload'ı da teslim et (crc_ok=false)
+};
+
+// Çözülmüş paket (data yalnız geri çağrı süresince geçerli)
+struct RxPacket {
+    const uint8_t* data      = nullptr;  // payload (sert karar; deliver_crc_fail yoksa CRC'si doğrulanmış)
+    int            len       = 0;        // bayt (header uzunluğu - 32)
+    uint16_t       number    = 0;        // header paket no (12 bit)
+    float          cfo       = 0.f;      // taşıyıcı aralığı cinsinden toplam CFO
+    uint64_t       start     = 0;        // sync1 gövdesinin mutlak örnek indeksi
+    uint64_t       end       = 0;        // paketin son örneğinden sonraki indeks
+    bool           crc_ok    = true;
+    // Yalnız RxParams::soft ile (aksi halde nullptr):
+    const float*   llr         = nullptr;  // len*8 LLR, bayt i'nin k. biti llr[8i+k] (>0 -> 1)
+    const uint8_t* reliability = nullptr;  // bayt başına doğru olma olasılığı *255
+    float          noise_var   = 0.f;      // karar yönlü gürültü kestirimi (y alanı, paket ortalaması)
+};
+
+struct RxStats {
+    uint64_t samples     = 0;
+    uint64_t syncs       = 0;   // Schmidl-Cox tetik
+    uint64_t header_fail = 0;   // CRC8/uzunluk hatası
+    uint64_t crc_fail    = 0;   // payload CRC32 hatası
+    uint64_t packets     = 0;
+    uint64_t bytes       = 0;
+};
+
+// ofdmreciever.py RX grafiğinin akış tabanlı eşleniği:
+// Schmidl-Cox zamanlama/CFO -> sync_word2 kanal kestirimi (+ tamsayı ofset)
+// -> simpledfe eşitleme (PacketEqualizer) -> BPSK header (CRC8) -> payload karar + CRC32 kontrolü.
+// Tek sabit örnek tamponu (en uzun header uzunluğuna göre) kurulumda ayrılır;
+// payload sembolleri CFO düzeltmesiyle SoA bloklarına toplanıp tek BatchFft çağrısıyla çevrilir
+// ve aynı bloklardan tek çağrıda eşitlenir.
+class Receiver {
+public:
+    using PacketFn = std::function<void(const RxPacket&)>;
+
+    Receiver(const RxParams& p, PacketFn on_packet);
+
+    // Herhangi boyutta parça kabul eder; tamamlanan paketler geri çağrıyla döner
+    void push(const cf32* x, size_t n);
+    void reset();
+
+    const RxStats&  stats()  const { return st_; }
+    const RxParams& params() const { return p_; }
+
+private:
+    enum class State { Search, Frame };
+
+    void   run();
+    bool   search();                      // true: çerçeve başı bulundu
+    bool   decode_frame();                // true: çerçeve işlendi (başarılı/başarısız)
+    void   fft_at(size_t pos, double eps, cf32* out);
+    void   fft_payload(size_t pos0, int count, double eps);   // count sembol -> SoA bloklar
+    void   soft_decode(int n_syms);                               // eq_ -> llr_ -> rel_
+    void   resume_search(size_t pos);
+    size_t sym_len() const { return static_cast<size_t>(kFftLen + cp_); }
+
+    RxParams p_;
+    PacketFn on_packet_;
+    int      cp_;
+    Fft      fft_;
+    BatchFft bfft_;
+    PacketEqualizer dfe_;              // kanal durumu (sync2 -> header -> payload)
+    RxStats  st_;
+
+    // Örnek tamponu: [0, tail_) geçerli, buf_[0] mutlak base_ indeksine karşılık gelir
+    std::vector<cf32> buf_;
+    size_t   tail_ = 0;
+    uint64_t base_ = 0;
+
+    // Arama (Schmidl-Cox) durumu
+    State  state_ = State::Search;
+    size_t d_     = 0;                 // pencere başı (tampon içi)
+    bool   sums_ok_ = false;
+    double p_re_ = 0, p_im_ = 0, r1_ = 0, r2_ = 0;
+    int    since_refresh_ = 0;
+    bool   in_plat_ = false;
+    size_t plat_a_ = 0, plat_b_ = 0;
+    int    below_ = 0;                 // plato sonrası eşik altı örnek sayısı
+    double ps_re_ = 0, ps_im_ = 0;     // plato boyunca P toplamı (CFO)
+
+    // Çerçeve durumu
+    size_t start_ = 0;                 // sync1 FFT penceresi (tampon içi)
+    double eps_   = 0.0;               // kesirli CFO (taşıyıcı aralığı)
+    int    items_ = -1;                // header uzunluğu (-1: header henüz çözülmedi)
+    uint16_t number_ = 0;
+
+    // Çalışma alanları
+    cf32 tmp_[kFftLen];
+    cf32 y_[kFftLen];
+    std::vector<float>   soa_;        // payload sembolleri, BatchFft blokları: re | pay | im
+    float*               soa_re_ = nullptr;
+    float*               soa_im_ = nullptr;
+    std::vector<uint8_t> sym_idx_;
+    std::vector<uint8_t> items_buf_;
+
+    // Yumuşak karar (RxParams::soft)
+    LlrDemapper          demap_;
+    std::vector<cf32>    eq_;          // payload sembolleri, y/H
+    std::vector<float>   gain_;        // |H|^2 (soft_decode'da |H|^2/sigma^2 olur)
+    std::vector<float>   llr_;
+    std::vector<uint8_t> rel_;
+    float                nv_     = 0.f;
+};
+
+} // namespace ofdm
+
+// ---- DLL arayüzü ----
+// Tutamaç: çözülen paketler iç kuyruğa alınır, ofdm_rx_pop ile sırayla okunur.
+OFDM_API void* ofdm_rx_create(int bits_per_symbol, int cp_len, float sync_threshold);
+OFDM_API int   ofdm_rx_push(void* h, const float* iq, int n_samples);   // kuyruktaki paket sayısı
+OFDM_API int   ofdm_rx_pop(void* h, std::uint8_t* out, int cap);        // bayt; 0: boş, <0: cap yetersiz
+OFDM_API int   ofdm_rx_stats(void* h, std::uint64_t out[6]);           // samples,syncs,hdr_fail,crc_fail,packets,bytes
+OFDM_API void  ofdm_rx_destroy(void* h);
+
+// cf32 dosyasını çözüp CRC'si geçen payload'ları art arda yazar (udp_sink çıktısının eşi).
+// Dönüş: çözülen paket sayısı; <0 hata (-1 giriş, -2 çıkış, -3 yazma, -4 parametre)
+OFDM_API int ofdm_rx_file(const char* in_path, const char* out_path, int bits_per_symbol, int cp_len);
+
+// Güvenilirlik yan dosyası (RSEH): CRC'si tutmayan payload'lar da atılmadan yazılır,
+// düşük güvenli bayt aralıkları hints_path'e kaydedilir; rs_hints_load() bunları RS
+// silmelerine çevirir. Düzen (LE): başlık {'RSEH', u32 version=1, u32 rec_size=16, u32 0},
+// kayıt {u64 out_path bayt ofseti, u32 uzunluk, u8 güvenilirlik (0..255), u8 bayrak, u16 0};
+// bayrak bit0 = kayıp aralık (udp_dump sıra boşluğu; burada hep 0).
+// Dönüş: yazılan paket sayısı (CRC hatalılar dahil); hatalar ofdm_rx_file ile aynı (-5 hints)
+OFDM_API int ofdm_rx_file_ex(const char* in_path, const char* out_path, const char* hints_path,
+                             int bits_per_symbol, int cp_len);
@@ -0,0 +1,82 @@
+#pragma once
+#include "ofdm_frame.hpp"
+#include "ofdm_fft.hpp"
+#include <cstdint>
+#include <vector>
+
+#if defined(_WIN32)
+  #define OFDM_API extern "C" __declspec(dllexport)
+#else
+  #define OFDM_API extern "C"
+#endif
+
+namespace ofdm {
+
+struct TxParams {
+    Modulation mod        = Modulation::QPSK;
+    int        packet_len = 512;     // bayt (stream_to_tagged_stream)
+    int        cp_len     = 0;       // 0 -> fft_len/4 (ofdmtransmitter.py 'rolloff')
+    float      amp        = 0.03f;   // multiply_const_cc
+};
+
+// ofdmtransmitter.py zincirinin tek geçişlik eşleniği:
+// CRC32 (unpacked) -> bit paketleme (LSB önce) -> BPSK header + payload eşleme
+// -> taşıyıcı tahsisi + pilotlar + sync kelimeleri -> IFFT(shift) -> CP -> amp.
+// Paket başına çalışma alanı önceden ayrılır; modulate() tahsis yapmaz.
+// Sabit sync sembolleri kurulumda bir kez üretilir; header + payload sembolleri
+// BatchFft SoA bloklarına doğrudan yazılıp tek çağrıda IFFT'lenir.
+class Modulator {
+public:
+    explicit Modulator(const TxParams& p);
+
+    const TxParams&  params() const { return p_; }
+    const FrameDims& dims()   const { return dims_; }
+    int  packet_samples() const { return dims_.samples; }
+
+    // packet_len bayt -> packet_samples() karmaşık örnek (out)
+    void modulate(const uint8_t* packet, cf32* out);
+
+    uint16_t header_number() const { return hdr_num_; }
+    void reset() { hdr_num_ = 0; }
+
+private:
+    void emit_symbol(const cf32* freq, cf32*& out);
+    void put(int sym, int idx, cf32 v);   // sym. sembolün shift'li idx taşıyıcısı (SoA)
+
+    TxParams    p_;
+    FrameDims   dims_;
+    int         cp_ = kDefaultCp;
+    Fft         fft_;
+    BatchFft    bfft_;
+    const cf32* points_ = nullptr;
+    uint16_t    hdr_num_ = 0;
+
+    std::vector<uint8_t> items_;   // packet + 32 CRC bit-baytı
+    std::vector<cf32>    sync_;    // iki sync sembolü, CP ve amp dahil
+    std::vector<float>   soa_;     // header + payload blokları: re | pay | im
+    size_t               blocks_ = 0;
+    float*               re_ = nullptr;
+    float*               im_ = nullptr;
+};
+
+} // namespace ofdm
+
+// ---- DLL arayüzü (bitwrap.dll ile aynı stil; 0 = başarı) ----
+
+// Dosyayı packet_len'lik paketlere bölüp cf32 (interleaved float I/Q) baseband yazar.
+// Son eksik paket GNU Radio'daki gibi gönderilmez.
+// bits_per_symbol: 1=BPSK, 2=QPSK, 4=16QAM; cp_len 0 -> 16
+OFDM_API int ofdm_tx_file(
+    const char* in_path,
+    const char* out_path,
+    int   bits_per_symbol,
+    int   packet_len,
+    int   cp_len,
+    float amp
+);
+
+// Akış kullanımı: tutamaç başına bir Modulator
+OFDM_API void* ofdm_tx_create(int bits_per_symbol, int packet_len, int cp_len, float amp);
+OFDM_API int   ofdm_tx_packet_samples(void* h);
+OFDM_API int   ofdm_tx_modulate(void* h, const std::uint8_t* packet, float* out_iq);
+OFDM_API void  ofdm_tx_destroy(void* h);
@@ -0,0 +1,110 @@
+// ofdm_cache_bench.cpp
+// Baseband önbelleği: ilk gönderim (render) ile tekrar gönderim (hash + eşleme)
+// süresini ve ilk örneğe kadar geçen süreyi ölçer; önbellekteki cs16 örneklerini
+// Modulator + to_cs16 çıktısıyla birebir karşılaştırır.
+//
+//   ofdm_cache_bench [--dir ofdm_cache] [--input file.bin | --size-mb 8]
+//                    [--mod qpsk] [--packet-len 512] [--cp 0] [--amp 0.03]
+//
+// --input verilmezse --dir altına rastgele içerikli bir dosya üretilir.
+// Derleme (MinGW/GCC):
+//   g++ -O3 -march=native -std=c++17 bench/ofdm_cache_bench.cpp ofdm_cache.cpp ofdm_tx.cpp ofdm_frame.cpp ../Checksum/checksum.c ofdm_fft.cpp -o ofdm_cache_bench
+#include "../Include/ofdm_cache.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Args {
+    ofdm::TxParams p;
+    std::string dir = "ofdm_cache";
+    std::string input;
+    double      size_mb = 8.0;
+};
+
+static bool parse(int argc, char** argv, Args& a) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string k = argv[i];
+        auto val = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if      (k == "--mod")        { if (!(v = val()) || !ofdm::parse_modulation(v, a.p.mod)) return false; }
+        else if (k == "--packet-len") { if (!(v = val())) return false; a.p.packet_len = std::atoi(v); }
+        else if (k == "--cp")         { if (!(v = val())) return false; a.p.cp_len = std::atoi(v); }
+        else if (k == "--amp")        { if (!(v = val())) return false; a.p.amp = static_cast<float>(std::atof(v)); }
+        else if (k == "--dir")        { if (!(v = val())) return false; a.dir = v; }
+        else if (k == "--input")      { if (!(v = val())) return false; a.input = v; }
+        else if (k == "--size-mb")    { if (!(v = val())) return false; a.size_mb = std::atof(v); }
+        else return false;
+    }
+    return a.p.packet_len > 0;
+}
+
+int main(int argc, char** argv) {
+    Args a;
+    if (!parse(argc, argv, a)) {
+        std::fprintf(stderr, "usage: ofdm_cache_bench [--dir D] [--input file | --size-mb M] [--mod bpsk|qpsk|16qam]\n"
+                             "                        [--packet-len N] [--cp N] [--amp A]\n");
+        return 2;
+    }
+    using clk = std::chrono::steady_clock;
+    auto ms = [](clk::time_point t0) { return std::chrono::duration<double, std::milli>(clk::now() - t0).count(); };
+
+    try {
+        ofdm::WaveformCache cache(a.dir);
+        if (a.input.empty()) {
+            a.input = (std::filesystem::path(a.dir) / "bench_input.bin").string();
+            std::vector<char> buf(static_cast<size_t>(a.size_mb * (1 << 20)));
+            std::mt19937 rng(static_cast<unsigned>(clk::now().time_since_epoch().count()));
+            for (auto& b : buf) b = static_cast<char>(rng());
+            std::ofstream(a.input, std::ios::binary).write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        }
+
+        bool hit = false;
+        auto t0 = clk::now();
+        const std::string path = cache.ensure(a.input, a.p, &hit);
+        const double t_first = ms(t0);
+
+        t0 = clk::now();
+        bool hit2 = false;
+        cache.ensure(a.input, a.p, &hit2);
+        ofdm::MappedWaveform w(path);
+        volatile int16_t first = w.iq()[0];
+        (void)first;
+        const double t_hit = ms(t0);
+
+        const auto& h = w.header();
+        std::printf("%s\n", path.c_str());
+        std::printf("packets=%llu samples=%llu size=%.1f MB\n",
+                    static_cast<unsigned long long>(h.packets), static_cast<unsigned long long>(h.samples),
+                    (h.samples * 4 + h.header_bytes) / 1048576.0);
+        std::printf("first call: %s %.1f ms | repeat: %s %.1f ms (hash + map + first sample)\n",
+                    hit ? "hit" : "render", t_first, hit2 ? "hit" : "render", t_hit);
+
+        // Doğrulama: aynı girdiyi yeniden modüle et, cs16 birebir aynı olmalı
+        std::ifstream fin(a.input, std::ios::binary);
+        ofdm::Modulator mod(a.p);
+        std::vector<uint8_t>    pkt(static_cast<size_t>(a.p.packet_len));
+        std::vector<ofdm::cf32> iq(h.packet_samples);
+        std::vector<int16_t>    cs(2 * size_t(h.packet_samples));
+        uint64_t k = 0, bad = 0;
+        while (fin.read(reinterpret_cast<char*>(pkt.data()), a.p.packet_len)) {
+            mod.modulate(pkt.data(), iq.data());
+            ofdm::to_cs16(iq.data(), cs.data(), iq.size());
+            if (k >= h.packets || std::memcmp(cs.data(), w.iq() + k * cs.size(), cs.size() * 2) != 0) ++bad;
+            ++k;
+        }
+        const bool ok = (k == h.packets) && bad == 0;
+        std::printf("%s (%llu/%llu packets identical)\n", ok ? "PASS" : "FAIL",
+                    static_cast<unsigned long long>(k - bad), static_cast<unsigned long long>(k));
+        return ok ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "error: %s\n", e.what());
+        return 2;
+    }
+}
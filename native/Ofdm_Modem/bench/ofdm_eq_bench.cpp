@@ -0,0 +1,339 @@
+// ofdm_eq_bench.cpp
+// Paket eşitleyici hızı: OFDM sembol/sn/çekirdek, ofdm_equalizer_simpledfe'nin birebir
+// C++ aktarımına karşı (GNU Radio bağlanmaz; aynı döngüler: taşıyıcı başına occupied/
+// pilot denetimi, std::complex bölme, sanal decision_maker + map_to_points).
+//
+//   ofdm_eq_bench [--mod qpsk[,16qam,bpsk]] [--syms 32] [--packets 128] [--snr 25]
+//                 [--taps 2] [--cfo 0] [--seconds 1] [--seed 1]
+//
+// Kanal: paket başına rastgele --taps yollu çok yollu kanal, sembol başına --cfo
+// (taşıyıcı aralığı) artık faz kayması, AWGN. Eşitleyiciler sync_word2'nin aynı LS
+// kestirimiyle başlar. "agree": kararların aktarımla aynı olduğu taşıyıcı oranı
+// (aktarımda pilot CPE yok; artık CFO'da ayrışma beklenir). "vs scalar": SIMD
+// çekirdeğin skaler çekirdekten farklı karar verdiği taşıyıcı sayısı (0 olmalı).
+// Süreler iş parçacığı CPU süresidir.
+// Derleme (MinGW/GCC):
+//   g++ -O3 -march=native -std=c++17 bench/ofdm_eq_bench.cpp ofdm_eq.cpp ofdm_fft.cpp ofdm_frame.cpp
+//       ../Checksum/checksum.c -o ofdm_eq_bench
+#include "../Include/ofdm_eq.hpp"
+#include "../Include/ofdm_fft.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#endif
+
+namespace {
+
+using ofdm::cf32;
+constexpr int N = ofdm::kFftLen;
+
+struct Args {
+    std::vector<ofdm::Modulation> mods{ofdm::Modulation::QPSK, ofdm::Modulation::QAM16};
+    int      syms    = 32;
+    int      packets = 128;
+    double   snr     = 25.0;
+    int      taps    = 2;
+    double   cfo     = 0.0;
+    double   seconds = 1.0;
+    uint32_t seed    = 1;
+};
+
+std::vector<std::string> split(const std::string& s, char sep) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string t;
+    while (std::getline(ss, t, sep)) if (!t.empty()) out.push_back(t);
+    return out;
+}
+
+bool parse(int argc, char** argv, Args& a) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string k = argv[i];
+        auto val = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if (k == "--mod") {
+            if (!(v = val())) return false;
+            a.mods.clear();
+            for (const auto& m : split(v, ',')) {
+                ofdm::Modulation x;
+                if (!ofdm::parse_modulation(m.c_str(), x)) return false;
+                a.mods.push_back(x);
+            }
+        }
+        else if (k == "--syms")    { if (!(v = val())) return false; a.syms = std::atoi(v); }
+        else if (k == "--packets") { if (!(v = val())) return false; a.packets = std::atoi(v); }
+        else if (k == "--snr")     { if (!(v = val())) return false; a.snr = std::atof(v); }
+        else if (k == "--taps")    { if (!(v = val())) return false; a.taps = std::atoi(v); }
+        else if (k == "--cfo")     { if (!(v = val())) return false; a.cfo = std::atof(v); }
+        else if (k == "--seconds") { if (!(v = val())) return false; a.seconds = std::atof(v); }
+        else if (k == "--seed")    { if (!(v = val())) return false; a.seed = static_cast<uint32_t>(std::strtoul(v, nullptr, 10)); }
+        else return false;
+    }
+    return a.syms > 0 && a.packets > 0 && a.taps > 0 && !a.mods.empty();
+}
+
+double thread_cpu_s() {
+#if defined(_WIN32)
+    FILETIME c, e, k, u;
+    GetThreadTimes(GetCurrentThread(), &c, &e, &k, &u);
+    const auto t = [](const FILETIME& f) { return (static_cast<uint64_t>(f.dwHighDateTime) << 32) | f.dwLowDateTime; };
+    return 1e-7 * static_cast<double>(t(k) + t(u));
+#else
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) + 1e-9 * static_cast<double>(ts.tv_nsec);
+#endif
+}
+
+// fn(k) paket k'yı işler; en az `seconds` CPU süresi boyunca tekrarlanır. Dönüş: paket/CPU sn
+template <class Fn>
+double rate(int npk, double seconds, Fn&& fn) {
+    uint64_t packets = 0;
+    const double c0 = thread_cpu_s();
+    double el = 0.0;
+    do {
+        for (int k = 0; k < npk; ++k) fn(k);
+        packets += static_cast<uint64_t>(npk);
+        el = thread_cpu_s() - c0;
+    } while (el < seconds);
+    return static_cast<double>(packets) / el;
+}
+
+// ---- gr-digital ofdm_equalizer_simpledfe aktarımı ----
+// constellation: sanal decision_maker (BPSK/QPSK işaret, diğerleri en yakın nokta) ve map_to_points
+class GrConstellation {
+public:
+    GrConstellation(const cf32* pts, int n) : pts_(pts, pts + n) {}
+    virtual ~GrConstellation() = default;
+    virtual unsigned int decision_maker(const cf32* sample) {
+        unsigned int best = 0;
+        float bd = 1e30f;
+        for (size_t k = 0; k < pts_.size(); ++k) {
+            const float d = std::norm(*sample - pts_[k]);
+            if (d < bd) { bd = d; best = static_cast<unsigned int>(k); }
+        }
+        return best;
+    }
+    virtual void map_to_points(unsigned int value, cf32* points) { points[0] = pts_[value]; }
+protected:
+    std::vector<cf32> pts_;
+};
+class GrBpsk : public GrConstellation {
+public:
+    using GrConstellation::GrConstellation;
+    unsigned int decision_maker(const cf32* s) override { return s->real() > 0; }
+};
+class GrQpsk : public GrConstellation {
+public:
+    using GrConstellation::GrConstellation;
+    unsigned int decision_maker(const cf32* s) override { return ((s->imag() > 0) << 1) | (s->real() > 0); }
+};
+
+class GrEqualizer1dPilots {
+public:
+    virtual ~GrEqualizer1dPilots() = default;
+    virtual void equalize(cf32* frame, int n_sym, const std::vector<cf32>& initial_taps) = 0;
+};
+
+class GrSimpleDfe : public GrEqualizer1dPilots {
+public:
+    GrSimpleDfe(std::unique_ptr<GrConstellation> c, float alpha)
+        : d_constellation(std::move(c)), d_alpha(1.f - alpha),
+          d_occupied(N, false), d_pilot(N, false), d_pilot_sym(N), d_channel_state(N) {
+        for (int k = 0; k < ofdm::kNumOccupied; ++k) d_occupied[ofdm::kOccupiedIdx[k]] = true;
+        for (int k = 0; k < ofdm::kNumPilots; ++k) {
+            d_occupied[ofdm::kPilotIdx[k]] = true;
+            d_pilot[ofdm::kPilotIdx[k]]    = true;
+            d_pilot_sym[ofdm::kPilotIdx[k]] = ofdm::kPilotSym[k];
+        }
+    }
+    void equalize(cf32* frame, int n_sym, const std::vector<cf32>& initial_taps) override {
+        if (!initial_taps.empty()) d_channel_state = initial_taps;
+        cf32 sym_eq, sym_est;
+        for (int i = 0; i < n_sym; i++) {
+            for (int k = 0; k < N; k++) {
+                if (!d_occupied[k]) continue;
+                if (d_pilot[k]) {
+                    d_channel_state[k] = d_alpha * d_channel_state[k] + (1 - d_alpha) * frame[i * N + k] / d_pilot_sym[k];
+                    frame[i * N + k] = d_pilot_sym[k];
+                } else {
+                    sym_eq = frame[i * N + k] / d_channel_state[k];
+                    d_constellation->map_to_points(d_constellation->decision_maker(&sym_eq), &sym_est);
+                    d_channel_state[k] = d_alpha * d_channel_state[k] + (1 - d_alpha) * frame[i * N + k] / sym_est;
+                    frame[i * N + k] = sym_eq;
+                }
+            }
+        }
+    }
+    unsigned int decide(const cf32& s) { cf32 t = s; return d_constellation->decision_maker(&t); }
+private:
+    std::unique_ptr<GrConstellation> d_constellation;
+    float d_alpha;
+    std::vector<bool> d_occupied, d_pilot;
+    std::vector<cf32> d_pilot_sym;
+    std::vector<cf32> d_channel_state;
+};
+
+std::unique_ptr<GrConstellation> gr_constellation(ofdm::Modulation m) {
+    const cf32* p = ofdm::constellation(m);
+    const int n = 1 << ofdm::bits_per_symbol(m);
+    if (m == ofdm::Modulation::BPSK) return std::unique_ptr<GrConstellation>(new GrBpsk(p, n));
+    if (m == ofdm::Modulation::QPSK) return std::unique_ptr<GrConstellation>(new GrQpsk(p, n));
+    return std::unique_ptr<GrConstellation>(new GrConstellation(p, n));
+}
+
+// Paket: sync2 FFT'si + syms veri sembolü (AoS shift'li ve BatchFft SoA blokları)
+struct Packet {
+    std::vector<cf32>    sync2;      // 64
+    std::vector<cf32>    aos;        // syms * 64
+    std::vector<float>   re, im;     // SoA bloklar
+    std::vector<uint8_t> tx;         // syms * 48 gönderilen nokta indeksi
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Args a;
+    if (!parse(argc, argv, a)) {
+        std::fprintf(stderr, "usage: ofdm_eq_bench [--mod qpsk,16qam,bpsk] [--syms N] [--packets N] [--snr dB]\n"
+                             "                     [--taps N] [--cfo C] [--seconds S] [--seed N]\n");
+        return 2;
+    }
+    const float alpha = 0.1f;
+    const int   S = a.syms;
+    const size_t blocks = static_cast<size_t>((S + ofdm::kBatchLanes - 1) / ofdm::kBatchLanes);
+    const size_t plane  = blocks * N * ofdm::kBatchLanes;
+
+    std::printf("syms/packet=%d packets=%d snr=%.1f dB taps=%d cfo=%.3f\n", S, a.packets, a.snr, a.taps, a.cfo);
+    std::printf("%-5s %-22s %12s %14s %8s %8s %10s\n", "mod", "equalizer", "sym/s/core", "carrier sym/s", "speedup",
+                "agree", "vs scalar");
+
+    std::vector<ofdm::PacketEqualizer::Isa> isas{ofdm::PacketEqualizer::Isa::Scalar};
+    if (ofdm::BatchFft::supported(ofdm::BatchFft::Isa::Avx2))   isas.push_back(ofdm::PacketEqualizer::Isa::Avx2);
+    if (ofdm::BatchFft::supported(ofdm::BatchFft::Isa::Avx512)) isas.push_back(ofdm::PacketEqualizer::Isa::Avx512);
+
+    int rc = 0;
+    for (ofdm::Modulation m : a.mods) {
+        std::mt19937 rng(a.seed);
+        std::normal_distribution<float> nd(0.f, 1.f);
+        const cf32* pts = ofdm::constellation(m);
+        const int np = 1 << ofdm::bits_per_symbol(m);
+        const float sigma = static_cast<float>(std::sqrt(std::pow(10.0, -a.snr / 10.0) / 2.0));
+
+        std::vector<Packet> pk(static_cast<size_t>(a.packets));
+        for (auto& p : pk) {
+            // Kanal: taps yollu, üstel güç profili, örnek gecikmeli (CP içinde)
+            std::vector<cf32> h(N, cf32(0.f, 0.f));
+            for (int t = 0; t < a.taps; ++t) {
+                const cf32 g = cf32(nd(rng), nd(rng)) * static_cast<float>(std::exp(-0.5 * t) / std::sqrt(2.0));
+                for (int k = 0; k < N; ++k) {
+                    const double ph = -2.0 * 3.14159265358979323846 * (k - N / 2) * t / N;
+                    h[k] += g * cf32(static_cast<float>(std::cos(ph)), static_cast<float>(std::sin(ph)));
+                }
+            }
+            auto noise = [&]() { return cf32(nd(rng), nd(rng)) * sigma; };
+            p.sync2.resize(N);
+            for (int k = 0; k < N; ++k) p.sync2[k] = h[k] * ofdm::kSyncWord2[k] + noise();
+            p.aos.assign(static_cast<size_t>(S) * N, cf32(0.f, 0.f));
+            p.re.assign(plane, 0.f);
+            p.im.assign(plane, 0.f);
+            p.tx.resize(static_cast<size_t>(S) * ofdm::kNumOccupied);
+            for (int s = 0; s < S; ++s) {
+                const double ph = 2.0 * 3.14159265358979323846 * a.cfo * (s + 1) * (1.0 + 16.0 / N);
+                const cf32 rot(static_cast<float>(std::cos(ph)), static_cast<float>(std::sin(ph)));
+                cf32* y = p.aos.data() + static_cast<size_t>(s) * N;
+                for (int k = 0; k < ofdm::kNumOccupied; ++k) {
+                    const uint8_t d = static_cast<uint8_t>(rng() % static_cast<uint32_t>(np));
+                    p.tx[static_cast<size_t>(s) * ofdm::kNumOccupied + k] = d;
+                    const int i = ofdm::kOccupiedIdx[k];
+                    y[i] = h[i] * pts[d] * rot + noise();
+                }
+                for (int k = 0; k < ofdm::kNumPilots; ++k) {
+                    const int i = ofdm::kPilotIdx[k];
+                    y[i] = h[i] * ofdm::kPilotSym[k] * rot + noise();
+                }
+                const size_t blk = static_cast<size_t>(s / ofdm::kBatchLanes) * N * ofdm::kBatchLanes +
+                                   static_cast<size_t>(s % ofdm::kBatchLanes);
+                for (int k = 0; k < N; ++k) {
+                    const size_t at = blk + static_cast<size_t>((k + N / 2) % N) * ofdm::kBatchLanes;
+                    p.re[at] = y[k].real();
+                    p.im[at] = y[k].imag();
+                }
+            }
+        }
+
+        const size_t nd_total = static_cast<size_t>(S) * ofdm::kNumOccupied;
+        const char* mname = m == ofdm::Modulation::BPSK ? "bpsk" : m == ofdm::Modulation::QPSK ? "qpsk" : "16qam";
+
+        // GNU Radio aktarımı: ilk kestirim init ile aynı, çıkış y/H üzerinden karar
+        GrSimpleDfe gr(gr_constellation(m), alpha);
+        std::vector<cf32> frame(static_cast<size_t>(S) * N), taps(N);
+        std::vector<std::vector<uint8_t>> gr_dec(pk.size(), std::vector<uint8_t>(nd_total));
+        auto gr_run = [&](int k) {
+            const Packet& p = pk[static_cast<size_t>(k)];
+            for (int i = 0; i < N; ++i)
+                taps[i] = ofdm::kSyncWord2[i].real() != 0.f ? p.sync2[i] / ofdm::kSyncWord2[i].real() : cf32(0.f, 0.f);
+            std::memcpy(frame.data(), p.aos.data(), sizeof(cf32) * frame.size());
+            gr.equalize(frame.data(), S, taps);
+        };
+        for (int k = 0; k < a.packets; ++k) {
+            gr_run(k);
+            for (int s = 0; s < S; ++s)
+                for (int c = 0; c < ofdm::kNumOccupied; ++c)
+                    gr_dec[static_cast<size_t>(k)][static_cast<size_t>(s) * ofdm::kNumOccupied + c] =
+                        static_cast<uint8_t>(gr.decide(frame[static_cast<size_t>(s) * N + ofdm::kOccupiedIdx[c]]));
+        }
+        const double gr_rate = rate(a.packets, a.seconds, gr_run) * S;
+        size_t gr_ok = 0;
+        for (int k = 0; k < a.packets; ++k)
+            for (size_t i = 0; i < nd_total; ++i) gr_ok += gr_dec[static_cast<size_t>(k)][i] == pk[static_cast<size_t>(k)].tx[i];
+        std::printf("%-5s %-22s %12.0f %14.3e %7.2fx %8s %10s   (sym err %.2e)\n", mname, "gr simpledfe (port)", gr_rate,
+                    gr_rate * ofdm::kNumOccupied, 1.0, "-", "-",
+                    1.0 - static_cast<double>(gr_ok) / static_cast<double>(nd_total * pk.size()));
+
+        std::vector<std::vector<uint8_t>> ref;   // skaler çekirdek kararları
+        for (auto isa : isas) {
+            ofdm::PacketEqualizer eq(alpha, isa);
+            eq.reserve(S);
+            std::vector<std::vector<uint8_t>> dec(pk.size(), std::vector<uint8_t>(nd_total));
+            std::vector<uint8_t> idx(nd_total);
+            auto run = [&](int k, uint8_t* out) {
+                const Packet& p = pk[static_cast<size_t>(k)];
+                eq.init(p.sync2.data());
+                eq.equalize_batch(p.re.data(), p.im.data(), S, static_cast<int>(nd_total), m, out);
+            };
+            for (int k = 0; k < a.packets; ++k) run(k, dec[static_cast<size_t>(k)].data());
+            const double r = rate(a.packets, a.seconds, [&](int k) { run(k, idx.data()); }) * S;
+
+            size_t agree = 0, ok = 0, diff = 0;
+            for (size_t k = 0; k < pk.size(); ++k)
+                for (size_t i = 0; i < nd_total; ++i) {
+                    agree += dec[k][i] == gr_dec[k][i];
+                    ok    += dec[k][i] == pk[k].tx[i];
+                    if (!ref.empty()) diff += dec[k][i] != ref[k][i];
+                }
+            if (ref.empty()) ref = dec;
+            else if (diff) rc = 1;
+            const std::string name = std::string("PacketEqualizer/") + ofdm::BatchFft::isa_name(isa);
+            char vs[32];
+            if (isa == ofdm::PacketEqualizer::Isa::Scalar) std::snprintf(vs, sizeof vs, "-");
+            else                                           std::snprintf(vs, sizeof vs, "%zu", diff);
+            std::printf("%-5s %-22s %12.0f %14.3e %7.2fx %7.3f%% %10s   (sym err %.2e)\n", mname, name.c_str(), r,
+                        r * ofdm::kNumOccupied, r / gr_rate,
+                        100.0 * static_cast<double>(agree) / static_cast<double>(nd_total * pk.size()), vs,
+                        1.0 - static_cast<double>(ok) / static_cast<double>(nd_total * pk.size()));
+        }
+    }
+    return rc;
+}
@@ -0,0 +1,147 @@
+// ofdm_fft_bench.cpp
+// Toplu (SoA) FFT çekirdeği: doğruluk (skaler Fft'ye göre) ve dönüşüm/sn.
+//
+//   ofdm_fft_bench [--n 64] [--batch 1024] [--seconds 1]
+//
+// Her desteklenen ISA (scalar/avx2/avx512) için SoA çekirdek ve AoS shift'li
+// yardımcılar, ayrıca sembol başına Fft ölçülür. FFTW karşılaştırması için:
+//   g++ -O3 -march=native -std=c++17 -DOFDM_BENCH_FFTW bench/ofdm_fft_bench.cpp ofdm_fft.cpp ofdm_frame.cpp ../Checksum/checksum.c -lfftw3f -o ofdm_fft_bench
+// FFTW'siz derleme:
+//   g++ -O3 -march=native -std=c++17 bench/ofdm_fft_bench.cpp ofdm_fft.cpp ofdm_frame.cpp ../Checksum/checksum.c -o ofdm_fft_bench
+#include "../Include/ofdm_fft.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef OFDM_BENCH_FFTW
+  #include <fftw3.h>
+#endif
+
+using ofdm::cf32;
+using clk = std::chrono::steady_clock;
+
+struct Args {
+    int    n       = 64;
+    size_t batch   = 1024;   // çağrı başına sembol (kBatchLanes'in katına yuvarlanır)
+    double seconds = 1.0;
+};
+
+static bool parse(int argc, char** argv, Args& a) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string k = argv[i];
+        const char* v = (i + 1 < argc) ? argv[++i] : nullptr;
+        if (!v) return false;
+        if      (k == "--n")       a.n = std::atoi(v);
+        else if (k == "--batch")   a.batch = static_cast<size_t>(std::atoll(v));
+        else if (k == "--seconds") a.seconds = std::atof(v);
+        else return false;
+    }
+    a.batch = std::max<size_t>(ofdm::kBatchLanes, (a.batch + ofdm::kBatchLanes - 1) / ofdm::kBatchLanes * ofdm::kBatchLanes);
+    return a.n >= 2 && a.n <= 1024 && (a.n & (a.n - 1)) == 0 && a.seconds > 0.0;
+}
+
+// fn bir çağrıda 'per_call' dönüşüm yapar; dönüşüm/sn döner
+static double rate(double seconds, size_t per_call, const std::function<void()>& fn) {
+    fn();   // ısınma
+    uint64_t calls = 0;
+    const auto t0 = clk::now();
+    double el = 0.0;
+    do {
+        for (int r = 0; r < 16; ++r) fn();
+        calls += 16;
+        el = std::chrono::duration<double>(clk::now() - t0).count();
+    } while (el < seconds);
+    return static_cast<double>(calls * per_call) / el;
+}
+
+static double max_rel_err(const std::vector<cf32>& a, const std::vector<cf32>& b) {
+    double peak = 0.0, err = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        peak = std::max(peak, static_cast<double>(std::abs(b[i])));
+        err  = std::max(err, static_cast<double>(std::abs(a[i] - b[i])));
+    }
+    return peak > 0.0 ? err / peak : err;
+}
+
+int main(int argc, char** argv) {
+    Args a;
+    if (!parse(argc, argv, a)) {
+        std::fprintf(stderr, "usage: ofdm_fft_bench [--n 64] [--batch 1024] [--seconds 1]\n");
+        return 2;
+    }
+    const int    n  = a.n;
+    const size_t ns = a.batch * static_cast<size_t>(n);
+
+    std::mt19937 rng(7);
+    std::normal_distribution<float> nd(0.f, 1.f);
+    std::vector<cf32> in(ns), out(ns), ref(ns);
+    for (auto& x : in) x = cf32(nd(rng), nd(rng));
+
+    // Referans: sembol başına skaler Fft
+    ofdm::Fft fft(n);
+    std::printf("n=%d batch=%zu symbols/call\n", n, a.batch);
+    const double r_ref = rate(a.seconds, a.batch, [&] {
+        for (size_t s = 0; s < a.batch; ++s) fft.forward_shifted(in.data() + s * n, ref.data() + s * n);
+    });
+    std::printf("  %-28s %12.3f Mtransforms/s\n", "Fft (per symbol, scalar)", r_ref * 1e-6);
+    for (size_t s = 0; s < a.batch; ++s) fft.forward_shifted(in.data() + s * n, ref.data() + s * n);
+    std::vector<cf32> ref_inv(ns);
+    for (size_t s = 0; s < a.batch; ++s) fft.inverse_shifted(in.data() + s * n, ref_inv.data() + s * n);
+
+    int rc = 0;
+    const ofdm::BatchFft::Isa isas[] = { ofdm::BatchFft::Isa::Scalar, ofdm::BatchFft::Isa::Avx2, ofdm::BatchFft::Isa::Avx512 };
+    for (auto isa : isas) {
+        if (!ofdm::BatchFft::supported(isa)) {
+            std::printf("  %-28s (not supported on this CPU)\n", ofdm::BatchFft::isa_name(isa));
+            continue;
+        }
+        ofdm::BatchFft bf(n, isa);
+        const std::string name = ofdm::BatchFft::isa_name(isa);
+
+        // Doğruluk: AoS shift'li yardımcılar skaler Fft ile aynı sonucu vermeli
+        bf.forward_shifted(in.data(), out.data(), a.batch);
+        const double ef = max_rel_err(out, ref);
+        bf.inverse_shifted(in.data(), out.data(), a.batch);
+        const double ei = max_rel_err(out, ref_inv);
+        const bool ok = ef < 1e-5 && ei < 1e-5;
+        if (!ok) rc = 1;
+
+        // SoA: veri zaten blok düzeninde (çağıran doğrudan satırlara yazar)
+        const size_t blocks = a.batch / ofdm::kBatchLanes;
+        std::vector<float> re(ns), im(ns);
+        for (size_t i = 0; i < ns; ++i) { re[i] = in[i].real(); im[i] = in[i].imag(); }
+        const double r_soa = rate(a.seconds, a.batch, [&] { bf.transform_permuted(re.data(), im.data(), blocks, false); });
+        const double r_aos = rate(a.seconds, a.batch, [&] { bf.forward_shifted(in.data(), out.data(), a.batch); });
+
+        std::printf("  %-28s %12.3f Mtransforms/s  (x%.1f)\n", (name + " SoA kernel").c_str(), r_soa * 1e-6, r_soa / r_ref);
+        std::printf("  %-28s %12.3f Mtransforms/s  (x%.1f)  err fwd=%.1e inv=%.1e %s\n",
+                    (name + " AoS fwd shifted").c_str(), r_aos * 1e-6, r_aos / r_ref, ef, ei, ok ? "OK" : "FAIL");
+    }
+
+#ifdef OFDM_BENCH_FFTW
+    {
+        auto* fi = reinterpret_cast<fftwf_complex*>(fftwf_malloc(sizeof(fftwf_complex) * ns));
+        auto* fo = reinterpret_cast<fftwf_complex*>(fftwf_malloc(sizeof(fftwf_complex) * ns));
+        int dims[1] = { n };
+        fftwf_plan p = fftwf_plan_many_dft(1, dims, static_cast<int>(a.batch), fi, nullptr, 1, n,
+                                           fo, nullptr, 1, n, FFTW_FORWARD, FFTW_MEASURE);
+        std::copy(reinterpret_cast<const float*>(in.data()), reinterpret_cast<const float*>(in.data()) + 2 * ns,
+                  reinterpret_cast<float*>(fi));
+        const double r_w = rate(a.seconds, a.batch, [&] { fftwf_execute(p); });
+        std::printf("  %-28s %12.3f Mtransforms/s  (x%.1f, no fftshift)\n", "FFTW plan_many (MEASURE)", r_w * 1e-6, r_w / r_ref);
+        fftwf_destroy_plan(p);
+        fftwf_free(fi);
+        fftwf_free(fo);
+    }
+#else
+    std::printf("  (FFTW comparison: rebuild with -DOFDM_BENCH_FFTW -lfftw3f)\n");
+#endif
+    return rc;
+}
@@ -0,0 +1,614 @@
+// ofdm_link_sim.cpp
+// Uçtan uca bağlantı simülatörü: iki radyo olmadan tüm zincirin goodput'unu ölçer.
+//   kaynak -> rs_pack_container_ex -> wrap_file_bits_ratio -> Modulator
+//   -> kanal (çok yollu, CFO, AWGN, jammer) -> Receiver -> unwrap_file_bits
+//   -> (yumuşak kararda RSEH ipuçları) -> rs_unpack_container_ex -> kaynakla karşılaştırma
+//
+//   ofdm_link_sim [--input file | --size-kb 256] [--mod qpsk[,16qam,...]] [--snr 6:16:2]
+//                 [--r 16[,32]] [--il 16] [--slice 512] [--theta 4] [--packet-len 512] [--cp 0]
+//                 [--cfo 0.2] [--taps 0:1,3:0.3:90] [--jam SPEC]... [--rx hard|soft|both]
+//                 [--trials 4] [--threads 0] [--samp 4e6] [--chunk 4096] [--seed 1] [--csv out.csv]
+//
+// --snr a:b:adım ya da virgüllü liste; --mod/--r virgüllü liste, tüm kombinasyonlar taranır.
+// --taps gecikme(örnek):genlik[:faz_derece], güç toplamı 1'e normalize edilir.
+// --jam (tekrarlanabilir; JSR sinyal gücüne göre, jammer_detect'in gördüğü tipler):
+//   tone:f_hz:jsr_db                      sürekli ton (bant ortasına göre ofset)
+//   burst:jsr_db:on_ms:period_ms          geniş bant gürültü darbesi
+//   band:f_hz:bw_hz:jsr_db[:on_ms:period_ms]  kısmi bant gürültü (sürekli ya da darbeli)
+// JSR toplam güçler oranıdır: dar bantlı jammer birkaç taşıyıcıya yığıldığı için taşıyıcı
+// başına etkisi ~10*log10(52/kapsanan taşıyıcı) dB daha yüksektir (ton -10 dB'de paketleri bitirir).
+// --rx hard: GNU Radio gibi yalnız CRC'si geçen paketler; soft: tüm paketler + bayt
+// güvenilirliği RS silmelerine (rs_hints_add) çevrilir.
+//
+// Kanal ve alıcı denemeler arasında paralel koşar. rs_container.c ile bitunwrap süreç
+// geneli durum tuttuğu için (istatistik, ipuçları, son bayrak konumu) unwrap + RS çözme
+// tek kilit altında sıralanır; bu aşamaların süresi ayrıca raporlanır.
+// Rapor (ayar başına, denemelerin ortalaması): goodput = doğru kaynak bitleri / hava süresi,
+// artık BER (eksik/fazla bayt hata sayılır), tam kurtarılan deneme oranı, paket oranı ve
+// aşama başına thread CPU süresi (TX aşamaları ayar başına bir kez).
+// Derleme (MinGW/GCC; libfec: gerçek Karn libfec, Rs_Container/libfec yalnız arayüz taslağı):
+//   g++ -O3 -march=native -std=c++17 -I../Rs_Container/libfec bench/ofdm_link_sim.cpp ofdm_rx.cpp ofdm_tx.cpp
+//       ofdm_frame.cpp ../Checksum/checksum.c ofdm_fft.cpp ofdm_llr.cpp ofdm_eq.cpp ../Bitwrap/bitwrap.cpp ../Bitwrap/bitunwrap.cpp
+//       -x c ../Rs_Container/rs_container.c -x none -lfec -pthread -o ofdm_link_sim
+#include "../Include/ofdm_rx.hpp"
+#include "../Include/ofdm_tx.hpp"
+#include "../../Bitwrap/Include/bitwrap.hpp"
+#include "../../Bitwrap/Include/bitunwrap.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+  #include <process.h>
+#else
+  #include <time.h>
+  #include <unistd.h>
+#endif
+
+// rs_container.c (C, başlıksız DLL; services/rs_container.py ile aynı imzalar)
+extern "C" {
+struct RsStatsV1 {
+    uint64_t frames_total, slices_total_est, slices_ok, slices_bad, codewords_total,
+             symbols_total, data_symbols_total, corrected_symbols, used_erasures_cols, rs_fail_columns;
+    int      pad_mode_used;
+    double   ser_rs, ber_est;
+};
+int  rs_pack_container_ex(const char* in, const char* out, int r, int il_depth, int slice_bytes);
+int  rs_unpack_container_ex(const char* in, const char* out, int pad_mode);
+void rs_get_stats_v1(RsStatsV1* out);
+void rs_hints_clear(void);
+int  rs_hints_add(uint64_t offset, uint32_t len, int reliability);
+}
+
+namespace fs = std::filesystem;
+using ofdm::cf32;
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// services/bitwrap.py varsayılanları (bitiş bayrağı bunun tersi)
+const char* kStartFlag =
+    "0000000100100111011100011000110101101100011110001111111001011010011011001010001011000101010010111111110101001110011101110000001";
+
+const std::string& end_flag() {
+    static const std::string s(kStartFlag);
+    static const std::string e(s.rbegin(), s.rend());
+    return e;
+}
+
+double thread_cpu_s() {
+#if defined(_WIN32)
+    FILETIME c, e, k, u;
+    GetThreadTimes(GetCurrentThread(), &c, &e, &k, &u);
+    const auto t = [](const FILETIME& f) { return (static_cast<uint64_t>(f.dwHighDateTime) << 32) | f.dwLowDateTime; };
+    return 1e-7 * static_cast<double>(t(k) + t(u));
+#else
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) + 1e-9 * static_cast<double>(ts.tv_nsec);
+#endif
+}
+
+struct Tap { int delay = 0; cf32 g{1.f, 0.f}; };
+
+struct Jammer {
+    enum class Kind { Tone, Burst, Band } kind = Kind::Tone;
+    double f_hz = 0.0, bw_hz = 0.0, jsr_db = 0.0, on_ms = 0.0, period_ms = 0.0;
+};
+
+enum class RxMode { Hard, Soft };
+
+struct Args {
+    std::string input;
+    size_t      size_kb = 256;
+    std::vector<ofdm::Modulation> mods{ ofdm::Modulation::QPSK };
+    std::vector<double> snrs{ 6, 8, 10, 12, 14, 16 };
+    std::vector<int>    rs_r{ 16 };
+    int         il = 16, slice = 512;
+    double      theta = 4.0;
+    int         packet_len = 512, cp = 0;
+    double      cfo = 0.2;                 // taşıyıcı aralığı
+    std::vector<Tap>    taps;
+    std::vector<Jammer> jams;
+    std::vector<RxMode> rx{ RxMode::Hard, RxMode::Soft };
+    int         trials = 4, threads = 0;
+    double      samp = 4e6;
+    size_t      chunk = 4096;
+    unsigned    seed = 1;
+    std::string csv;
+};
+
+bool split(const std::string& s, char d, std::vector<std::string>& out) {
+    out.clear();
+    size_t p = 0;
+    while (p <= s.size()) {
+        const size_t e = std::min(s.find(d, p), s.size());
+        out.push_back(s.substr(p, e - p));
+        p = e + 1;
+    }
+    return !out.empty();
+}
+
+bool parse_jam(const std::string& s, Jammer& j) {
+    std::vector<std::string> f;
+    split(s, ':', f);
+    auto num = [&](size_t i) { return std::atof(f[i].c_str()); };
+    if (f[0] == "tone" && f.size() == 3)  { j.kind = Jammer::Kind::Tone;  j.f_hz = num(1); j.jsr_db = num(2); return true; }
+    if (f[0] == "burst" && f.size() == 4) { j.kind = Jammer::Kind::Burst; j.jsr_db = num(1); j.on_ms = num(2); j.period_ms = num(3); return true; }
+    if (f[0] == "band" && (f.size() == 4 || f.size() == 6)) {
+        j.kind = Jammer::Kind::Band; j.f_hz = num(1); j.bw_hz = num(2); j.jsr_db = num(3);
+        if (f.size() == 6) { j.on_ms = num(4); j.period_ms = num(5); }
+        return j.bw_hz > 0.0;
+    }
+    return false;
+}
+
+bool parse(int argc, char** argv, Args& a) {
+    std::vector<std::string> f;
+    for (int i = 1; i < argc; ++i) {
+        const std::string k = argv[i];
+        auto val = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if (!(v = val())) return false;
+        if      (k == "--input")      a.input = v;
+        else if (k == "--size-kb")    a.size_kb = static_cast<size_t>(std::atol(v));
+        else if (k == "--mod") {
+            a.mods.clear();
+            split(v, ',', f);
+            for (const auto& m : f) { ofdm::Modulation x; if (!ofdm::parse_modulation(m.c_str(), x)) return false; a.mods.push_back(x); }
+        }
+        else if (k == "--snr") {
+            a.snrs.clear();
+            split(v, ':', f);
+            if (f.size() == 3) {
+                const double s0 = std::atof(f[0].c_str()), s1 = std::atof(f[1].c_str()), st = std::atof(f[2].c_str());
+                if (!(st > 0)) return false;
+                for (double s = s0; s <= s1 + 1e-9; s += st) a.snrs.push_back(s);
+            } else {
+                split(v, ',', f);
+                for (const auto& s : f) a.snrs.push_back(std::atof(s.c_str()));
+            }
+        }
+        else if (k == "--r")          { a.rs_r.clear(); split(v, ',', f); for (const auto& s : f) a.rs_r.push_back(std::atoi(s.c_str())); }
+        else if (k == "--il")         a.il = std::atoi(v);
+        else if (k == "--slice")      a.slice = std::atoi(v);
+        else if (k == "--theta")      a.theta = std::atof(v);
+        else if (k == "--packet-len") a.packet_len = std::atoi(v);
+        else if (k == "--cp")         a.cp = std::atoi(v);
+        else if (k == "--cfo")        a.cfo = std::atof(v);
+        else if (k == "--taps") {
+            a.taps.clear();
+            split(v, ',', f);
+            std::vector<std::string> t;
+            for (const auto& s : f) {
+                split(s, ':', t);
+                if (t.size() < 2) return false;
+                const double ph = t.size() > 2 ? std::atof(t[2].c_str()) * kPi / 180.0 : 0.0;
+                a.taps.push_back({ std::atoi(t[0].c_str()), std::polar(static_cast<float>(std::atof(t[1].c_str())), static_cast<float>(ph)) });
+            }
+        }
+        else if (k == "--jam")        { Jammer j; if (!parse_jam(v, j)) return false; a.jams.push_back(j); }
+        else if (k == "--rx") {
+            const std::string m = v;
+            if      (m == "hard") a.rx = { RxMode::Hard };
+            else if (m == "soft") a.rx = { RxMode::Soft };
+            else if (m == "both") a.rx = { RxMode::Hard, RxMode::Soft };
+            else return false;
+        }
+        else if (k == "--trials")     a.trials = std::atoi(v);
+        else if (k == "--threads")    a.threads = std::atoi(v);
+        else if (k == "--samp")       a.samp = std::atof(v);
+        else if (k == "--chunk")      a.chunk = static_cast<size_t>(std::atol(v));
+        else if (k == "--seed")       a.seed = static_cast<unsigned>(std::atol(v));
+        else if (k == "--csv")        a.csv = v;
+        else return false;
+    }
+    return a.trials > 0 && a.packet_len > 0 && a.chunk > 0 && !a.mods.empty() && !a.snrs.empty() && !a.rs_r.empty();
+}
+
+bool read_all(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream f(path, std::ios::binary | std::ios::ate);
+    if (!f) return false;
+    out.resize(static_cast<size_t>(f.tellg()));
+    f.seekg(0);
+    return static_cast<bool>(f.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size())));
+}
+
+bool write_all(const std::string& path, const void* p, size_t n) {
+    std::ofstream f(path, std::ios::binary);
+    f.write(static_cast<const char*>(p), static_cast<std::streamsize>(n));
+    return static_cast<bool>(f);
+}
+
+// Kaynakla karşılaştırma: hatalı bit (eksik/fazla baytlar 8 bit hata) ve aynı konumda doğru bayt
+void compare(const std::vector<uint8_t>& ref, const std::vector<uint8_t>& got, uint64_t& bit_err, uint64_t& ok_bytes) {
+    const size_t n = std::min(ref.size(), got.size());
+    bit_err = 8u * static_cast<uint64_t>(std::max(ref.size(), got.size()) - n);
+    ok_bytes = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned x = ref[i] ^ got[i];
+        if (!x) ++ok_bytes;
+        else    bit_err += static_cast<uint64_t>(std::bitset<8>(x).count());
+    }
+}
+
+// Ayar başına bir kez: RS + bitwrap + modülasyon (TX zinciri kanaldan bağımsız)
+struct TxSetting {
+    ofdm::Modulation  mod;
+    int               r = 16;
+    std::vector<cf32> wave;        // paketler arka arkaya (GR TX gibi boşluksuz)
+    size_t            packets = 0;
+    double            sig_pow = 0.0;
+    double            cpu_pack = 0.0, cpu_wrap = 0.0, cpu_mod = 0.0;
+};
+
+struct Setting {
+    size_t tx = 0;    // TxSetting indeksi
+    double snr = 0.0;
+    RxMode rx = RxMode::Hard;
+};
+
+struct TrialResult {
+    uint64_t bit_err = 0, ok_bytes = 0;
+    bool     exact = false;
+    uint64_t pk_ok = 0, pk_all = 0;
+    uint64_t rs_corrected = 0, rs_fail_cols = 0, erasure_cols = 0;
+    double   cpu_chan = 0.0, cpu_rx = 0.0, cpu_unwrap = 0.0, cpu_rs = 0.0;
+};
+
+std::mutex g_fec_m;   // rs_container.c / bitunwrap süreç geneli durum
+
+class Channel {
+public:
+    Channel(const Args& a, double snr_db, double sig_pow, uint64_t seed)
+        : a_(a), rng_(static_cast<std::mt19937::result_type>(seed)) {
+        taps_ = a.taps;
+        if (taps_.empty()) taps_.push_back(Tap{});
+        double p = 0.0;
+        for (const auto& t : taps_) p += std::norm(t.g);
+        for (auto& t : taps_) t.g *= static_cast<float>(1.0 / std::sqrt(p));
+        nstd_ = static_cast<float>(std::sqrt(sig_pow / std::pow(10.0, snr_db / 10.0) / 2.0));
+        for (const auto& j : a.jams) jstd_.push_back(std::sqrt(sig_pow * std::pow(10.0, j.jsr_db / 10.0)));
+        start_ph_ = std::uniform_real_distribution<double>(0.0, 2.0 * kPi)(rng_);
+    }
+
+    // Lead-in/tail sessizlik eklenmiş kanal çıktısı
+    void run(const std::vector<cf32>& x, std::vector<cf32>& y) {
+        const size_t lead = 2000, tail = 2000;
+        int maxd = 0;
+        for (const auto& t : taps_) maxd = std::max(maxd, t.delay);
+        y.assign(lead + x.size() + static_cast<size_t>(maxd) + tail, cf32{});
+        for (const auto& t : taps_)
+            for (size_t i = 0; i < x.size(); ++i) y[lead + i + static_cast<size_t>(t.delay)] += x[i] * t.g;
+
+        // CFO (taşıyıcı aralığı cinsinden -> örnek başına faz)
+        const double w = 2.0 * kPi * a_.cfo / ofdm::kFftLen;
+        cf32 rot = std::polar(1.f, static_cast<float>(start_ph_));
+        const cf32 step = std::polar(1.f, static_cast<float>(w));
+        for (size_t i = 0; i < y.size(); ++i) {
+            y[i] *= rot;
+            rot *= step;
+            if ((i & 1023) == 1023) rot /= std::abs(rot);
+        }
+
+        std::normal_distribution<float> nd(0.f, 1.f);
+        for (auto& v : y) v += cf32(nd(rng_) * nstd_, nd(rng_) * nstd_);
+
+        for (size_t k = 0; k < a_.jams.size(); ++k) add_jammer(a_.jams[k], jstd_[k], y);
+    }
+
+private:
+    bool on(const Jammer& j, size_t i) const {
+        if (!(j.on_ms > 0.0 && j.period_ms > 0.0)) return true;
+        const double tms = 1e3 * static_cast<double>(i) / a_.samp;
+        return std::fmod(tms + phase_ms_, j.period_ms) < j.on_ms;
+    }
+
+    void add_jammer(const Jammer& j, double amp, std::vector<cf32>& y) {
+        std::normal_distribution<float> nd(0.f, static_cast<float>(amp / std::sqrt(2.0)));
+        phase_ms_ = (j.period_ms > 0.0) ? std::uniform_real_distribution<double>(0.0, j.period_ms)(rng_) : 0.0;
+        const cf32 step = std::polar(1.f, static_cast<float>(2.0 * kPi * j.f_hz / a_.samp));
+        cf32 rot(1.f, 0.f);
+        switch (j.kind) {
+            case Jammer::Kind::Tone:
+                for (size_t i = 0; i < y.size(); ++i, rot *= step) {
+                    y[i] += rot * static_cast<float>(amp);
+                    if ((i & 1023) == 1023) rot /= std::abs(rot);
+                }
+                break;
+            case Jammer::Kind::Burst:
+                for (size_t i = 0; i < y.size(); ++i)
+                    if (on(j, i)) y[i] += cf32(nd(rng_), nd(rng_));
+                break;
+            case Jammer::Kind::Band: {
+                // Beyaz gürültü -> L örneklik kayan ortalama (~bw) -> f_hz'e kaydırma; güç korunur
+                const int L = std::max(1, static_cast<int>(std::lround(a_.samp / j.bw_hz)));
+                const float g = static_cast<float>(std::sqrt(static_cast<double>(L)));
+                std::vector<cf32> hist(static_cast<size_t>(L), cf32{});
+                cf32 acc{};
+                for (size_t i = 0; i < y.size(); ++i, rot *= step) {
+                    const cf32 nz(nd(rng_), nd(rng_));
+                    cf32& slot = hist[i % static_cast<size_t>(L)];
+                    acc += nz - slot;
+                    slot = nz;
+                    if (on(j, i)) y[i] += rot * acc / g;
+                    if ((i & 1023) == 1023) rot /= std::abs(rot);
+                }
+                break;
+            }
+        }
+    }
+
+    const Args&        a_;
+    std::mt19937       rng_;
+    std::vector<Tap>   taps_;
+    std::vector<double> jstd_;
+    float              nstd_ = 0.f;
+    double             start_ph_ = 0.0, phase_ms_ = 0.0;
+};
+
+bool build_tx(const Args& a, const std::string& src_path, const std::string& tmp, TxSetting& t) {
+    const std::string rse = tmp + "/tx_" + std::to_string(t.r) + ".rse";
+    const std::string bw  = tmp + "/tx_" + std::to_string(t.r) + ".bw";
+    double c0 = thread_cpu_s();
+    if (rs_pack_container_ex(src_path.c_str(), rse.c_str(), t.r, a.il, a.slice) != 0) return false;
+    double c1 = thread_cpu_s();
+    if (wrap_file_bits_ratio(rse.c_str(), bw.c_str(), kStartFlag, end_flag().c_str(), a.theta, 0) != 0) return false;
+    double c2 = thread_cpu_s();
+    t.cpu_pack = c1 - c0;
+    t.cpu_wrap = c2 - c1;
+
+    std::vector<uint8_t> w;
+    if (!read_all(bw, w)) return false;
+    ofdm::TxParams tp;
+    tp.mod = t.mod;
+    tp.packet_len = a.packet_len;
+    tp.cp_len = a.cp;
+    ofdm::Modulator m(tp);
+    const size_t ns = static_cast<size_t>(m.packet_samples());
+    t.packets = w.size() / static_cast<size_t>(a.packet_len);   // son eksik paket GR gibi gönderilmez
+    t.wave.resize(t.packets * ns);
+    c0 = thread_cpu_s();
+    for (size_t k = 0; k < t.packets; ++k)
+        m.modulate(w.data() + k * static_cast<size_t>(a.packet_len), t.wave.data() + k * ns);
+    t.cpu_mod = thread_cpu_s() - c0;
+    double p = 0.0;
+    for (const auto& v : t.wave) p += std::norm(v);
+    t.sig_pow = t.wave.empty() ? 1.0 : p / static_cast<double>(t.wave.size());
+    return true;
+}
+
+struct HintRun { uint64_t off; uint32_t len; uint8_t rel; };
+
+TrialResult run_trial(const Args& a, const TxSetting& t, const Setting& s, const std::vector<uint8_t>& src,
+                      uint64_t seed, const std::string& tdir, std::vector<cf32>& y) {
+    TrialResult res;
+    double c0 = thread_cpu_s();
+    Channel ch(a, s.snr, t.sig_pow, seed);
+    ch.run(t.wave, y);
+    double c1 = thread_cpu_s();
+    res.cpu_chan = c1 - c0;
+
+    ofdm::RxParams rp;
+    rp.mod = t.mod;
+    rp.cp_len = a.cp;
+    rp.soft = (s.rx == RxMode::Soft);
+    rp.deliver_crc_fail = rp.soft;
+    std::vector<uint8_t> stream;
+    std::vector<HintRun> hints;
+    {
+        ofdm::Receiver rx(rp, [&](const ofdm::RxPacket& pk) {
+            const uint64_t pos = stream.size();
+            stream.insert(stream.end(), pk.data, pk.data + pk.len);
+            ++res.pk_all;
+            if (pk.crc_ok) ++res.pk_ok;
+            if (!pk.reliability) return;
+            // ofdm_rx_file_ex ile aynı: < 230 baytlar, 16'lık güvenilirlik kovasına göre aralık
+            for (int i = 0; i < pk.len;) {
+                const uint8_t r = pk.reliability[i];
+                if (r >= 230) { ++i; continue; }
+                HintRun h{ pos + static_cast<uint64_t>(i), 0u, r };
+                int j = i;
+                while (j < pk.len && pk.reliability[j] < 230 && (pk.reliability[j] >> 4) == (r >> 4)) {
+                    h.rel = std::min(h.rel, pk.reliability[j]);
+                    ++j;
+                }
+                h.len = static_cast<uint32_t>(j - i);
+                hints.push_back(h);
+                i = j;
+            }
+        });
+        for (size_t i = 0; i < y.size(); i += a.chunk) rx.push(y.data() + i, std::min(a.chunk, y.size() - i));
+    }
+    if (!rp.soft) res.pk_all = res.pk_ok;
+    double c2 = thread_cpu_s();
+    res.cpu_rx = c2 - c1;
+
+    const std::string rxs = tdir + "/rx.bin", rse = tdir + "/rx.rse", out = tdir + "/out.bin";
+    write_all(rxs, stream.data(), stream.size());
+    std::vector<uint8_t> dec;
+    {
+        std::lock_guard<std::mutex> lk(g_fec_m);
+        const double u0 = thread_cpu_s();
+        const int urc = unwrap_file_bits(rxs.c_str(), rse.c_str(), kStartFlag, end_flag().c_str());
+        const uint64_t base = get_last_start_flag_pos() + std::strlen(kStartFlag);
+        const double u1 = thread_cpu_s();
+        res.cpu_unwrap = u1 - u0;
+        if (urc == 0) {
+            // rs_hints_load ile aynı dönüşüm: akış baytları -> kapsayan konteyner baytları
+            rs_hints_clear();
+            for (const auto& h : hints) {
+                uint64_t b0 = h.off * 8u, b1 = (h.off + h.len) * 8u;
+                if (b1 <= base) continue;
+                b0 = (b0 > base) ? b0 - base : 0;
+                b1 -= base;
+                rs_hints_add(b0 / 8u, static_cast<uint32_t>((b1 + 7u) / 8u - b0 / 8u), h.rel);
+            }
+            if (rs_unpack_container_ex(rse.c_str(), out.c_str(), 0) == 0) read_all(out, dec);
+            RsStatsV1 st{};
+            rs_get_stats_v1(&st);
+            res.rs_corrected = st.corrected_symbols;
+            res.rs_fail_cols = st.rs_fail_columns;
+            res.erasure_cols = st.used_erasures_cols;
+            rs_hints_clear();
+        }
+        res.cpu_rs = thread_cpu_s() - u1;
+    }
+    compare(src, dec, res.bit_err, res.ok_bytes);
+    res.exact = (res.bit_err == 0);
+    return res;
+}
+
+const char* mod_name(ofdm::Modulation m) {
+    switch (m) {
+        case ofdm::Modulation::BPSK:  return "bpsk";
+        case ofdm::Modulation::QPSK:  return "qpsk";
+        case ofdm::Modulation::QAM16: return "16qam";
+    }
+    return "?";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Args a;
+    if (!parse(argc, argv, a)) {
+        std::fprintf(stderr,
+            "usage: ofdm_link_sim [--input file | --size-kb N] [--mod qpsk,16qam] [--snr a:b:step | s1,s2]\n"
+            "                     [--r 16,32] [--il N] [--slice N] [--theta T] [--packet-len N] [--cp N]\n"
+            "                     [--cfo C] [--taps d:g[:deg],...] [--jam tone:f:jsr | burst:jsr:on:per |\n"
+            "                      band:f:bw:jsr[:on:per]]... [--rx hard|soft|both] [--trials N] [--threads N]\n"
+            "                     [--samp Hz] [--chunk N] [--seed S] [--csv out.csv]\n");
+        return 2;
+    }
+
+#if defined(_WIN32)
+    const int pid = _getpid();
+#else
+    const int pid = static_cast<int>(getpid());
+#endif
+    const fs::path tmp = fs::temp_directory_path() / ("ofdm_link_sim_" + std::to_string(pid));
+    fs::create_directories(tmp);
+
+    std::vector<uint8_t> src;
+    std::string src_path = a.input;
+    if (src_path.empty()) {
+        src.resize(a.size_kb * 1024);
+        std::mt19937 rng(a.seed);
+        for (auto& b : src) b = static_cast<uint8_t>(rng());
+        src_path = (tmp / "src.bin").string();
+        write_all(src_path, src.data(), src.size());
+    } else if (!read_all(src_path, src) || src.empty()) {
+        std::fprintf(stderr, "cannot read input: %s\n", src_path.c_str());
+        return 2;
+    }
+
+    // TX zinciri: (mod, r) başına bir kez
+    std::vector<TxSetting> txs;
+    for (auto m : a.mods)
+        for (int r : a.rs_r) {
+            TxSetting t;
+            t.mod = m;
+            t.r = r;
+            if (!build_tx(a, src_path, tmp.string(), t)) {
+                std::fprintf(stderr, "TX chain failed (mod=%s r=%d)\n", mod_name(m), r);
+                return 1;
+            }
+            txs.push_back(std::move(t));
+        }
+
+    std::vector<Setting> sets;
+    for (size_t ti = 0; ti < txs.size(); ++ti)
+        for (double snr : a.snrs)
+            for (RxMode rx : a.rx) sets.push_back({ ti, snr, rx });
+
+    const size_t jobs = sets.size() * static_cast<size_t>(a.trials);
+    const int nth = a.threads > 0 ? a.threads
+                                  : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<TrialResult> results(jobs);
+    std::atomic<size_t> next{0};
+    const auto w0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int w = 0; w < nth; ++w) {
+        pool.emplace_back([&, w]() {
+            const std::string tdir = (tmp / ("w" + std::to_string(w))).string();
+            fs::create_directories(tdir);
+            std::vector<cf32> y;
+            for (size_t j; (j = next.fetch_add(1)) < jobs;) {
+                const Setting& s = sets[j / static_cast<size_t>(a.trials)];
+                const uint64_t seed = (static_cast<uint64_t>(a.seed) << 32) ^ (j * 0x9E3779B97F4A7C15ull);
+                results[j] = run_trial(a, txs[s.tx], s, src, seed, tdir, y);
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - w0).count();
+
+    std::FILE* csv = a.csv.empty() ? nullptr : std::fopen(a.csv.c_str(), "w");
+    if (csv) std::fprintf(csv, "mod,r,snr_db,rx,trials,goodput_bps,residual_ber,exact_frac,pk_ok_frac,"
+                               "rs_fail_cols,erasure_cols,ms_chan,ms_rx,ms_unwrap,ms_rs\n");
+
+    std::printf("source %zu B | cfo %.2f | taps %zu | jammers %zu | %d trials x %zu settings on %d threads, %.1f s wall\n",
+                src.size(), a.cfo, std::max<size_t>(a.taps.size(), 1), a.jams.size(), a.trials, sets.size(), nth, wall);
+    for (const auto& t : txs)
+        std::printf("TX %-5s r=%-2d packets=%zu air=%.2f s | cpu ms: pack %.1f wrap %.1f mod %.1f\n",
+                    mod_name(t.mod), t.r, t.packets, static_cast<double>(t.wave.size()) / a.samp,
+                    1e3 * t.cpu_pack, 1e3 * t.cpu_wrap, 1e3 * t.cpu_mod);
+    std::printf("%-5s %3s %6s %-4s | %12s %10s %6s %6s | %7s %7s | %8s %8s %8s %8s\n",
+                "mod", "r", "snr", "rx", "goodput b/s", "resid BER", "exact", "pk_ok", "failcol", "erscol",
+                "chan ms", "rx ms", "unwr ms", "rs ms");
+    for (size_t si = 0; si < sets.size(); ++si) {
+        const Setting&  s = sets[si];
+        const TxSetting& t = txs[s.tx];
+        TrialResult acc;
+        int exact = 0;
+        for (int k = 0; k < a.trials; ++k) {
+            const TrialResult& r = results[si * static_cast<size_t>(a.trials) + static_cast<size_t>(k)];
+            acc.bit_err += r.bit_err; acc.ok_bytes += r.ok_bytes; exact += r.exact ? 1 : 0;
+            acc.pk_ok += r.pk_ok; acc.rs_fail_cols += r.rs_fail_cols; acc.erasure_cols += r.erasure_cols;
+            acc.cpu_chan += r.cpu_chan; acc.cpu_rx += r.cpu_rx; acc.cpu_unwrap += r.cpu_unwrap; acc.cpu_rs += r.cpu_rs;
+        }
+        const double n    = static_cast<double>(a.trials);
+        const double air  = static_cast<double>(t.wave.size()) / a.samp;
+        const double gput = 8.0 * static_cast<double>(acc.ok_bytes) / n / air;
+        const double ber  = static_cast<double>(acc.bit_err) / (8.0 * static_cast<double>(src.size()) * n);
+        const double pko  = t.packets ? static_cast<double>(acc.pk_ok) / (static_cast<double>(t.packets) * n) : 0.0;
+        const char*  rx   = s.rx == RxMode::Soft ? "soft" : "hard";
+        std::printf("%-5s %3d %6.1f %-4s | %12.0f %10.3g %6.2f %6.3f | %7.1f %7.1f | %8.1f %8.1f %8.1f %8.1f\n",
+                    mod_name(t.mod), t.r, s.snr, rx, gput, ber, exact / n, pko,
+                    acc.rs_fail_cols / n, acc.erasure_cols / n,
+                    1e3 * acc.cpu_chan / n, 1e3 * acc.cpu_rx / n, 1e3 * acc.cpu_unwrap / n, 1e3 * acc.cpu_rs / n);
+        if (csv)
+            std::fprintf(csv, "%s,%d,%.2f,%s,%d,%.0f,%.6g,%.3f,%.4f,%.1f,%.1f,%.2f,%.2f,%.2f,%.2f\n",
+                         mod_name(t.mod), t.r, s.snr, rx, a.trials, gput, ber, exact / n, pko,
+                         acc.rs_fail_cols / n, acc.erasure_cols / n,
+                         1e3 * acc.cpu_chan / n, 1e3 * acc.cpu_rx / n, 1e3 * acc.cpu_unwrap / n, 1e3 * acc.cpu_rs / n);
+    }
+    if (csv) std::fclose(csv);
+
+    std::error_code ec;
+    fs::remove_all(tmp, ec);
+    return 0;
+}
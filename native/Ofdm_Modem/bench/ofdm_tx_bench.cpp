@@ -0,0 +1,129 @@
+// ofdm_tx_bench.cpp
+// Native OFDM modülatör: örnek/sn ölçümü ve GNU Radio altın vektör karşılaştırması.
+//
+//   ofdm_tx_bench [--mod qpsk] [--packet-len 512] [--cp 0] [--amp 0.03] [--seconds 2]
+//   ofdm_tx_bench --input file.bin --golden tx_gr.cf32 [--mod ...] [--tol 1e-5]
+//
+// Altın vektör scripts/ofdm_golden_tx.py ile aynı parametrelerle üretilir.
+// Derleme (MinGW/GCC):
+//   g++ -O3 -march=native -std=c++17 bench/ofdm_tx_bench.cpp ofdm_tx.cpp ofdm_frame.cpp ../Checksum/checksum.c ofdm_fft.cpp -o ofdm_tx_bench
+#include "../Include/ofdm_tx.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Args {
+    ofdm::TxParams p;
+    double      seconds = 2.0;
+    std::string input;
+    std::string golden;
+    double      tol = 1e-5;     // tepe genliğe göre bağıl hata (FFT yuvarlama ~1e-7)
+};
+
+static bool parse(int argc, char** argv, Args& a) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string k = argv[i];
+        auto val = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if      (k == "--mod")        { if (!(v = val()) || !ofdm::parse_modulation(v, a.p.mod)) return false; }
+        else if (k == "--packet-len") { if (!(v = val())) return false; a.p.packet_len = std::atoi(v); }
+        else if (k == "--cp")         { if (!(v = val())) return false; a.p.cp_len = std::atoi(v); }
+        else if (k == "--amp")        { if (!(v = val())) return false; a.p.amp = static_cast<float>(std::atof(v)); }
+        else if (k == "--seconds")    { if (!(v = val())) return false; a.seconds = std::atof(v); }
+        else if (k == "--input")      { if (!(v = val())) return false; a.input = v; }
+        else if (k == "--golden")     { if (!(v = val())) return false; a.golden = v; }
+        else if (k == "--tol")        { if (!(v = val())) return false; a.tol = std::atof(v); }
+        else return false;
+    }
+    return true;
+}
+
+static bool read_all(const std::string& path, std::vector<char>& out) {
+    std::ifstream f(path, std::ios::binary | std::ios::ate);
+    if (!f) return false;
+    out.resize(static_cast<size_t>(f.tellg()));
+    f.seekg(0);
+    return static_cast<bool>(f.read(out.data(), static_cast<std::streamsize>(out.size())));
+}
+
+// Girdi dosyasını modüle edip GNU Radio çıktısıyla örnek örnek karşılaştırır
+static int run_golden(const Args& a) {
+    std::vector<char> in, gold;
+    if (!read_all(a.input, in))   { std::fprintf(stderr, "cannot read input: %s\n", a.input.c_str()); return 2; }
+    if (!read_all(a.golden, gold)) { std::fprintf(stderr, "cannot read golden: %s\n", a.golden.c_str()); return 2; }
+
+    ofdm::Modulator mod(a.p);
+    const size_t npk = in.size() / static_cast<size_t>(a.p.packet_len);
+    const size_t ns  = static_cast<size_t>(mod.packet_samples());
+    std::vector<ofdm::cf32> iq(npk * ns);
+    for (size_t k = 0; k < npk; ++k)
+        mod.modulate(reinterpret_cast<const uint8_t*>(in.data()) + k * static_cast<size_t>(a.p.packet_len), iq.data() + k * ns);
+
+    const size_t ng = gold.size() / sizeof(ofdm::cf32);
+    const auto*  g  = reinterpret_cast<const ofdm::cf32*>(gold.data());
+    std::printf("packets=%zu samples native=%zu golden=%zu\n", npk, iq.size(), ng);
+    if (ng != iq.size()) { std::printf("FAIL: length mismatch\n"); return 1; }
+
+    double peak = 0.0, max_err = 0.0, acc = 0.0;
+    size_t worst = 0;
+    for (size_t i = 0; i < ng; ++i) {
+        peak = std::max(peak, static_cast<double>(std::abs(g[i])));
+        const double e = std::abs(iq[i] - g[i]);
+        acc += e * e;
+        if (e > max_err) { max_err = e; worst = i; }
+    }
+    const double rel = (peak > 0.0) ? max_err / peak : max_err;
+    std::printf("peak=%.6g max_err=%.3g (rel %.3g @%zu, symbol %zu) rms_err=%.3g\n",
+                peak, max_err, rel, worst, worst / static_cast<size_t>(ofdm::kFftLen + (a.p.cp_len > 0 ? a.p.cp_len : ofdm::kDefaultCp)),
+                std::sqrt(acc / std::max<size_t>(ng, 1)));
+    const bool ok = rel <= a.tol;
+    std::printf("%s (tol %.1e)\n", ok ? "PASS" : "FAIL", a.tol);
+    return ok ? 0 : 1;
+}
+
+static int run_bench(const Args& a) {
+    ofdm::Modulator mod(a.p);
+    const int npk = 64;
+    std::vector<uint8_t> data(static_cast<size_t>(a.p.packet_len) * npk);
+    std::mt19937 rng(1);
+    for (auto& b : data) b = static_cast<uint8_t>(rng());
+    std::vector<ofdm::cf32> iq(static_cast<size_t>(mod.packet_samples()));
+
+    using clk = std::chrono::steady_clock;
+    uint64_t packets = 0;
+    const auto t0 = clk::now();
+    double el = 0.0;
+    do {
+        for (int k = 0; k < npk; ++k) mod.modulate(data.data() + static_cast<size_t>(k) * a.p.packet_len, iq.data());
+        packets += npk;
+        el = std::chrono::duration<double>(clk::now() - t0).count();
+    } while (el < a.seconds);
+
+    const double sps = static_cast<double>(packets) * mod.packet_samples() / el;
+    const auto&  d   = mod.dims();
+    std::printf("mod=%d bps packet_len=%d cp=%d | %d OFDM sym/packet, %d samples/packet\n",
+                ofdm::bits_per_symbol(a.p.mod), a.p.packet_len, (d.samples / d.ofdm_syms) - ofdm::kFftLen,
+                d.ofdm_syms, d.samples);
+    std::printf("packets/s=%.0f  Msamples/s=%.2f  payload Mbit/s=%.2f  ns/sample=%.2f\n",
+                packets / el, sps * 1e-6, packets * a.p.packet_len * 8.0 / el * 1e-6, 1e9 / sps);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    Args a;
+    if (!parse(argc, argv, a)) {
+        std::fprintf(stderr, "usage: ofdm_tx_bench [--mod bpsk|qpsk|16qam] [--packet-len N] [--cp N] [--amp A]\n"
+                             "                     [--seconds S] [--input file --golden gr.cf32 [--tol T]]\n");
+        return 2;
+    }
+    if (!a.golden.empty()) return run_golden(a);
+    return run_bench(a);
+}
@@ -0,0 +1,357 @@
+#include "Include/ofdm_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_WIN32)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+  #include <process.h>
+  #define getpid_ _getpid
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define getpid_ getpid
+#endif
+
+namespace fs = std::filesystem;
+
+namespace ofdm {
+
+// ------------------------------------------------------------ SHA-256 (FIPS 180-4)
+
+namespace {
+
+struct Sha256 {
+    uint32_t h[8] = { 0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+                      0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u };
+    uint8_t  blk[64];
+    size_t   fill = 0;
+    uint64_t total = 0;
+
+    static uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    void compress(const uint8_t* p) {
+        static const uint32_t K[64] = {
+            0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u,
+            0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u,
+            0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+            0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u, 0x06ca6351u, 0x14292967u,
+            0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+            0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+            0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu, 0x682e6ff3u,
+            0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u, 0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u };
+        uint32_t w[64];
+        for (int i = 0; i < 16; ++i)
+            w[i] = (uint32_t(p[4 * i]) << 24) | (uint32_t(p[4 * i + 1]) << 16) |
+                   (uint32_t(p[4 * i + 2]) << 8) | uint32_t(p[4 * i + 3]);
+        for (int i = 16; i < 64; ++i) {
+            const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], k = h[7];
+        for (int i = 0; i < 64; ++i) {
+            const uint32_t t1 = k + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+            const uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            k = g; g = f; f = e; e = d + t1; d = c; c = b; b = a; a = t1 + t2;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e; h[5] += f; h[6] += g; h[7] += k;
+    }
+
+    void update(const uint8_t* p, size_t n) {
+        total += n;
+        if (fill) {
+            const size_t t = std::min(n, 64 - fill);
+            std::memcpy(blk + fill, p, t);
+            fill += t; p += t; n -= t;
+            if (fill < 64) return;
+            compress(blk);
+            fill = 0;
+        }
+        for (; n >= 64; p += 64, n -= 64) compress(p);
+        std::memcpy(blk, p, n);
+        fill = n;
+    }
+
+    void final(uint8_t out[32]) {
+        const uint64_t bits = total * 8;
+        const uint8_t one = 0x80, zero = 0;
+        update(&one, 1);
+        while (fill != 56) update(&zero, 1);
+        uint8_t len[8];
+        for (int i = 0; i < 8; ++i) len[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+        update(len, 8);
+        for (int i = 0; i < 8; ++i)
+            for (int j = 0; j < 4; ++j) out[4 * i + j] = static_cast<uint8_t>(h[i] >> (24 - 8 * j));
+    }
+};
+
+bool sha256_file(const std::string& path, uint8_t out[32]) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+    Sha256 s;
+    std::vector<uint8_t> buf(1 << 20);
+    while (f) {
+        f.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+        s.update(buf.data(), static_cast<size_t>(f.gcount()));
+    }
+    s.final(out);
+    return true;
+}
+
+const char* mod_name(Modulation m) {
+    switch (m) {
+        case Modulation::BPSK:  return "bpsk";
+        case Modulation::QPSK:  return "qpsk";
+        case Modulation::QAM16: return "16qam";
+    }
+    return "x";
+}
+
+std::string entry_name(const uint8_t digest[16], const TxParams& p) {
+    char hex[33];
+    for (int i = 0; i < 16; ++i) std::snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+    uint32_t ab;
+    std::memcpy(&ab, &p.amp, 4);   // amp ikili olarak: 0.03 ile 0.0300001 ayrı girdiler
+    char name[128];
+    std::snprintf(name, sizeof(name), "%s-%s-p%d-cp%d-a%08x.cs16", hex, mod_name(p.mod),
+                  p.packet_len, p.cp_len > 0 ? p.cp_len : kDefaultCp, ab);
+    return name;
+}
+
+std::atomic<unsigned> g_tmp_seq{0};
+
+} // namespace
+
+// ------------------------------------------------------------ cs16
+
+void to_cs16(const cf32* in, int16_t* out, size_t n) {
+    const float* f = reinterpret_cast<const float*>(in);
+    for (size_t i = 0; i < 2 * n; ++i) {
+        float v = f[i] * 2048.f;
+        v = v < -2048.f ? -2048.f : (v > 2047.f ? 2047.f : v);
+        const int q = static_cast<int>(v + (v >= 0.f ? 0.5f : -0.5f));
+        out[i] = static_cast<int16_t>(q * 16);
+    }
+}
+
+// ------------------------------------------------------------ WaveformCache
+
+WaveformCache::WaveformCache(std::string dir) : dir_(std::move(dir)) {
+    std::error_code ec;
+    fs::create_directories(dir_, ec);
+    if (!fs::is_directory(dir_)) throw std::runtime_error("cache dir not usable: " + dir_);
+}
+
+std::string WaveformCache::entry_path(const std::string& in_path, const TxParams& p) const {
+    uint8_t d[32];
+    if (!sha256_file(in_path, d)) throw std::runtime_error("cannot read input: " + in_path);
+    return (fs::path(dir_) / entry_name(d, p)).string();
+}
+
+std::string WaveformCache::ensure(const std::string& in_path, const TxParams& p, bool* hit) {
+    uint8_t d[32];
+    if (!sha256_file(in_path, d)) throw std::runtime_error("cannot read input: " + in_path);
+    const fs::path dst = fs::path(dir_) / entry_name(d, p);
+
+    std::error_code ec;
+    if (fs::is_regular_file(dst, ec)) {
+        // Bozuk/yarım girdi (eski sürüm, elle kopyalama) sessizce yeniden üretilir
+        bool ok = false;
+        try { MappedWaveform m(dst.string()); ok = std::memcmp(m.header().sha256, d, 16) == 0; }
+        catch (...) {}
+        if (ok) {
+            fs::last_write_time(dst, fs::file_time_type::clock::now(), ec);   // LRU
+            if (hit) *hit = true;
+            return dst.string();
+        }
+    }
+
+    Modulator mod(p);
+    CacheHeader h;
+    h.bps            = static_cast<uint8_t>(bits_per_symbol(p.mod));
+    h.cp_len         = static_cast<uint8_t>(p.cp_len > 0 ? p.cp_len : kDefaultCp);
+    h.packet_len     = static_cast<uint32_t>(p.packet_len);
+    h.amp            = p.amp;
+    h.packet_samples = static_cast<uint32_t>(mod.packet_samples());
+    std::memcpy(h.sha256, d, 16);
+
+    char sfx[48];
+    std::snprintf(sfx, sizeof(sfx), ".tmp%d.%u", static_cast<int>(getpid_()), g_tmp_seq++);
+    const fs::path tmp = dst.string() + sfx;
+    {
+        std::ifstream fin(in_path, std::ios::binary);
+        std::ofstream fout(tmp, std::ios::binary);
+        if (!fin || !fout) throw std::runtime_error("cannot open cache temp file");
+        fout.write(reinterpret_cast<const char*>(&h), sizeof(h));
+
+        // Son eksik paket ofdm_tx_file gibi atlanır
+        std::vector<uint8_t> pkt(static_cast<size_t>(p.packet_len));
+        std::vector<cf32>    iq(h.packet_samples);
+        std::vector<int16_t> cs(2 * size_t(h.packet_samples));
+        while (fin.read(reinterpret_cast<char*>(pkt.data()), p.packet_len)) {
+            mod.modulate(pkt.data(), iq.data());
+            to_cs16(iq.data(), cs.data(), iq.size());
+            fout.write(reinterpret_cast<const char*>(cs.data()),
+                       static_cast<std::streamsize>(cs.size() * sizeof(int16_t)));
+            ++h.packets;
+        }
+        h.samples = h.packets * h.packet_samples;
+        fout.seekp(0);
+        fout.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        fout.flush();
+        if (!fout) { fout.close(); fs::remove(tmp, ec); throw std::runtime_error("cache write failed"); }
+    }
+    // Aynı anahtarı eşzamanlı render eden başka süreç varsa içerik aynıdır; son rename kazanır
+    fs::rename(tmp, dst, ec);
+    if (ec) { fs::remove(tmp, ec); if (!fs::is_regular_file(dst)) throw std::runtime_error("cache rename failed"); }
+    if (hit) *hit = false;
+    return dst.string();
+}
+
+int WaveformCache::prune(uint64_t max_bytes) {
+    struct Ent { fs::path p; fs::file_time_type t; uint64_t sz; };
+    std::vector<Ent> es;
+    uint64_t total = 0;
+    std::error_code ec;
+    for (const auto& de : fs::directory_iterator(dir_, ec)) {
+        if (!de.is_regular_file(ec) || de.path().extension() != ".cs16") continue;
+        const uint64_t sz = de.file_size(ec);
+        es.push_back({ de.path(), de.last_write_time(ec), sz });
+        total += sz;
+    }
+    std::sort(es.begin(), es.end(), [](const Ent& a, const Ent& b) { return a.t < b.t; });
+    int removed = 0;
+    for (const auto& e : es) {
+        if (total <= max_bytes) break;
+        // Eşlenmiş (Windows'ta açık) dosya silinemezse atlanır
+        if (fs::remove(e.p, ec)) { total -= e.sz; ++removed; }
+    }
+    return removed;
+}
+
+// ------------------------------------------------------------ MappedWaveform
+
+void MappedWaveform::open(const std::string& path) {
+    close();
+#if defined(_WIN32)
+    HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                           nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE) throw std::runtime_error("cannot open cache file: " + path);
+    LARGE_INTEGER li;
+    if (!GetFileSizeEx(f, &li) || li.QuadPart < static_cast<LONGLONG>(sizeof(CacheHeader))) {
+        CloseHandle(f);
+        throw std::runtime_error("cache file too small: " + path);
+    }
+    HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void*  v = m ? MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!v) {
+        if (m) CloseHandle(m);
+        CloseHandle(f);
+        throw std::runtime_error("cannot map cache file: " + path);
+    }
+    file_ = f;
+    map_  = m;
+    size_ = static_cast<uint64_t>(li.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("cannot open cache file: " + path);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(CacheHeader))) {
+        ::close(fd);
+        throw std::runtime_error("cache file too small: " + path);
+    }
+    void* v = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (v == MAP_FAILED) throw std::runtime_error("cannot map cache file: " + path);
+    madvise(v, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    size_ = static_cast<uint64_t>(st.st_size);
+#endif
+    base_ = static_cast<const uint8_t*>(v);
+    std::memcpy(&hdr_, base_, sizeof(hdr_));
+    const uint64_t need = hdr_.header_bytes + hdr_.samples * 4;
+    if (hdr_.magic != kCacheMagic || hdr_.version != kCacheVersion ||
+        hdr_.header_bytes < sizeof(CacheHeader) || need != size_ ||
+        hdr_.samples != hdr_.packets * hdr_.packet_samples) {
+        close();
+        throw std::runtime_error("invalid cache file: " + path);
+    }
+    iq_ = reinterpret_cast<const int16_t*>(base_ + hdr_.header_bytes);
+}
+
+void MappedWaveform::close() {
+    if (!base_) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(map_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    file_ = map_ = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(base_), static_cast<size_t>(size_));
+#endif
+    base_ = nullptr;
+    iq_   = nullptr;
+    size_ = 0;
+    hdr_  = CacheHeader{};
+}
+
+} // namespace ofdm
+
+// ------------------------------------------------------------ DLL arayüzü
+
+OFDM_API int ofdm_cache_get(const char* cache_dir, const char* in_path,
+                            int bits_per_symbol, int packet_len, int cp_len, float amp,
+                            char* out_path, int out_cap)
+{
+    if (!cache_dir || !in_path || !out_path || out_cap <= 0) return -4;
+    ofdm::TxParams p;
+    switch (bits_per_symbol) {
+        case 1: p.mod = ofdm::Modulation::BPSK;  break;
+        case 2: p.mod = ofdm::Modulation::QPSK;  break;
+        case 4: p.mod = ofdm::Modulation::QAM16; break;
+        default: return -4;
+    }
+    if (packet_len <= 0 || cp_len < 0 || cp_len > 255) return -4;
+    p.packet_len = packet_len;
+    p.cp_len     = cp_len;
+    p.amp        = amp;
+
+    std::error_code ec;
+    if (!fs::is_regular_file(in_path, ec)) return -1;
+    try {
+        ofdm::WaveformCache c(cache_dir);
+        bool hit = false;
+        std::string path;
+        try { path = c.ensure(in_path, p, &hit); }
+        catch (...) { return -3; }
+        if (path.size() + 1 > static_cast<size_t>(out_cap)) return -5;
+        std::memcpy(out_path, path.c_str(), path.size() + 1);
+        return hit ? 1 : 0;
+    } catch (...) {
+        return -2;
+    }
+}
+
+OFDM_API int ofdm_cache_prune(const char* cache_dir, std::uint64_t max_bytes) {
+    if (!cache_dir) return -4;
+    try {
+        ofdm::WaveformCache c(cache_dir);
+        return c.prune(max_bytes);
+    } catch (...) {
+        return -2;
+    }
+}
@@ -0,0 +1,267 @@
+#include "Include/ofdm_eq.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Veri geçişi: GCC vektör uzantıları + target özniteliği (ofdm_fft.cpp ile aynı düzen).
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define OFDM_EQ_X86 1
+  #define OFDM_INLINE inline __attribute__((always_inline))
+#else
+  #define OFDM_EQ_X86 0
+  #define OFDM_INLINE inline
+#endif
+
+namespace ofdm {
+
+static inline cf32 cmul(cf32 a, cf32 b) {
+    return cf32(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+static inline cf32 cmulc(cf32 a, cf32 b) {   // a * conj(b)
+    return cf32(a.real() * b.real() + a.imag() * b.imag(), a.imag() * b.real() - a.real() * b.imag());
+}
+static inline cf32 cdiv(cf32 a, cf32 b) {
+    const float n = b.real() * b.real() + b.imag() * b.imag();
+    if (n < 1e-30f) return cf32(0.f, 0.f);
+    return cmulc(a, b) / n;
+}
+
+#if OFDM_EQ_X86
+typedef float v8f  __attribute__((vector_size(32)));
+typedef float v16f __attribute__((vector_size(64)));
+#endif
+
+// T: şerit vektörü (float, v8f, v16f); 48 taşıyıcı 48/W adımda
+template <class T>
+static OFDM_INLINE void eq_data(const PacketEqualizer::Job& j, const PacketEqualizer::Slicer& sl) {
+    constexpr int W = static_cast<int>(sizeof(T) / sizeof(float));
+    static_assert(kNumOccupied % W == 0, "lane width must divide the carrier count");
+    const T z{};
+    const T a = z + (1.f - sl.alpha), b = z + sl.alpha;
+    const T tr0 = z + sl.thr_r[0], tr1 = z + sl.thr_r[1], tr2 = z + sl.thr_r[2];
+    const T ti0 = z + sl.thr_i[0], ti1 = z + sl.thr_i[1], ti2 = z + sl.thr_i[2];
+    const T tiny = z + 1e-30f, one = z + 1.f;
+    // a > b -> 1.0 / 0.0 (şerit başına; vektör ?: GCC uzantısı, skalerde olağan ?:)
+    #define GT01(x, y) ((x) > (y) ? one : z)
+    const bool soft = j.er != nullptr;
+
+    for (int s = 0; s < j.n_syms; ++s) {
+        const float cr = j.rot[2 * s], ci = j.rot[2 * s + 1];
+        const size_t o = static_cast<size_t>(s) * kNumOccupied;
+        for (int c = 0; c < kNumOccupied; c += W) {
+            T hr, hi, yr, yi;
+            std::memcpy(&hr, j.hr + c, sizeof(T));
+            std::memcpy(&hi, j.hi + c, sizeof(T));
+            std::memcpy(&yr, j.yr + o + c, sizeof(T));
+            std::memcpy(&yi, j.yi + o + c, sizeof(T));
+
+            // CPE döndürmesi, sonra y/H (|H|^2 < 1e-30 -> 0, cdiv ile aynı)
+            const T h_r = hr * cr - hi * ci;
+            const T h_i = hr * ci + hi * cr;
+            const T n   = h_r * h_r + h_i * h_i;
+            const T ok  = 1.f - GT01(tiny, n);
+            const T nn  = n + (1.f - ok);
+            const T er  = (yr * h_r + yi * h_i) / nn * ok;
+            const T ei  = (yi * h_r - yr * h_i) / nn * ok;
+
+            // Eksen başına seviye indeksi (kare kümelerde en yakın nokta)
+            const T lr = GT01(er, tr0) + GT01(er, tr1) + GT01(er, tr2);
+            const T li = GT01(ei, ti0) + GT01(ei, ti1) + GT01(ei, ti2);
+            const T pr = sl.lev_r + lr * sl.step_r;
+            const T pi = sl.lev_i + li * sl.step_i;
+            const T code = li * 4.f + lr;
+            std::memcpy(j.code + o + c, &code, sizeof(T));
+
+            if (soft) {
+                const T dr = yr - (h_r * pr - h_i * pi);
+                const T di = yi - (h_r * pi + h_i * pr);
+                const T e2 = dr * dr + di * di;
+                std::memcpy(j.er + o + c,   &er, sizeof(T));
+                std::memcpy(j.ei + o + c,   &ei, sizeof(T));
+                std::memcpy(j.gain + o + c, &n,  sizeof(T));
+                std::memcpy(j.err + o + c,  &e2, sizeof(T));
+            }
+
+            // Karar yönlü güncelleme: H = (1-alpha) H + alpha y/karar
+            const T pn = pr * pr + pi * pi;
+            const T qr = (yr * pr + yi * pi) / pn;
+            const T qi = (yi * pr - yr * pi) / pn;
+            const T nr = a * h_r + b * qr;
+            const T ni = a * h_i + b * qi;
+            std::memcpy(j.hr + c, &nr, sizeof(T));
+            std::memcpy(j.hi + c, &ni, sizeof(T));
+        }
+    }
+    #undef GT01
+}
+
+static void eq_scalar(const PacketEqualizer::Job& j, const PacketEqualizer::Slicer& sl) { eq_data<float>(j, sl); }
+#if OFDM_EQ_X86
+__attribute__((target("avx2,fma")))
+static void eq_avx2(const PacketEqualizer::Job& j, const PacketEqualizer::Slicer& sl) { eq_data<v8f>(j, sl); }
+__attribute__((target("avx512f")))
+static void eq_avx512(const PacketEqualizer::Job& j, const PacketEqualizer::Slicer& sl) { eq_data<v16f>(j, sl); }
+#endif
+
+PacketEqualizer::PacketEqualizer(float alpha, Isa isa) : alpha_(alpha) {
+    if (isa == Isa::Auto) isa = Isa::Avx512;
+    if (isa == Isa::Avx512 && !BatchFft::supported(Isa::Avx512)) isa = Isa::Avx2;
+    if (isa == Isa::Avx2   && !BatchFft::supported(Isa::Avx2))   isa = Isa::Scalar;
+    isa_  = isa;
+    kern_ = eq_scalar;
+#if OFDM_EQ_X86
+    if (isa_ == Isa::Avx2)   kern_ = eq_avx2;
+    if (isa_ == Isa::Avx512) kern_ = eq_avx512;
+#endif
+    // shift'li k -> doğal satır (k + N/2) % N
+    for (int k = 0; k < kNumOccupied; ++k) row_[k]  = (kOccupiedIdx[k] + kFftLen / 2) % kFftLen;
+    for (int k = 0; k < kNumPilots; ++k)   prow_[k] = (kPilotIdx[k] + kFftLen / 2) % kFftLen;
+    std::fill(hr_, hr_ + kNumOccupied, 0.f);
+    std::fill(hi_, hi_ + kNumOccupied, 0.f);
+    std::fill(hp_, hp_ + kNumPilots, cf32(0.f, 0.f));
+    reserve(1);
+}
+
+void PacketEqualizer::reserve(int max_syms) {
+    if (max_syms <= max_syms_) return;
+    max_syms_ = max_syms;
+    plane_    = static_cast<size_t>(max_syms) * kNumOccupied;
+    ws_.assign(7 * plane_, 0.f);
+    rot_.assign(2 * static_cast<size_t>(max_syms), 0.f);
+    py_.assign(static_cast<size_t>(max_syms) * kNumPilots, cf32(0.f, 0.f));
+}
+
+// Dilimleyici: eksen seviyeleri kümeden çıkarılır (BPSK: Q ekseni tek seviye 0),
+// eşikler ardışık seviyelerin ortası; lut nokta indeksine geri çevirir.
+void PacketEqualizer::set_mod(Modulation m) {
+    if (sl_ok_ && sl_mod_ == m) return;
+    const cf32* pts = constellation(m);
+    const int   np  = 1 << bits_per_symbol(m);
+    auto axis = [&](bool imag, float* thr, float& lev, float& step) {
+        float v[16];
+        int   nv = 0;
+        for (int k = 0; k < np; ++k) {
+            const float x = imag ? pts[k].imag() : pts[k].real();
+            bool seen = false;
+            for (int t = 0; t < nv; ++t) seen |= std::fabs(v[t] - x) < 1e-6f;
+            if (!seen) v[nv++] = x;
+        }
+        std::sort(v, v + nv);
+        for (int t = 0; t < 3; ++t)
+            thr[t] = (t + 1 < nv) ? 0.5f * (v[t] + v[t + 1]) : std::numeric_limits<float>::infinity();
+        lev  = v[0];
+        step = (nv > 1) ? (v[nv - 1] - v[0]) / static_cast<float>(nv - 1) : 0.f;
+    };
+    axis(false, sl_.thr_r, sl_.lev_r, sl_.step_r);
+    axis(true,  sl_.thr_i, sl_.lev_i, sl_.step_i);
+    std::memset(sl_.lut, 0, sizeof(sl_.lut));
+    for (int k = 0; k < np; ++k) {
+        const int lr = sl_.step_r > 0.f ? static_cast<int>(std::lround((pts[k].real() - sl_.lev_r) / sl_.step_r)) : 0;
+        const int li = sl_.step_i > 0.f ? static_cast<int>(std::lround((pts[k].imag() - sl_.lev_i) / sl_.step_i)) : 0;
+        sl_.lut[li * 4 + lr] = static_cast<uint8_t>(k);
+    }
+    sl_.alpha = alpha_;
+    sl_mod_   = m;
+    sl_ok_    = true;
+}
+
+void PacketEqualizer::init(const cf32* sync2_fft) {
+    for (int k = 0; k < kNumOccupied; ++k) {
+        const int   i = kOccupiedIdx[k];
+        const float s = kSyncWord2[i].real();
+        const cf32  h = (s != 0.f) ? sync2_fft[i] / s : cf32(0.f, 0.f);
+        hr_[k] = h.real();
+        hi_[k] = h.imag();
+    }
+    for (int k = 0; k < kNumPilots; ++k) {
+        const int   i = kPilotIdx[k];
+        const float s = kSyncWord2[i].real();
+        hp_[k] = (s != 0.f) ? sync2_fft[i] / s : cf32(0.f, 0.f);
+    }
+}
+
+void PacketEqualizer::channel(cf32* h64) const {
+    std::fill(h64, h64 + kFftLen, cf32(0.f, 0.f));
+    for (int k = 0; k < kNumOccupied; ++k) h64[kOccupiedIdx[k]] = cf32(hr_[k], hi_[k]);
+    for (int k = 0; k < kNumPilots; ++k)   h64[kPilotIdx[k]]    = hp_[k];
+}
+
+void PacketEqualizer::equalize(const cf32* y64, int n_data, Modulation m, uint8_t* idx, cf32* eq, float* gain) {
+    float* yr = ws_.data();
+    float* yi = yr + plane_;
+    for (int k = 0; k < kNumOccupied; ++k) {
+        yr[k] = y64[kOccupiedIdx[k]].real();
+        yi[k] = y64[kOccupiedIdx[k]].imag();
+    }
+    for (int k = 0; k < kNumPilots; ++k) py_[static_cast<size_t>(k)] = y64[kPilotIdx[k]];
+    run(1, n_data, m, idx, eq, gain);
+}
+
+void PacketEqualizer::equalize_batch(const float* re, const float* im, int n_syms, int n_data, Modulation m,
+                                     uint8_t* idx, cf32* eq, float* gain) {
+    if (n_syms <= 0) return;
+    reserve(n_syms);
+    float* yr = ws_.data();
+    float* yi = yr + plane_;
+    for (int s = 0; s < n_syms; ++s) {
+        const size_t blk = static_cast<size_t>(s / kBatchLanes) * kFftLen * kBatchLanes + static_cast<size_t>(s % kBatchLanes);
+        const size_t o   = static_cast<size_t>(s) * kNumOccupied;
+        for (int k = 0; k < kNumOccupied; ++k) {
+            const size_t at = blk + static_cast<size_t>(row_[k]) * kBatchLanes;
+            yr[o + k] = re[at];
+            yi[o + k] = im[at];
+        }
+        for (int k = 0; k < kNumPilots; ++k) {
+            const size_t at = blk + static_cast<size_t>(prow_[k]) * kBatchLanes;
+            py_[static_cast<size_t>(s) * kNumPilots + k] = cf32(re[at], im[at]);
+        }
+    }
+    run(n_syms, n_data, m, idx, eq, gain);
+}
+
+void PacketEqualizer::run(int n_syms, int n_data, Modulation m, uint8_t* idx, cf32* eq, float* gain) {
+    set_mod(m);
+    const float a = 1.f - alpha_, b = alpha_;
+
+    // Pilot geçişi: CPE = sum y * conj(H * pilot), birim döndürme; sonra pilot güncellemesi
+    for (int s = 0; s < n_syms; ++s) {
+        const cf32* py = py_.data() + static_cast<size_t>(s) * kNumPilots;
+        cf32 cpe(0.f, 0.f);
+        for (int k = 0; k < kNumPilots; ++k) cpe += cmulc(py[k], hp_[k] * kPilotSym[k]);
+        const float mag = std::abs(cpe);
+        const cf32  rot = (mag > 0.f) ? cpe / mag : cf32(1.f, 0.f);
+        if (mag > 0.f)
+            for (int k = 0; k < kNumPilots; ++k) hp_[k] = cmul(hp_[k], rot);
+        for (int k = 0; k < kNumPilots; ++k) hp_[k] = a * hp_[k] + b * cdiv(py[k], kPilotSym[k]);
+        rot_[2 * static_cast<size_t>(s)]     = rot.real();
+        rot_[2 * static_cast<size_t>(s) + 1] = rot.imag();
+    }
+
+    // Veri geçişi
+    float* base = ws_.data();
+    Job j;
+    j.hr = hr_; j.hi = hi_;
+    j.yr = base; j.yi = base + plane_;
+    j.rot = rot_.data();
+    j.n_syms = n_syms;
+    j.code = base + 2 * plane_;
+    j.er   = eq ? base + 3 * plane_ : nullptr;
+    j.ei   = base + 4 * plane_;
+    j.gain = base + 5 * plane_;
+    j.err  = base + 6 * plane_;
+    kern_(j, sl_);
+
+    for (int k = 0; k < n_data; ++k) idx[k] = sl_.lut[static_cast<int>(j.code[k])];
+    if (eq) {
+        for (int k = 0; k < n_data; ++k) {
+            eq[k]   = cf32(j.er[k], j.ei[k]);
+            gain[k] = j.gain[k];
+            nv_acc_ += j.err[k];
+        }
+        nv_n_ += static_cast<uint64_t>(n_data);
+    }
+}
+
+} // namespace ofdm
@@ -0,0 +1,274 @@
+#include "Include/ofdm_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+// Toplu çekirdek: GCC vektör uzantıları + target özniteliği ile çalışma anı seçimi.
+// Diğer derleyicilerde yalnız skaler çekirdek derlenir.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define OFDM_FFT_X86 1
+  #define OFDM_INLINE inline __attribute__((always_inline))
+#else
+  #define OFDM_FFT_X86 0
+  #define OFDM_INLINE inline
+#endif
+
+namespace ofdm {
+
+static constexpr double kPi = 3.14159265358979323846;
+
+// std::complex çarpımı NaN/inf denetimi yapar (__mulsc3); burada gerek yok
+static inline cf32 cmul(cf32 a, cf32 b) {
+    return cf32(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+
+Fft::Fft(int n) : n_(n) {
+    if (n < 2 || n > 1024 || (n & (n - 1)) != 0) throw std::invalid_argument("fft size must be a power of two <= 1024");
+    while ((1 << log2n_) < n) ++log2n_;
+    // Dönüş çarpanları double'da hesaplanıp float'a yuvarlanır
+    for (int k = 0; k < n / 2; ++k) {
+        const double a = -2.0 * kPi * k / n;
+        tw_[k] = cf32(static_cast<float>(std::cos(a)), static_cast<float>(std::sin(a)));
+    }
+    for (int i = 0; i < n; ++i) {
+        int r = 0;
+        for (int b = 0; b < log2n_; ++b) r |= ((i >> b) & 1) << (log2n_ - 1 - b);
+        rev_[i] = r;
+    }
+}
+
+void Fft::transform(cf32* x, bool inverse) const {
+    for (int i = 0; i < n_; ++i) {
+        const int r = rev_[i];
+        if (r > i) std::swap(x[i], x[r]);
+    }
+    // Radix-2 DIT kelebekleri
+    for (int len = 2; len <= n_; len <<= 1) {
+        const int half = len >> 1;
+        const int step = n_ / len;
+        for (int i = 0; i < n_; i += len) {
+            for (int j = 0; j < half; ++j) {
+                cf32 w = tw_[j * step];
+                if (inverse) w = std::conj(w);
+                const cf32 u = x[i + j];
+                const cf32 v = cmul(x[i + j + half], w);
+                x[i + j]        = u + v;
+                x[i + j + half] = u - v;
+            }
+        }
+    }
+}
+
+void Fft::inverse_shifted(const cf32* in, cf32* out) const {
+    const int h = n_ / 2;
+    for (int i = 0; i < h; ++i) { out[i + h] = in[i]; out[i] = in[i + h]; }
+    transform(out, true);
+}
+
+void Fft::forward_shifted(const cf32* in, cf32* out) const {
+    const int h = n_ / 2;
+    for (int i = 0; i < n_; ++i) out[i] = in[i];
+    transform(out, false);
+    for (int i = 0; i < h; ++i) std::swap(out[i], out[i + h]);
+}
+
+// ---------------------------------------------------------------- BatchFft
+
+#if OFDM_FFT_X86
+typedef float v8f  __attribute__((vector_size(32)));
+typedef float v16f __attribute__((vector_size(64)));
+#endif
+
+// Tek bir blok satırı kelebeği: a' = a + b*w, b' = a - b*w (kBatchLanes şerit)
+#define OFDM_BFLY_LOAD(T)                                                          \
+    T a_r, a_i, b_r, b_i;                                                          \
+    std::memcpy(&a_r, ar + r * W, sizeof(T)); std::memcpy(&a_i, ai + r * W, sizeof(T)); \
+    std::memcpy(&b_r, br + r * W, sizeof(T)); std::memcpy(&b_i, bi + r * W, sizeof(T))
+#define OFDM_BFLY_STORE(T, TR, TI)                                                 \
+    const T o0r = a_r + (TR), o0i = a_i + (TI), o1r = a_r - (TR), o1i = a_i - (TI); \
+    std::memcpy(ar + r * W, &o0r, sizeof(T)); std::memcpy(ai + r * W, &o0i, sizeof(T)); \
+    std::memcpy(br + r * W, &o1r, sizeof(T)); std::memcpy(bi + r * W, &o1i, sizeof(T))
+
+// T: şerit vektörü (float, v8f, v16f). Giriş satırları bit-ters sırada olmalı.
+template <class T>
+static OFDM_INLINE void batch_butterflies(float* re, float* im, int n, const float* twr, const float* twi,
+                                          float sgn, size_t blocks) {
+    constexpr int W = static_cast<int>(sizeof(T) / sizeof(float));
+    constexpr int R = kBatchLanes / W;
+    const size_t bs = static_cast<size_t>(n) * kBatchLanes;
+    for (size_t b = 0; b < blocks; ++b) {
+        float* xr = re + b * bs;
+        float* xi = im + b * bs;
+        // len=2: w = 1
+        for (int i = 0; i < n; i += 2) {
+            float* ar = xr + i * kBatchLanes; float* br = ar + kBatchLanes;
+            float* ai = xi + i * kBatchLanes; float* bi = ai + kBatchLanes;
+            for (int r = 0; r < R; ++r) { OFDM_BFLY_LOAD(T); OFDM_BFLY_STORE(T, b_r, b_i); }
+        }
+        // len=4: w = 1, -j (ters yönde +j)
+        if (n >= 4) {
+            for (int i = 0; i < n; i += 4) {
+                for (int j = 0; j < 2; ++j) {
+                    float* ar = xr + (i + j) * kBatchLanes; float* br = ar + 2 * kBatchLanes;
+                    float* ai = xi + (i + j) * kBatchLanes; float* bi = ai + 2 * kBatchLanes;
+                    if (j == 0) {
+                        for (int r = 0; r < R; ++r) { OFDM_BFLY_LOAD(T); OFDM_BFLY_STORE(T, b_r, b_i); }
+                    } else {
+                        for (int r = 0; r < R; ++r) { OFDM_BFLY_LOAD(T); OFDM_BFLY_STORE(T, b_i * sgn, b_r * -sgn); }
+                    }
+                }
+            }
+        }
+        for (int len = 8; len <= n; len <<= 1) {
+            const int half = len >> 1;
+            const int step = n / len;
+            for (int i = 0; i < n; i += len) {
+                for (int j = 0; j < half; ++j) {
+                    const float wr = twr[j * step], wi = twi[j * step] * sgn;
+                    float* ar = xr + (i + j) * kBatchLanes; float* br = ar + half * kBatchLanes;
+                    float* ai = xi + (i + j) * kBatchLanes; float* bi = ai + half * kBatchLanes;
+                    for (int r = 0; r < R; ++r) {
+                        OFDM_BFLY_LOAD(T);
+                        const T tr = b_r * wr - b_i * wi;
+                        const T ti = b_r * wi + b_i * wr;
+                        OFDM_BFLY_STORE(T, tr, ti);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#undef OFDM_BFLY_LOAD
+#undef OFDM_BFLY_STORE
+
+static void batch_scalar(float* re, float* im, int n, const float* twr, const float* twi, float sgn, size_t blocks) {
+    batch_butterflies<float>(re, im, n, twr, twi, sgn, blocks);
+}
+#if OFDM_FFT_X86
+__attribute__((target("avx2,fma")))
+static void batch_avx2(float* re, float* im, int n, const float* twr, const float* twi, float sgn, size_t blocks) {
+    batch_butterflies<v8f>(re, im, n, twr, twi, sgn, blocks);
+}
+__attribute__((target("avx512f")))
+static void batch_avx512(float* re, float* im, int n, const float* twr, const float* twi, float sgn, size_t blocks) {
+    batch_butterflies<v16f>(re, im, n, twr, twi, sgn, blocks);
+}
+#endif
+
+bool BatchFft::supported(Isa isa) {
+    switch (isa) {
+        case Isa::Auto:
+        case Isa::Scalar: return true;
+#if OFDM_FFT_X86
+        case Isa::Avx2:   __builtin_cpu_init(); return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case Isa::Avx512: __builtin_cpu_init(); return __builtin_cpu_supports("avx512f");
+#else
+        default: return false;
+#endif
+    }
+    return false;
+}
+
+const char* BatchFft::isa_name(Isa isa) {
+    switch (isa) {
+        case Isa::Auto:   return "auto";
+        case Isa::Scalar: return "scalar";
+        case Isa::Avx2:   return "avx2";
+        case Isa::Avx512: return "avx512";
+    }
+    return "?";
+}
+
+BatchFft::BatchFft(int n, Isa isa) : n_(n) {
+    if (n < 2 || n > 1024 || (n & (n - 1)) != 0) throw std::invalid_argument("fft size must be a power of two <= 1024");
+    int log2n = 0;
+    while ((1 << log2n) < n) ++log2n;
+    for (int k = 0; k < n / 2; ++k) {
+        const double a = -2.0 * kPi * k / n;
+        twr_[k] = static_cast<float>(std::cos(a));
+        twi_[k] = static_cast<float>(std::sin(a));
+    }
+    for (int i = 0; i < n; ++i) {
+        int r = 0;
+        for (int b = 0; b < log2n; ++b) r |= ((i >> b) & 1) << (log2n - 1 - b);
+        rev_[i] = r;
+    }
+    for (int i = 0; i < n; ++i) srow_[i] = rev_[(i + n / 2) % n];
+
+    // Auto: en geniş desteklenen; istenen ISA yoksa bir alta düş
+    if (isa == Isa::Auto) isa = Isa::Avx512;
+    if (isa == Isa::Avx512 && !supported(Isa::Avx512)) isa = Isa::Avx2;
+    if (isa == Isa::Avx2   && !supported(Isa::Avx2))   isa = Isa::Scalar;
+    isa_  = isa;
+    kern_ = batch_scalar;
+#if OFDM_FFT_X86
+    if (isa_ == Isa::Avx2)   kern_ = batch_avx2;
+    if (isa_ == Isa::Avx512) kern_ = batch_avx512;
+#endif
+    blk_.assign(static_cast<size_t>(n + 1) * kBatchLanes * 2, 0.f);
+}
+
+void BatchFft::transform_permuted(float* re, float* im, size_t blocks, bool inverse) const {
+    kern_(re, im, n_, twr_, twi_, inverse ? -1.f : 1.f, blocks);
+}
+
+static void bitrev_rows(float* x, const int* rev, int n) {
+    float t[kBatchLanes];
+    for (int i = 0; i < n; ++i) {
+        const int j = rev[i];
+        if (j <= i) continue;
+        std::memcpy(t, x + i * kBatchLanes, sizeof t);
+        std::memcpy(x + i * kBatchLanes, x + j * kBatchLanes, sizeof t);
+        std::memcpy(x + j * kBatchLanes, t, sizeof t);
+    }
+}
+
+void BatchFft::forward(float* re, float* im, size_t blocks) const {
+    const size_t bs = static_cast<size_t>(n_) * kBatchLanes;
+    for (size_t b = 0; b < blocks; ++b) { bitrev_rows(re + b * bs, rev_, n_); bitrev_rows(im + b * bs, rev_, n_); }
+    transform_permuted(re, im, blocks, false);
+}
+
+void BatchFft::inverse(float* re, float* im, size_t blocks) const {
+    const size_t bs = static_cast<size_t>(n_) * kBatchLanes;
+    for (size_t b = 0; b < blocks; ++b) { bitrev_rows(re + b * bs, rev_, n_); bitrev_rows(im + b * bs, rev_, n_); }
+    transform_permuted(re, im, blocks, true);
+}
+
+// 16'lık gruplar halinde aktar -> kelebek -> geri aktar (eksik şeritler hesaplanıp atılır)
+void BatchFft::aos(const cf32* in, cf32* out, size_t count, bool inverse) {
+    const int n = n_, h = n_ / 2;
+    float* re = blk_.data();
+    float* im = blk_.data() + static_cast<size_t>(n + 1) * kBatchLanes;
+    for (size_t s0 = 0; s0 < count; s0 += kBatchLanes) {
+        const int cnt = static_cast<int>(std::min<size_t>(kBatchLanes, count - s0));
+        // Satır satır: her satırın 16 şeridi ardışık yazılır, semboller L1'de kalır
+        const cf32* x = in + s0 * static_cast<size_t>(n);
+        for (int i = 0; i < n; ++i) {
+            float* rr = re + input_row(i, inverse) * kBatchLanes;
+            float* ri = im + input_row(i, inverse) * kBatchLanes;
+            for (int s = 0; s < cnt; ++s) {
+                const cf32 v = x[static_cast<size_t>(s) * n + i];
+                rr[s] = v.real();
+                ri[s] = v.imag();
+            }
+        }
+        transform_permuted(re, im, 1, inverse);
+        cf32* y = out + s0 * static_cast<size_t>(n);
+        for (int k = 0; k < n; ++k) {
+            const int row = inverse ? k : (k + h) % n;
+            const float* rr = re + row * kBatchLanes;
+            const float* ri = im + row * kBatchLanes;
+            for (int s = 0; s < cnt; ++s) y[static_cast<size_t>(s) * n + k] = cf32(rr[s], ri[s]);
+        }
+    }
+}
+
+void BatchFft::forward_shifted(const cf32* in, cf32* out, size_t count) { aos(in, out, count, false); }
+void BatchFft::inverse_shifted(const cf32* in, cf32* out, size_t count) { aos(in, out, count, true); }
+
+} // namespace ofdm
@@ -0,0 +1,97 @@
+#include "Include/ofdm_frame.hpp"
+#include "../Checksum/Include/checksum.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace ofdm {
+
+// -26..-22, -20..-8, -6..-1, 1..6, 8..20, 22..26 -> (c mod 64 + 32) mod 64
+static constexpr int shifted(int c) { return ((c < 0 ? c + kFftLen : c) + kFftLen / 2) % kFftLen; }
+
+const int kOccupiedIdx[kNumOccupied] = {
+    shifted(-26), shifted(-25), shifted(-24), shifted(-23), shifted(-22),
+    shifted(-20), shifted(-19), shifted(-18), shifted(-17), shifted(-16), shifted(-15), shifted(-14),
+    shifted(-13), shifted(-12), shifted(-11), shifted(-10), shifted(-9),  shifted(-8),
+    shifted(-6),  shifted(-5),  shifted(-4),  shifted(-3),  shifted(-2),  shifted(-1),
+    shifted(1),   shifted(2),   shifted(3),   shifted(4),   shifted(5),   shifted(6),
+    shifted(8),   shifted(9),   shifted(10),  shifted(11),  shifted(12),  shifted(13),  shifted(14),
+    shifted(15),  shifted(16),  shifted(17),  shifted(18),  shifted(19),  shifted(20),
+    shifted(22),  shifted(23),  shifted(24),  shifted(25),  shifted(26)
+};
+
+const int  kPilotIdx[kNumPilots] = { shifted(-21), shifted(-7), shifted(7), shifted(21) };
+const cf32 kPilotSym[kNumPilots] = { {1.f, 0.f}, {1.f, 0.f}, {1.f, 0.f}, {-1.f, 0.f} };
+
+// Senk kelimeleri betiklerdeki listelerin aynısı (zaten shift'li düzende)
+#define S2 1.41421356f
+const cf32 kSyncWord1[kFftLen] = {
+    0.f,0.f,0.f,0.f,0.f,0.f,0.f, S2,0.f,-S2,0.f, S2,0.f,-S2,0.f,-S2,0.f,-S2,0.f, S2,0.f,-S2,0.f, S2,0.f,-S2,
+    0.f,-S2,0.f,-S2,0.f,-S2,0.f, S2,0.f,-S2,0.f, S2,0.f, S2,0.f, S2,0.f,-S2,0.f, S2,0.f, S2,0.f, S2,0.f,-S2,
+    0.f, S2,0.f, S2,0.f, S2,0.f,0.f,0.f,0.f,0.f,0.f
+};
+#undef S2
+const cf32 kSyncWord2[kFftLen] = {
+    0,0,0,0,0,0,-1,-1,-1,-1,1,1,-1,-1,-1,1,-1,1,1,1,1,1,-1,-1,-1,-1,-1,1,-1,-1,1,-1,
+    0,1,-1,1,1,1,-1,1,1,1,-1,1,1,1,1,-1,1,-1,-1,-1,1,-1,1,-1,-1,-1,-1,0,0,0,0,0
+};
+
+// constellation.cc: SQRT_TWO = 0.707107 (tam 1/sqrt(2) değil; bit eşliği için aynen)
+static const cf32 kBpsk[2]  = { {-1.f, 0.f}, {1.f, 0.f} };
+static const cf32 kQpsk[4]  = { {-0.707107f, -0.707107f}, {0.707107f, -0.707107f},
+                                {-0.707107f,  0.707107f}, {0.707107f,  0.707107f} };
+// constellation_16qam: küme bölmeli eşleme, seviye sqrt(0.1)
+static const float kQamLevel = std::sqrt(0.1f);
+static const cf32 kQam16[16] = {
+    { 1*kQamLevel, -1*kQamLevel}, {-1*kQamLevel, -1*kQamLevel}, { 3*kQamLevel, -3*kQamLevel}, {-3*kQamLevel, -3*kQamLevel},
+    {-3*kQamLevel,  3*kQamLevel}, { 3*kQamLevel,  3*kQamLevel}, {-1*kQamLevel,  1*kQamLevel}, { 1*kQamLevel,  1*kQamLevel},
+    { 1*kQamLevel, -3*kQamLevel}, {-1*kQamLevel, -3*kQamLevel}, { 3*kQamLevel, -1*kQamLevel}, {-3*kQamLevel, -1*kQamLevel},
+    {-3*kQamLevel,  1*kQamLevel}, { 3*kQamLevel,  1*kQamLevel}, {-1*kQamLevel,  3*kQamLevel}, { 1*kQamLevel,  3*kQamLevel}
+};
+
+const cf32* constellation(Modulation m) {
+    switch (m) {
+        case Modulation::BPSK:  return kBpsk;
+        case Modulation::QPSK:  return kQpsk;
+        case Modulation::QAM16: return kQam16;
+    }
+    return kQpsk;
+}
+
+bool parse_modulation(const char* name, Modulation& out) {
+    if (!name) return false;
+    std::string s(name);
+    for (auto& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    if (s == "bpsk" || s == "b")   { out = Modulation::BPSK;  return true; }
+    if (s == "qpsk" || s == "q")   { out = Modulation::QPSK;  return true; }
+    if (s == "16qam" || s == "qam16") { out = Modulation::QAM16; return true; }
+    return false;
+}
+
+// ---------------------------------------------------------------- CRC
+// Ortak çekirdekler Checksum/checksum.c'de (konteyner ve yakalama araçlarıyla aynı)
+
+uint32_t crc32(const uint8_t* data, size_t n) { return ck_crc32(data, n); }
+
+uint32_t crc32_unpacked(const uint8_t* in, size_t n_items) { return ck_crc32_unpacked(in, n_items); }
+
+uint8_t header_crc8(uint16_t packet_len, uint16_t header_number) { return ck_header_crc8(packet_len, header_number); }
+
+void header_bits(uint32_t packet_len, uint16_t header_number, uint8_t out[kHeaderBits]) {
+    ck_header_bits(packet_len, header_number, out);
+}
+
+FrameDims frame_dims(int packet_len, Modulation m, int cp_len) {
+    FrameDims d;
+    const int bps = bits_per_symbol(m);
+    d.payload_items  = packet_len + kCrcLenUnpacked;
+    d.payload_syms   = (d.payload_items * 8 + bps - 1) / bps;
+    d.data_ofdm_syms = (d.payload_syms + kNumOccupied - 1) / kNumOccupied;
+    d.ofdm_syms      = kNumSyncWords + 1 + d.data_ofdm_syms;
+    d.samples        = (kFftLen + cp_len) * d.ofdm_syms;
+    return d;
+}
+
+} // namespace ofdm
@@ -0,0 +1,114 @@
+#include "Include/ofdm_llr.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace ofdm {
+
+// Gray kare 64QAM: eksen başına 3 bit Gray kodu -> seviye (-7..7)/sqrt(42)
+struct Qam64Table {
+    cf32 p[64];
+    Qam64Table() {
+        const float k = 1.f / std::sqrt(42.f);
+        auto level = [k](int g) {
+            int b = g ^ (g >> 1) ^ (g >> 2);          // Gray -> ikili (3 bit)
+            return static_cast<float>(2 * b - 7) * k;
+        };
+        for (int i = 0; i < 64; ++i) p[i] = cf32(level(i & 7), level(i >> 3));
+    }
+};
+static const Qam64Table kQam64;
+
+const cf32* qam64_points() { return kQam64.p; }
+
+// Genel max-log: B sabit, 16 sembollük gruplarda nokta döngüsü dışta; iç döngü
+// semboller üzerinde olduğundan derleyici vektörleştirir
+template <int B>
+static void demap_maxlog(const cf32* pts, const cf32* eq, const float* scale, int n, float* llr) {
+    constexpr int G = 16;
+    for (int i0 = 0; i0 < n; i0 += G) {
+        const int g = (n - i0 < G) ? n - i0 : G;
+        float xr[G] = {}, xi[G] = {};
+        float m[B][2][G];
+        for (int j = 0; j < g; ++j) { xr[j] = eq[i0 + j].real(); xi[j] = eq[i0 + j].imag(); }
+        for (int b = 0; b < B; ++b)
+            for (int j = 0; j < G; ++j) m[b][0][j] = m[b][1][j] = 1e30f;
+        for (int k = 0; k < (1 << B); ++k) {
+            const float pr = pts[k].real(), pi = pts[k].imag();
+            float d[G];
+            for (int j = 0; j < G; ++j) {
+                const float dr = xr[j] - pr, di = xi[j] - pi;
+                d[j] = dr * dr + di * di;
+            }
+            for (int b = 0; b < B; ++b) {
+                float* mb = m[b][(k >> b) & 1];
+                for (int j = 0; j < G; ++j) mb[j] = d[j] < mb[j] ? d[j] : mb[j];
+            }
+        }
+        for (int j = 0; j < g; ++j)
+            for (int b = 0; b < B; ++b)
+                llr[(i0 + j) * B + b] = (m[b][0][j] - m[b][1][j]) * scale[i0 + j];
+    }
+}
+
+LlrDemapper::LlrDemapper(int bits_per_symbol) : bps_(bits_per_symbol) {
+    switch (bps_) {
+        case 1: pts_ = constellation(Modulation::BPSK);  break;
+        case 2: pts_ = constellation(Modulation::QPSK);  break;
+        case 4: pts_ = constellation(Modulation::QAM16); break;
+        case kQam64Bits: pts_ = kQam64.p; break;
+        default: throw std::invalid_argument("unsupported bits_per_symbol");
+    }
+}
+
+void LlrDemapper::demap(const cf32* eq, const float* scale, int n, float* llr) const {
+    // BPSK/QPSK: eksenler ayrık, max-log kapalı form 4*a*x (a = nokta genliği)
+    if (bps_ == 1) {
+        for (int i = 0; i < n; ++i) llr[i] = 4.f * eq[i].real() * scale[i];
+        return;
+    }
+    if (bps_ == 2) {
+        const float a4 = 4.f * pts_[3].real();
+        for (int i = 0; i < n; ++i) {
+            llr[2 * i]     = a4 * eq[i].real() * scale[i];
+            llr[2 * i + 1] = a4 * eq[i].imag() * scale[i];
+        }
+        return;
+    }
+    // 16QAM (küme bölmeli, Gray değil) / 64QAM: tüm noktalar üzerinden en yakın 0/1
+    if (bps_ == 4) demap_maxlog<4>(pts_, eq, scale, n, llr);
+    else           demap_maxlog<kQam64Bits>(pts_, eq, scale, n, llr);
+}
+
+void LlrDemapper::demap(const cf32* eq, float noise_var, int n, float* llr) const {
+    const float s = 1.f / std::fmax(noise_var, 1e-12f);
+    float sc[64];
+    for (int k = 0; k < 64; ++k) sc[k] = s;
+    for (int i = 0; i < n; i += 64) {
+        const int m = (n - i < 64) ? n - i : 64;
+        demap(eq + i, sc, m, llr + static_cast<size_t>(i) * bps_);
+    }
+}
+
+uint8_t byte_reliability(const float* llr8) {
+    // log P = -sum log(1 + exp(-|L|)); |L| > 20 katkısı ihmal edilir
+    float lp = 0.f;
+    for (int k = 0; k < 8; ++k) {
+        const float a = std::fabs(llr8[k]);
+        if (a < 20.f) lp -= std::log1p(std::exp(-a));
+    }
+    return static_cast<uint8_t>(std::lround(255.f * std::exp(lp)));
+}
+
+} // namespace ofdm
+
+OFDM_API int ofdm_demap_llr(int bits_per_symbol, const float* iq, int n, float noise_var, float* llr) {
+    if (!iq || !llr || n < 0 || !(noise_var > 0.f)) return -1;
+    try {
+        const ofdm::LlrDemapper dm(bits_per_symbol);
+        dm.demap(reinterpret_cast<const ofdm::cf32*>(iq), noise_var, n, llr);
+        return n * bits_per_symbol;
+    } catch (...) {
+        return -4;
+    }
+}
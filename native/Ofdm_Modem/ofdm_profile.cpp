@@ -0,0 +1,456 @@
+#include "Include/ofdm_profile.hpp"
+#include "Include/ofdm_fft.hpp"
+#include "../Checksum/Include/checksum.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace ofdm {
+
+static inline cf32 cmul(cf32 a, cf32 b) {
+    return cf32(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+static inline cf32 cmulc(cf32 a, cf32 b) {   // a * conj(b)
+    return cf32(a.real() * b.real() + a.imag() * b.imag(), a.imag() * b.real() - a.real() * b.imag());
+}
+
+// ---------------------------------------------------------------- profiller
+
+using Factory = std::unique_ptr<ProfileModem> (*)(const Profile&, Modulation, int, float);
+
+namespace {
+
+struct ProfileData {
+    Profile           pf;
+    std::vector<int>  occ, pil;
+    std::vector<cf32> psym, s1, s2;
+    Factory           make = nullptr;
+};
+
+// 802.11 karıştırıcı polinomu, sabit tohum: tüm uçlarda aynı sync dizisi
+struct Lfsr {
+    uint32_t s = 0x7F;
+    int next() {
+        const int b = static_cast<int>(((s >> 6) ^ (s >> 3)) & 1u);
+        s = ((s << 1) | static_cast<uint32_t>(b)) & 0x7Fu;
+        return b;
+    }
+};
+
+int shifted(int n, int c) { return ((c < 0 ? c + n : c) + n / 2) % n; }
+
+// -half..half (DC hariç) kullanılır; pilotlar ±pil_pos, desen (1, 1, 1, -1) tekrar
+void wide_layout(ProfileData& d, int n, int half, std::initializer_list<int> pil_pos) {
+    std::vector<int> pc;
+    for (int p : pil_pos) { pc.push_back(-p); pc.push_back(p); }
+    std::sort(pc.begin(), pc.end());
+    for (size_t k = 0; k < pc.size(); ++k) {
+        d.pil.push_back(shifted(n, pc[k]));
+        d.psym.push_back(cf32((k % 4 == 3) ? -1.f : 1.f, 0.f));
+    }
+    for (int c = -half; c <= half; ++c)
+        if (c != 0 && std::find(pc.begin(), pc.end(), c) == pc.end()) d.occ.push_back(shifted(n, c));
+
+    // sync1: çift taşıyıcılar ±sqrt(2) (yarım sembol tekrarı, Schmidl-Cox), sync2: tümü ±1
+    const float s2 = std::sqrt(2.f);
+    Lfsr r;
+    d.s1.assign(static_cast<size_t>(n), cf32(0.f, 0.f));
+    d.s2.assign(static_cast<size_t>(n), cf32(0.f, 0.f));
+    for (int c = -half; c <= half; ++c) {
+        if (c == 0) continue;
+        if ((c & 1) == 0) d.s1[static_cast<size_t>(shifted(n, c))] = cf32(r.next() ? s2 : -s2, 0.f);
+        d.s2[static_cast<size_t>(shifted(n, c))] = cf32(r.next() ? 1.f : -1.f, 0.f);
+    }
+}
+
+void std_layout(ProfileData& d) {
+    d.occ.assign(kOccupiedIdx, kOccupiedIdx + kNumOccupied);
+    d.pil.assign(kPilotIdx, kPilotIdx + kNumPilots);
+    d.psym.assign(kPilotSym, kPilotSym + kNumPilots);
+    d.s1.assign(kSyncWord1, kSyncWord1 + kFftLen);
+    d.s2.assign(kSyncWord2, kSyncWord2 + kFftLen);
+}
+
+} // namespace
+
+template <int N, int CP, int NOCC, int NPIL>
+static std::unique_ptr<ProfileModem> make_kernel(const Profile& pf, Modulation m, int packet_len, float amp);
+
+namespace {
+
+constexpr int kNumProfiles = 5;
+
+struct Registry {
+    std::array<ProfileData, kNumProfiles> d;
+    Registry() {
+        std_layout(d[0]);
+        d[0].pf   = Profile{"std64", 64, 16, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+        d[0].make = make_kernel<64, 16, 48, 4>;
+        std_layout(d[1]);
+        d[1].pf   = Profile{"std64-cp8", 64, 8, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+        d[1].make = make_kernel<64, 8, 48, 4>;
+        wide_layout(d[2], 128, 52, {7, 21, 35, 49});
+        d[2].pf   = Profile{"wide128", 128, 16, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+        d[2].make = make_kernel<128, 16, 96, 8>;
+        wide_layout(d[3], 256, 100, {13, 39, 65, 91});
+        d[3].pf   = Profile{"wide256", 256, 32, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+        d[3].make = make_kernel<256, 32, 192, 8>;
+        wide_layout(d[4], 256, 100, {13, 39, 65, 91});
+        d[4].pf   = Profile{"wide256-cp64", 256, 64, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+        d[4].make = make_kernel<256, 64, 192, 8>;
+
+        // Dizi elemanları yer değiştirmez; işaretçiler bir kez bağlanır
+        for (auto& e : d) {
+            e.pf.n_occupied = static_cast<int>(e.occ.size());
+            e.pf.n_pilots   = static_cast<int>(e.pil.size());
+            e.pf.occupied   = e.occ.data();
+            e.pf.pilots     = e.pil.data();
+            e.pf.pilot_sym  = e.psym.data();
+            e.pf.sync1      = e.s1.data();
+            e.pf.sync2      = e.s2.data();
+        }
+    }
+};
+
+const Registry& registry() { static const Registry r; return r; }
+
+} // namespace
+
+int profile_count() { return kNumProfiles; }
+
+const Profile* profile_at(int i) {
+    if (i < 0 || i >= kNumProfiles) return nullptr;
+    return &registry().d[static_cast<size_t>(i)].pf;
+}
+
+const Profile* find_profile(const char* name) {
+    if (!name) return nullptr;
+    for (const auto& e : registry().d)
+        if (std::strcmp(e.pf.name, name) == 0) return &e.pf;
+    return nullptr;
+}
+
+FrameDims frame_dims(const Profile& pf, int packet_len, Modulation m) {
+    FrameDims d;
+    const int bps = bits_per_symbol(m);
+    d.payload_items  = packet_len + kCrcLenUnpacked;
+    d.payload_syms   = (d.payload_items * 8 + bps - 1) / bps;
+    d.data_ofdm_syms = (d.payload_syms + pf.n_occupied - 1) / pf.n_occupied;
+    d.ofdm_syms      = kNumSyncWords + 1 + d.data_ofdm_syms;
+    d.samples        = (pf.fft_len + pf.cp_len) * d.ofdm_syms;
+    return d;
+}
+
+double profile_bitrate(const Profile& pf, int packet_len, Modulation m, double samp_hz) {
+    const FrameDims d = frame_dims(pf, packet_len, m);
+    return d.samples > 0 ? 8.0 * packet_len * samp_hz / d.samples : 0.0;
+}
+
+std::unique_ptr<ProfileModem> make_profile_modem(const Profile& pf, Modulation m, int packet_len, float amp) {
+    if (packet_len <= 0 || packet_len + kCrcLenUnpacked > 0x0FFF) throw std::invalid_argument("packet_len out of range");
+    for (const auto& e : registry().d)
+        if (&e.pf == &pf) return e.make(pf, m, packet_len, amp);
+    throw std::invalid_argument("unknown profile (use profile_at/find_profile)");
+}
+
+// ---------------------------------------------------------------- çekirdek
+
+// N, CP, taşıyıcı/pilot sayısı ve sembol başına bit derleme anı sabiti: SoA adresleme,
+// bit açma/paketleme ve dilimleyici döngüleri açılır; yalnız harita satırları tablodan gelir.
+template <int N, int CP, int NOCC, int NPIL, int BPS>
+class ModemKernel final : public ProfileModem {
+    static_assert((N & (N - 1)) == 0 && N <= 1024, "fft size");
+    static_assert(NOCC >= kHeaderBits, "header must fit in one symbol");
+    static_assert(8 % BPS == 0, "bits per symbol must divide 8");
+
+    static constexpr int      kSym  = N + CP;
+    static constexpr int      kSpb  = 8 / BPS;          // bayt başına sembol
+    static constexpr uint32_t kMask = (1u << BPS) - 1u;
+    static constexpr int      kPts  = 1 << BPS;
+    static constexpr size_t   kBlk  = static_cast<size_t>(N) * kBatchLanes;
+
+public:
+    ModemKernel(const Profile& pf, Modulation m, int packet_len, float amp)
+        : ProfileModem(pf, m, packet_len), fft_(N), bfft_(N)
+    {
+        // Ortalama güç kullanılan taşıyıcı sayısıyla orantılı: std64 (52) seviyesine çek
+        scale_ = amp * std::sqrt(static_cast<float>(kNumOccupied + kNumPilots) / static_cast<float>(NOCC + NPIL));
+        std::memcpy(pts_, constellation(m), sizeof(pts_));
+        for (int k = 0; k < NOCC; ++k) {
+            occ_in_[k]  = bfft_.input_row(pf.occupied[k], true);
+            occ_out_[k] = (pf.occupied[k] + N / 2) % N;
+        }
+        for (int k = 0; k < NPIL; ++k) {
+            pil_in_[k]  = bfft_.input_row(pf.pilots[k], true);
+            pil_out_[k] = (pf.pilots[k] + N / 2) % N;
+            psym_[k]    = pf.pilot_sym[k];
+        }
+        for (int k = 0; k < NOCC; ++k) s2occ_[k] = pf.sync2[pf.occupied[k]];
+        for (int k = 0; k < NPIL; ++k) s2pil_[k] = pf.sync2[pf.pilots[k]];
+
+        items_.resize(static_cast<size_t>(dims_.payload_items));
+        idx_.resize(static_cast<size_t>(dims_.data_ofdm_syms) * NOCC);
+
+        sync_.resize(static_cast<size_t>(kNumSyncWords * kSym));
+        emit_symbol(pf.sync1, sync_.data());
+        emit_symbol(pf.sync2, sync_.data() + kSym);
+
+        // TX: header + payload; RX: sync2 + header + payload (tek toplu FFT)
+        const int nsym = 2 + dims_.data_ofdm_syms;
+        const size_t blocks = static_cast<size_t>((nsym + kBatchLanes - 1) / kBatchLanes);
+        plane_ = blocks * kBlk;
+        soa_.assign(2 * plane_ + kBatchLanes, 0.f);
+        re_ = soa_.data();
+        im_ = soa_.data() + plane_ + kBatchLanes;
+    }
+
+    void modulate(const uint8_t* packet, cf32* out) override {
+        const int n  = packet_len_;
+        const int ni = dims_.payload_items;
+        const int nsym = 1 + dims_.data_ofdm_syms;
+        const size_t blocks = static_cast<size_t>((nsym + kBatchLanes - 1) / kBatchLanes);
+
+        // Header: ilk 48 taşıyıcı packet_header_default, geniş profillerde kalan bitler 0
+        uint8_t hb[NOCC] = {};
+        ck_packet_build(packet, static_cast<size_t>(n), hdr_num_, items_.data(), hb);
+        hdr_num_ = static_cast<uint16_t>((hdr_num_ + 1) & 0x0FFF);
+
+        std::memcpy(out, sync_.data(), sizeof(cf32) * sync_.size());
+        out += sync_.size();
+
+        std::memset(re_, 0, sizeof(float) * blocks * kBlk);
+        std::memset(im_, 0, sizeof(float) * blocks * kBlk);
+
+        for (int k = 0; k < NOCC; ++k) put(0, occ_in_[k], hb[k] ? 1.f : -1.f, 0.f);
+        for (int k = 0; k < NPIL; ++k) put(0, pil_in_[k], psym_[k].real(), psym_[k].imag());
+
+        // Payload: repack_bits_bb(8 -> BPS, LSB önce)
+        int item = 0, sub = 0;
+        for (int s = 1; s <= dims_.data_ofdm_syms; ++s) {
+            const int cnt = std::min(NOCC, (ni - item) * kSpb - sub);
+            for (int k = 0; k < cnt; ++k) {
+                const uint32_t v = (static_cast<uint32_t>(items_[static_cast<size_t>(item)]) >> (sub * BPS)) & kMask;
+                put(s, occ_in_[k], pts_[v].real(), pts_[v].imag());
+                if (++sub == kSpb) { sub = 0; ++item; }
+            }
+            for (int k = 0; k < NPIL; ++k) put(s, pil_in_[k], psym_[k].real(), psym_[k].imag());
+        }
+
+        bfft_.transform_permuted(re_, im_, blocks, true);
+
+        const float a = scale_;
+        for (size_t b = 0; b < blocks; ++b) {
+            const int cnt = std::min(kBatchLanes, nsym - static_cast<int>(b) * kBatchLanes);
+            cf32* base = out + b * kBatchLanes * kSym;
+            const float* rb = re_ + b * kBlk;
+            const float* ib = im_ + b * kBlk;
+            for (int t = 0; t < N; ++t) {
+                const float* rr = rb + t * kBatchLanes;
+                const float* ri = ib + t * kBatchLanes;
+                for (int s = 0; s < cnt; ++s) {
+                    const cf32 v(rr[s] * a, ri[s] * a);
+                    cf32* sym = base + static_cast<size_t>(s) * kSym;
+                    sym[CP + t] = v;
+                    if (t >= N - CP) sym[t - (N - CP)] = v;
+                }
+            }
+        }
+    }
+
+    int demodulate(const cf32* in, uint8_t* out, uint16_t* number) override {
+        const int nsym = 2 + dims_.data_ofdm_syms;
+        const size_t blocks = static_cast<size_t>((nsym + kBatchLanes - 1) / kBatchLanes);
+
+        // sync2'den itibaren tüm gövdeler bit-ters satırlara, tek FFT çağrısı
+        for (int s = 0; s < nsym; ++s) {
+            const cf32* r = in + static_cast<size_t>(1 + s) * kSym + CP;
+            const size_t at0 = lane(s);
+            for (int i = 0; i < N; ++i) {
+                const size_t at = at0 + static_cast<size_t>(bfft_.input_row(i, false)) * kBatchLanes;
+                re_[at] = r[i].real();
+                im_[at] = r[i].imag();
+            }
+        }
+        bfft_.transform_permuted(re_, im_, blocks, false);
+
+        // LS kanal kestirimi (sync2 ±1): H = Y * S
+        for (int k = 0; k < NOCC; ++k) hocc_[k] = cmul(bin(0, occ_out_[k]), s2occ_[k]);
+        for (int k = 0; k < NPIL; ++k) hpil_[k] = cmul(bin(0, pil_out_[k]), s2pil_[k]);
+        for (int k = 0; k < NOCC; ++k) {
+            const float g = std::norm(hocc_[k]);
+            ginv_[k] = g > 1e-30f ? std::conj(hocc_[k]) / g : cf32(0.f, 0.f);
+        }
+
+        // Header (BPSK): 12 bit uzunluk, 12 bit no, CRC8
+        equalize(1);
+        uint32_t hw = 0;
+        for (int k = 0; k < 32; ++k) hw |= static_cast<uint32_t>(eq_[k].real() > 0.f) << k;
+        uint16_t len = 0, num = 0;
+        if (ck_header_parse(hw, &len, &num) != 0 || len != dims_.payload_items) return -1;
+        if (number) *number = num;
+
+        // Payload sert karar -> repack_bits_bb(BPS -> 8)
+        uint8_t* idx = idx_.data();
+        for (int s = 0; s < dims_.data_ofdm_syms; ++s) {
+            equalize(2 + s);
+            for (int k = 0; k < NOCC; ++k) idx[k] = slice(eq_[k]);
+            idx += NOCC;
+        }
+        const int ni = dims_.payload_items;
+        for (int j = 0; j < ni; ++j) {
+            const uint8_t* v = idx_.data() + static_cast<size_t>(j) * kSpb;
+            uint32_t b = 0;
+            for (int t = 0; t < kSpb; ++t) b |= static_cast<uint32_t>(v[t]) << (t * BPS);
+            items_[static_cast<size_t>(j)] = static_cast<uint8_t>(b);
+        }
+
+        const int n = packet_len_;
+        const bool ok = ck_packet_check(items_.data(), static_cast<size_t>(ni)) != 0;
+        std::memcpy(out, items_.data(), static_cast<size_t>(n));
+        return ok ? n : -2;
+    }
+
+private:
+    size_t lane(int s) const {
+        return static_cast<size_t>(s / kBatchLanes) * kBlk + static_cast<size_t>(s % kBatchLanes);
+    }
+    void put(int s, int row, float re, float im) {
+        const size_t at = lane(s) + static_cast<size_t>(row) * kBatchLanes;
+        re_[at] = re;
+        im_[at] = im;
+    }
+    cf32 bin(int s, int row) const {
+        const size_t at = lane(s) + static_cast<size_t>(row) * kBatchLanes;
+        return cf32(re_[at], im_[at]);
+    }
+
+    // Pilotlardan ortak faz hatası, sonra eq = Y * conj(rot) / H
+    void equalize(int s) {
+        cf32 cpe(0.f, 0.f);
+        for (int k = 0; k < NPIL; ++k) cpe += cmulc(bin(s, pil_out_[k]), cmul(hpil_[k], psym_[k]));
+        const float mag = std::abs(cpe);
+        const cf32 derot = mag > 0.f ? std::conj(cpe) / mag : cf32(1.f, 0.f);
+        for (int k = 0; k < NOCC; ++k) eq_[k] = cmul(cmul(bin(s, occ_out_[k]), ginv_[k]), derot);
+    }
+
+    // constellation_decoder_cb eşleniği; BPSK/QPSK işaret, diğerleri en yakın nokta
+    uint8_t slice(cf32 v) const {
+        if constexpr (BPS == 1) {
+            return static_cast<uint8_t>(v.real() > 0.f);
+        } else if constexpr (BPS == 2) {
+            return static_cast<uint8_t>(((v.imag() > 0.f) << 1) | (v.real() > 0.f));
+        } else {
+            uint8_t best = 0;
+            float   bd   = 1e30f;
+            for (int k = 0; k < kPts; ++k) {
+                const float dr = v.real() - pts_[k].real(), di = v.imag() - pts_[k].imag();
+                const float d  = dr * dr + di * di;
+                if (d < bd) { bd = d; best = static_cast<uint8_t>(k); }
+            }
+            return best;
+        }
+    }
+
+    // Sabit sync sembolleri: tekil IFFT + CP + genlik
+    void emit_symbol(const cf32* freq, cf32* out) {
+        cf32* body = out + CP;
+        fft_.inverse_shifted(freq, body);
+        for (int i = 0; i < N; ++i) body[i] = cf32(body[i].real() * scale_, body[i].imag() * scale_);
+        std::memcpy(out, body + N - CP, sizeof(cf32) * CP);
+    }
+
+    Fft      fft_;
+    BatchFft bfft_;
+    float    scale_ = 0.f;
+    cf32     pts_[kPts];
+    int      occ_in_[NOCC], occ_out_[NOCC];   // TX giriş satırı (shift'li), RX çıkış satırı
+    int      pil_in_[NPIL], pil_out_[NPIL];
+    cf32     psym_[NPIL];
+    cf32     s2occ_[NOCC], s2pil_[NPIL];
+
+    cf32     hocc_[NOCC], hpil_[NPIL], ginv_[NOCC];
+    cf32     eq_[NOCC];
+
+    std::vector<cf32>    sync_;
+    std::vector<uint8_t> items_;
+    std::vector<uint8_t> idx_;
+    std::vector<float>   soa_;
+    size_t               plane_ = 0;
+    float*               re_ = nullptr;
+    float*               im_ = nullptr;
+};
+
+template <int N, int CP, int NOCC, int NPIL>
+static std::unique_ptr<ProfileModem> make_kernel(const Profile& pf, Modulation m, int packet_len, float amp) {
+    if (pf.fft_len != N || pf.cp_len != CP || pf.n_occupied != NOCC || pf.n_pilots != NPIL)
+        throw std::invalid_argument("profile table does not match kernel");
+    switch (m) {
+        case Modulation::BPSK:  return std::make_unique<ModemKernel<N, CP, NOCC, NPIL, 1>>(pf, m, packet_len, amp);
+        case Modulation::QPSK:  return std::make_unique<ModemKernel<N, CP, NOCC, NPIL, 2>>(pf, m, packet_len, amp);
+        case Modulation::QAM16: return std::make_unique<ModemKernel<N, CP, NOCC, NPIL, 4>>(pf, m, packet_len, amp);
+    }
+    throw std::invalid_argument("unsupported modulation");
+}
+
+} // namespace ofdm
+
+// ------------------------------------------------------------ DLL arayüzü
+
+OFDM_API int ofdm_profile_count() { return ofdm::profile_count(); }
+
+OFDM_API int ofdm_profile_info(int index, char* name, int name_cap, int out[4]) {
+    const ofdm::Profile* pf = ofdm::profile_at(index);
+    if (!pf) return -1;
+    if (name) {
+        const size_t n = std::strlen(pf->name);
+        if (name_cap <= 0 || n + 1 > static_cast<size_t>(name_cap)) return -5;
+        std::memcpy(name, pf->name, n + 1);
+    }
+    if (out) {
+        out[0] = pf->fft_len;
+        out[1] = pf->cp_len;
+        out[2] = pf->n_occupied;
+        out[3] = pf->n_pilots;
+    }
+    return 0;
+}
+
+OFDM_API void* ofdm_pm_create(const char* profile, int bits_per_symbol, int packet_len, float amp) {
+    try {
+        const ofdm::Profile* pf = ofdm::find_profile(profile);
+        ofdm::Modulation m;
+        switch (bits_per_symbol) {
+            case 1: m = ofdm::Modulation::BPSK;  break;
+            case 2: m = ofdm::Modulation::QPSK;  break;
+            case 4: m = ofdm::Modulation::QAM16; break;
+            default: return nullptr;
+        }
+        if (!pf) return nullptr;
+        return ofdm::make_profile_modem(*pf, m, packet_len, amp).release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OFDM_API int ofdm_pm_packet_samples(void* h) {
+    return h ? static_cast<ofdm::ProfileModem*>(h)->packet_samples() : -1;
+}
+
+OFDM_API int ofdm_pm_modulate(void* h, const std::uint8_t* packet, float* out_iq) {
+    if (!h || !packet || !out_iq) return -1;
+    static_cast<ofdm::ProfileModem*>(h)->modulate(packet, reinterpret_cast<ofdm::cf32*>(out_iq));
+    return 0;
+}
+
+OFDM_API int ofdm_pm_demodulate(void* h, const float* in_iq, std::uint8_t* out) {
+    if (!h || !in_iq || !out) return -4;
+    return static_cast<ofdm::ProfileModem*>(h)->demodulate(reinterpret_cast<const ofdm::cf32*>(in_iq), out);
+}
+
+OFDM_API void ofdm_pm_destroy(void* h) {
+    delete static_cast<ofdm::ProfileModem*>(h);
+}
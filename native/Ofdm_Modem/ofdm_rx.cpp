@@ -0,0 +1,487 @@
+#include "Include/ofdm_rx.hpp"
+#include "../Checksum/Include/checksum.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <stdexcept>
+
+namespace ofdm {
+
+static constexpr double kPi  = 3.14159265358979323846;
+static constexpr int    kL   = kFftLen / 2;     // Schmidl-Cox yarım sembol gecikmesi
+static constexpr int    kRefreshEvery = 4096;   // kayan toplamların yeniden hesap aralığı
+static constexpr int    kPlateauHold  = 4;      // platonun bitti sayılması için eşik altı örnek
+
+static inline cf32 cmul(cf32 a, cf32 b) {
+    return cf32(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+static inline cf32 cmulc(cf32 a, cf32 b) {   // a * conj(b)
+    return cf32(a.real() * b.real() + a.imag() * b.imag(), a.imag() * b.real() - a.real() * b.imag());
+}
+
+Receiver::Receiver(const RxParams& p, PacketFn on_packet)
+    : p_(p),
+      on_packet_(std::move(on_packet)),
+      cp_(p.cp_len > 0 ? p.cp_len : kDefaultCp),
+      fft_(kFftLen),
+      bfft_(kFftLen),
+      dfe_(p.dfe_alpha),
+      demap_(p.mod)
+{
+    if (p_.max_items <= kCrcLenUnpacked || p_.max_items > 0x0FFF)
+        throw std::invalid_argument("max_items must be in (32, 4095]");
+    if (8 % bits_per_symbol(p_.mod) != 0) throw std::invalid_argument("unsupported modulation");
+
+    // En uzun çerçeve + arama penceresi; push() daha büyük parçaları bölerek işler
+    const FrameDims d = frame_dims(p_.max_items - kCrcLenUnpacked, p_.mod, cp_);
+    buf_.resize(static_cast<size_t>(d.samples) + 4 * sym_len() + 2 * kL);
+    sym_idx_.resize(static_cast<size_t>(d.data_ofdm_syms) * kNumOccupied);
+    dfe_.reserve(d.data_ofdm_syms);
+    const size_t plane = static_cast<size_t>((d.data_ofdm_syms + kBatchLanes - 1) / kBatchLanes) * kFftLen * kBatchLanes;
+    soa_.assign(2 * plane + kBatchLanes, 0.f);
+    soa_re_ = soa_.data();
+    soa_im_ = soa_.data() + plane + kBatchLanes;
+    items_buf_.resize(static_cast<size_t>(p_.max_items));
+    if (p_.soft) {
+        eq_.resize(sym_idx_.size());
+        gain_.resize(sym_idx_.size());
+        llr_.resize(sym_idx_.size() * static_cast<size_t>(bits_per_symbol(p_.mod)));
+        rel_.resize(static_cast<size_t>(p_.max_items));
+    }
+}
+
+void Receiver::reset() {
+    tail_ = 0;
+    base_ = 0;
+    st_   = RxStats{};
+    state_ = State::Search;
+    resume_search(0);
+}
+
+void Receiver::resume_search(size_t pos) {
+    state_   = State::Search;
+    d_       = pos;
+    sums_ok_ = false;
+    in_plat_ = false;
+    items_   = -1;
+}
+
+void Receiver::push(const cf32* x, size_t n) {
+    st_.samples += n;
+    while (n > 0) {
+        if (tail_ == buf_.size()) {
+            // Tüketilen baştaki örnekleri at (arama: plato başı / pencere, çerçeve: sync1)
+            size_t keep = (state_ == State::Frame) ? start_ : (in_plat_ ? std::min(plat_a_, d_) : d_);
+            keep = std::min(keep, tail_);
+            if (keep == 0) {
+                // Olmamalı (tampon en uzun çerçeveye göre); yine de takılmamak için aramaya dön
+                resume_search(tail_ > 2 * kL ? tail_ - 2 * kL : 0);
+                continue;
+            }
+            std::memmove(buf_.data(), buf_.data() + keep, sizeof(cf32) * (tail_ - keep));
+            tail_ -= keep;
+            base_ += keep;
+            d_     -= std::min(d_, keep);
+            plat_a_ -= std::min(plat_a_, keep);
+            plat_b_ -= std::min(plat_b_, keep);
+            start_  -= std::min(start_, keep);
+        }
+        const size_t k = std::min(n, buf_.size() - tail_);
+        std::memcpy(buf_.data() + tail_, x, sizeof(cf32) * k);
+        tail_ += k;
+        x     += k;
+        n     -= k;
+        run();
+    }
+}
+
+void Receiver::run() {
+    for (;;) {
+        if (state_ == State::Search) {
+            if (!search()) return;
+        } else {
+            if (!decode_frame()) return;
+        }
+    }
+}
+
+// ofdm_sync_sc_cfb eşleniği: P(d) = sum r*[d+m] r[d+m+L], M = |P|^2 / (R1 R2).
+// sync_word1 yalnız tek taşıyıcılarda dolu -> iki yarı ters işaretli (anti-periyodik);
+// açı -P üzerinden alınır, böylece kesirli CFO doğrudan taşıyıcı aralığı cinsinden çıkar.
+bool Receiver::search() {
+    const cf32* r   = buf_.data();
+    const double thr = p_.sync_threshold;
+    const size_t max_plat = static_cast<size_t>(cp_ + kL);
+
+    while (d_ + 2 * kL < tail_) {
+        if (!sums_ok_ || since_refresh_ >= kRefreshEvery) {
+            p_re_ = p_im_ = r1_ = r2_ = 0.0;
+            for (int m = 0; m < kL; ++m) {
+                const cf32 a = r[d_ + m], b = r[d_ + m + kL];
+                const cf32 c = cmulc(b, a);
+                p_re_ += c.real(); p_im_ += c.imag();
+                r1_ += std::norm(a);
+                r2_ += std::norm(b);
+            }
+            sums_ok_ = true;
+            since_refresh_ = 0;
+        }
+
+        const double den = r1_ * r2_;
+        const double met = (den > 1e-30) ? (p_re_ * p_re_ + p_im_ * p_im_) / den : 0.0;
+        if (met > thr) {
+            if (!in_plat_) { in_plat_ = true; plat_a_ = d_; ps_re_ = ps_im_ = 0.0; below_ = 0; }
+            plat_b_ = d_;
+            below_  = 0;
+            ps_re_ += p_re_; ps_im_ += p_im_;
+        } else if (in_plat_ && ++below_ >= kPlateauHold) {
+            in_plat_ = false;
+            // Sürekli periyodik girişim (CW/DC) uzun plato üretir: çerçeve değil
+            if (plat_b_ - plat_a_ <= max_plat) {
+                ++st_.syncs;
+                // Plato ~[s0-cp, s0]; ortası s0-cp/2. FFT penceresi s0-cp/4 (çok yollu kanala pay)
+                start_ = (plat_a_ + plat_b_) / 2 + static_cast<size_t>(cp_ / 4);
+                eps_   = std::atan2(-ps_im_, -ps_re_) / kPi;
+                items_ = -1;
+                state_ = State::Frame;
+                return true;
+            }
+        }
+
+        // Bir örnek kaydır
+        const cf32 a0 = r[d_], a1 = r[d_ + kL], a2 = r[d_ + 2 * kL];
+        const cf32 add = cmulc(a2, a1), sub = cmulc(a1, a0);
+        p_re_ += add.real() - sub.real();
+        p_im_ += add.imag() - sub.imag();
+        r1_ += std::norm(a1) - std::norm(a0);
+        r2_ += std::norm(a2) - std::norm(a1);
+        ++d_;
+        ++since_refresh_;
+    }
+    return false;
+}
+
+// pos'taki 64 örneği start_'a göre sürekli fazla CFO düzeltip FFT alır (çıkış shift'li)
+void Receiver::fft_at(size_t pos, double eps, cf32* out) {
+    const double w  = -2.0 * kPi * eps / kFftLen;
+    const double ph = w * (static_cast<double>(pos) - static_cast<double>(start_));
+    cf32 rot(static_cast<float>(std::cos(ph)), static_cast<float>(std::sin(ph)));
+    const cf32 step(static_cast<float>(std::cos(w)), static_cast<float>(std::sin(w)));
+    const cf32* r = buf_.data() + pos;
+    for (int i = 0; i < kFftLen; ++i) {
+        tmp_[i] = cmul(r[i], rot);
+        rot = cmul(rot, step);
+    }
+    fft_.forward_shifted(tmp_, out);
+}
+
+// pos0'dan başlayan count sembolün gövdeleri CFO düzeltilerek bit-ters satırlara yazılır
+void Receiver::fft_payload(size_t pos0, int count, double eps) {
+    const double w  = -2.0 * kPi * eps / kFftLen;
+    const cf32 step(static_cast<float>(std::cos(w)), static_cast<float>(std::sin(w)));
+    for (int s = 0; s < count; ++s) {
+        const size_t pos = pos0 + static_cast<size_t>(s) * sym_len();
+        const double ph  = w * (static_cast<double>(pos) - static_cast<double>(start_));
+        cf32 rot(static_cast<float>(std::cos(ph)), static_cast<float>(std::sin(ph)));
+        const size_t blk = static_cast<size_t>(s / kBatchLanes) * kFftLen * kBatchLanes + static_cast<size_t>(s % kBatchLanes);
+        const cf32* r = buf_.data() + pos;
+        for (int i = 0; i < kFftLen; ++i) {
+            const cf32 v = cmul(r[i], rot);
+            const size_t at = blk + static_cast<size_t>(bfft_.input_row(i, false)) * kBatchLanes;
+            soa_re_[at] = v.real();
+            soa_im_[at] = v.imag();
+            rot = cmul(rot, step);
+        }
+    }
+    bfft_.transform_permuted(soa_re_, soa_im_, static_cast<size_t>((count + kBatchLanes - 1) / kBatchLanes), false);
+}
+
+// Karar yönlü sigma^2 = ortalama |y - H*karar|^2 (düşük SNR'de iyimser; taban ile
+// sınırlanır). Taşıyıcı başına ölçek |H|^2/sigma^2: y/H'nin gürültüsü sigma^2/|H|^2.
+void Receiver::soft_decode(int n_syms) {
+    const double nv = dfe_.noise_count() ? dfe_.noise_sum() / static_cast<double>(dfe_.noise_count()) : 1.0;
+    double g = 0.0;
+    for (int i = 0; i < n_syms; ++i) g += gain_[static_cast<size_t>(i)];
+    const double floor = 1e-4 * (n_syms ? g / n_syms : 1.0);   // ~40 dB SNR üstü kırpılır
+    nv_ = static_cast<float>(std::max(nv, floor));
+    const float inv = 1.f / nv_;
+    for (int i = 0; i < n_syms; ++i) gain_[static_cast<size_t>(i)] *= inv;
+    demap_.demap(eq_.data(), gain_.data(), n_syms, llr_.data());
+    // bps * (8 / bps) = 8: bayt j'nin LLR'leri llr_[8j..8j+7]
+    for (int j = 0; j < items_; ++j) rel_[static_cast<size_t>(j)] = byte_reliability(llr_.data() + 8 * static_cast<size_t>(j));
+}
+
+bool Receiver::decode_frame() {
+    const size_t sym = sym_len();
+
+    if (items_ < 0) {
+        if (start_ + 2 * sym + kFftLen > tail_) return false;
+
+        // Tamsayı taşıyıcı ofseti (ofdm_chanest_vcvc max_carr_offset): sync_word2'nin
+        // komşu taşıyıcı farkı ile ilintisi kanal fazından bağımsızdır
+        fft_at(start_ + sym, eps_, y_);
+        int   best_q = 0;
+        float best_s = -1.f;
+        for (int q = -p_.max_carrier_offset; q <= p_.max_carrier_offset; ++q) {
+            cf32 acc(0.f, 0.f);
+            for (int i = 0; i + 1 < kFftLen; ++i) {
+                const float s = kSyncWord2[i].real() * kSyncWord2[i + 1].real();
+                if (s == 0.f) continue;
+                const int a = i + q, b = i + 1 + q;
+                if (a < 0 || b >= kFftLen) continue;
+                acc += s * cmulc(y_[a], y_[b]);
+            }
+            const float sc = std::norm(acc);
+            if (sc > best_s) { best_s = sc; best_q = q; }
+        }
+        if (best_q != 0) {
+            eps_ += best_q;
+            fft_at(start_ + sym, eps_, y_);
+        }
+        dfe_.init(y_);
+
+        // Header: BPSK, 12 bit uzunluk + 12 bit no + CRC8 (soft: gürültü kestirimine de katılır)
+        uint8_t hb[kHeaderBits];
+        cf32    he[kHeaderBits];
+        float   hg[kHeaderBits];
+        dfe_.reset_noise();
+        fft_at(start_ + 2 * sym, eps_, y_);
+        dfe_.equalize(y_, kHeaderBits, Modulation::BPSK, hb, p_.soft ? he : nullptr, hg);
+        uint16_t len = 0, num = 0;
+        uint8_t  crc = 0;
+        for (int i = 0; i < 12; ++i) len = static_cast<uint16_t>(len | (hb[i] << i));
+        for (int i = 0; i < 12; ++i) num = static_cast<uint16_t>(num | (hb[12 + i] << i));
+        for (int i = 0; i < 8;  ++i) crc = static_cast<uint8_t>(crc | (hb[24 + i] << i));
+        if (crc != header_crc8(len, num) || len <= kCrcLenUnpacked || len > p_.max_items) {
+            ++st_.header_fail;
+            resume_search(start_ + sym);
+            return true;
+        }
+        items_  = len;
+        number_ = num;
+    }
+
+    const int bps    = bits_per_symbol(p_.mod);
+    const FrameDims fd = frame_dims(items_ - kCrcLenUnpacked, p_.mod, cp_);
+    const size_t end = start_ + static_cast<size_t>(fd.ofdm_syms) * sym;
+    if (end - sym + kFftLen > tail_) return false;
+
+    fft_payload(start_ + 3 * sym, fd.data_ofdm_syms, eps_);
+    dfe_.equalize_batch(soa_re_, soa_im_, fd.data_ofdm_syms, fd.payload_syms, p_.mod, sym_idx_.data(),
+                        p_.soft ? eq_.data() : nullptr, p_.soft ? gain_.data() : nullptr);
+    if (p_.soft) soft_decode(fd.payload_syms);
+
+    // repack_bits_bb(bps -> 8, LSB önce)
+    const int spb = 8 / bps;
+    for (int j = 0; j < items_; ++j) {
+        const uint8_t* v = sym_idx_.data() + static_cast<size_t>(j) * spb;
+        uint8_t b = 0;
+        for (int t = 0; t < spb; ++t) b = static_cast<uint8_t>(b | (v[t] << (t * bps)));
+        items_buf_[static_cast<size_t>(j)] = b;
+    }
+
+    // crc32_bb(check=True, packed=False)
+    const int n = items_ - kCrcLenUnpacked;
+    const bool ok = ck_packet_check(items_buf_.data(), static_cast<size_t>(items_)) != 0;
+
+    if (ok) {
+        ++st_.packets;
+        st_.bytes += static_cast<uint64_t>(n);
+    } else {
+        ++st_.crc_fail;
+    }
+    if (on_packet_ && (ok || p_.deliver_crc_fail)) {
+        RxPacket pk;
+        pk.data   = items_buf_.data();
+        pk.len    = n;
+        pk.number = number_;
+        pk.cfo    = static_cast<float>(eps_);
+        pk.start  = base_ + start_;
+        pk.end    = base_ + end;
+        pk.crc_ok = ok;
+        if (p_.soft) {
+            pk.llr         = llr_.data();
+            pk.reliability = rel_.data();
+            pk.noise_var   = nv_;
+        }
+        on_packet_(pk);
+    }
+
+    // Sonraki paketin sync1 CP'si s0' - cp'de başlar; rampanın önünden aramaya dön
+    const size_t back = static_cast<size_t>(cp_ - cp_ / 4 + kL / 2);
+    resume_search(end > back ? end - back : end);
+    return true;
+}
+
+} // namespace ofdm
+
+// ------------------------------------------------------------ DLL arayüzü
+
+namespace {
+struct RxHandle {
+    static constexpr size_t kMaxQueued = 256;   // okunmayan paketlerde en eski atılır
+    std::deque<std::vector<uint8_t>> q;
+    ofdm::Receiver rx;
+
+    explicit RxHandle(const ofdm::RxParams& p)
+        : rx(p, [this](const ofdm::RxPacket& pk) {
+              if (q.size() >= kMaxQueued) q.pop_front();
+              q.emplace_back(pk.data, pk.data + pk.len);
+          }) {}
+};
+
+bool to_mod_(int bps, ofdm::Modulation& m) {
+    switch (bps) {
+        case 1: m = ofdm::Modulation::BPSK;  return true;
+        case 2: m = ofdm::Modulation::QPSK;  return true;
+        case 4: m = ofdm::Modulation::QAM16; return true;
+        default: return false;
+    }
+}
+} // namespace
+
+OFDM_API void* ofdm_rx_create(int bits_per_symbol, int cp_len, float sync_threshold) {
+    try {
+        ofdm::RxParams p;
+        if (!to_mod_(bits_per_symbol, p.mod)) return nullptr;
+        p.cp_len = cp_len;
+        if (sync_threshold > 0.f) p.sync_threshold = sync_threshold;
+        return new RxHandle(p);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OFDM_API int ofdm_rx_push(void* h, const float* iq, int n_samples) {
+    if (!h || (!iq && n_samples > 0) || n_samples < 0) return -1;
+    auto* r = static_cast<RxHandle*>(h);
+    r->rx.push(reinterpret_cast<const ofdm::cf32*>(iq), static_cast<size_t>(n_samples));
+    return static_cast<int>(r->q.size());
+}
+
+OFDM_API int ofdm_rx_pop(void* h, std::uint8_t* out, int cap) {
+    if (!h || !out) return -1;
+    auto* r = static_cast<RxHandle*>(h);
+    if (r->q.empty()) return 0;
+    const auto& pk = r->q.front();
+    if (static_cast<int>(pk.size()) > cap) return -static_cast<int>(pk.size());
+    std::memcpy(out, pk.data(), pk.size());
+    const int n = static_cast<int>(pk.size());
+    r->q.pop_front();
+    return n;
+}
+
+OFDM_API int ofdm_rx_stats(void* h, std::uint64_t out[6]) {
+    if (!h || !out) return -1;
+    const auto& s = static_cast<RxHandle*>(h)->rx.stats();
+    out[0] = s.samples; out[1] = s.syncs; out[2] = s.header_fail;
+    out[3] = s.crc_fail; out[4] = s.packets; out[5] = s.bytes;
+    return 0;
+}
+
+OFDM_API void ofdm_rx_destroy(void* h) {
+    delete static_cast<RxHandle*>(h);
+}
+
+OFDM_API int ofdm_rx_file(const char* in_path, const char* out_path, int bits_per_symbol, int cp_len) {
+    try {
+        ofdm::RxParams p;
+        if (!to_mod_(bits_per_symbol, p.mod)) return -4;
+        p.cp_len = cp_len;
+
+        std::ifstream fin(in_path, std::ios::binary);
+        if (!fin) return -1;
+        std::ofstream fout(out_path, std::ios::binary);
+        if (!fout) return -2;
+
+        ofdm::Receiver rx(p, [&](const ofdm::RxPacket& pk) {
+            fout.write(reinterpret_cast<const char*>(pk.data), pk.len);
+        });
+        std::vector<ofdm::cf32> chunk(8192);
+        for (;;) {
+            fin.read(reinterpret_cast<char*>(chunk.data()),
+                     static_cast<std::streamsize>(chunk.size() * sizeof(ofdm::cf32)));
+            const size_t n = static_cast<size_t>(fin.gcount()) / sizeof(ofdm::cf32);
+            if (n == 0) break;
+            rx.push(chunk.data(), n);
+        }
+        if (!fout) return -3;
+        return static_cast<int>(rx.stats().packets);
+    } catch (...) {
+        return -99;
+    }
+}
+
+namespace {
+// RSEH kaydı (ofdm_rx.hpp'deki düzen; rs_container.c rs_hints_load ile aynı)
+#pragma pack(push, 1)
+struct HintRec {
+    uint64_t offset;
+    uint32_t len;
+    uint8_t  rel;
+    uint8_t  flags;
+    uint16_t reserved;
+};
+#pragma pack(pop)
+static_assert(sizeof(HintRec) == 16, "RSEH record size");
+
+// Bu eşiğin üstündeki baytlar (P(doğru) > ~0.9) yazılmaz; aralık, güvenilirlik
+// 16'lık kovası değişince bölünür ki RS tarafındaki eşik bayt bayt uygulanabilsin
+constexpr uint8_t kHintRecordBelow = 230;
+} // namespace
+
+OFDM_API int ofdm_rx_file_ex(const char* in_path, const char* out_path, const char* hints_path,
+                             int bits_per_symbol, int cp_len) {
+    try {
+        ofdm::RxParams p;
+        if (!to_mod_(bits_per_symbol, p.mod)) return -4;
+        p.cp_len = cp_len;
+        p.soft = true;
+        p.deliver_crc_fail = true;
+
+        std::ifstream fin(in_path, std::ios::binary);
+        if (!fin) return -1;
+        std::ofstream fout(out_path, std::ios::binary);
+        if (!fout) return -2;
+        std::ofstream fh(hints_path, std::ios::binary);
+        if (!fh) return -5;
+        const uint32_t hdr[4] = { 0x48455352u /* 'RSEH' */, 1u, static_cast<uint32_t>(sizeof(HintRec)), 0u };
+        fh.write(reinterpret_cast<const char*>(hdr), sizeof(hdr));
+
+        uint64_t pos = 0;
+        int delivered = 0;
+        ofdm::Receiver rx(p, [&](const ofdm::RxPacket& pk) {
+            fout.write(reinterpret_cast<const char*>(pk.data), pk.len);
+            for (int i = 0; i < pk.len;) {
+                const uint8_t r = pk.reliability[i];
+                if (r >= kHintRecordBelow) { ++i; continue; }
+                HintRec h{ pos + static_cast<uint64_t>(i), 0u, r, 0u, 0u };
+                int j = i;
+                while (j < pk.len && pk.reliability[j] < kHintRecordBelow && (pk.reliability[j] >> 4) == (r >> 4)) {
+                    h.rel = std::min(h.rel, pk.reliability[j]);
+                    ++j;
+                }
+                h.len = static_cast<uint32_t>(j - i);
+                fh.write(reinterpret_cast<const char*>(&h), sizeof(h));
+                i = j;
+            }
+            pos += static_cast<uint64_t>(pk.len);
+            ++delivered;
+        });
+        std::vector<ofdm::cf32> chunk(8192);
+        for (;;) {
+            fin.read(reinterpret_cast<char*>(chunk.data()),
+                     static_cast<std::streamsize>(chunk.size() * sizeof(ofdm::cf32)));
+            const size_t n = static_cast<size_t>(fin.gcount()) / sizeof(ofdm::cf32);
+            if (n == 0) break;
+            rx.push(chunk.data(), n);
+        }
+        if (!fout || !fh) return -3;
+        return delivered;
+    } catch (...) {
+        return -99;
+    }
+}
@@ -0,0 +1,188 @@
+#include "Include/ofdm_tx.hpp"
+#include "../Checksum/Include/checksum.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace ofdm {
+
+Modulator::Modulator(const TxParams& p)
+    : p_(p),
+      cp_(p.cp_len > 0 ? p.cp_len : kDefaultCp),
+      fft_(kFftLen),
+      bfft_(kFftLen),
+      points_(constellation(p.mod))
+{
+    if (p_.packet_len <= 0) throw std::invalid_argument("packet_len must be > 0");
+    dims_ = frame_dims(p_.packet_len, p_.mod, cp_);
+    items_.resize(static_cast<size_t>(dims_.payload_items));
+
+    sync_.resize(static_cast<size_t>(kNumSyncWords * (kFftLen + cp_)));
+    cf32* o = sync_.data();
+    emit_symbol(kSyncWord1, o);
+    emit_symbol(kSyncWord2, o);
+
+    // Header + payload sembolleri; re ve im arasında bir satır boşluk (4K örtüşmesi)
+    const int nsym = 1 + dims_.data_ofdm_syms;
+    blocks_ = static_cast<size_t>((nsym + kBatchLanes - 1) / kBatchLanes);
+    const size_t plane = blocks_ * kFftLen * kBatchLanes;
+    soa_.assign(2 * plane + kBatchLanes, 0.f);
+    re_ = soa_.data();
+    im_ = soa_.data() + plane + kBatchLanes;
+}
+
+inline void Modulator::put(int sym, int idx, cf32 v) {
+    const size_t at = static_cast<size_t>(sym / kBatchLanes) * kFftLen * kBatchLanes
+                    + static_cast<size_t>(bfft_.input_row(idx, true)) * kBatchLanes
+                    + static_cast<size_t>(sym % kBatchLanes);
+    re_[at] = v.real();
+    im_[at] = v.imag();
+}
+
+void Modulator::emit_symbol(const cf32* freq, cf32*& out) {
+    // IFFT doğrudan CP'nin arkasına yazılır, CP son cp_ örneğin kopyasıdır
+    cf32* body = out + cp_;
+    fft_.inverse_shifted(freq, body);
+    const float a = p_.amp;
+    for (int i = 0; i < kFftLen; ++i) body[i] = cf32(body[i].real() * a, body[i].imag() * a);
+    std::memcpy(out, body + kFftLen - cp_, sizeof(cf32) * static_cast<size_t>(cp_));
+    out += kFftLen + cp_;
+}
+
+void Modulator::modulate(const uint8_t* packet, cf32* out) {
+    const int n  = p_.packet_len;
+    const int ni = dims_.payload_items;
+
+    // crc32_bb(check=False, packed=False) + header tek geçişte: 32 ayrı CRC bit-baytı
+    // (LSB önce), header uzunluğu = CRC sonrası öğe sayısı (hdrgen crc çıkışına bağlı)
+    uint8_t hb[kHeaderBits];
+    ck_packet_build(packet, static_cast<size_t>(n), hdr_num_, items_.data(), hb);
+    hdr_num_ = static_cast<uint16_t>((hdr_num_ + 1) & 0x0FFF);
+
+    // Sync kelimeleri (önceden hesaplı)
+    std::memcpy(out, sync_.data(), sizeof(cf32) * sync_.size());
+    out += sync_.size();
+
+    // IFFT yerinde yapıldığından her pakette tüm taşıyıcılar yeniden yazılır
+    const size_t plane = blocks_ * kFftLen * kBatchLanes;
+    std::memset(re_, 0, sizeof(float) * plane);
+    std::memset(im_, 0, sizeof(float) * plane);
+
+    const cf32* bpsk = constellation(Modulation::BPSK);
+    for (int k = 0; k < kNumOccupied; ++k) put(0, kOccupiedIdx[k], bpsk[hb[k]]);
+    for (int k = 0; k < kNumPilots; ++k)   put(0, kPilotIdx[k], kPilotSym[k]);
+
+    // Payload: repack_bits_bb(8 -> bps, LSB önce); son sembolde boş taşıyıcılar sıfır
+    const int bps  = bits_per_symbol(p_.mod);
+    const uint32_t mask = (1u << bps) - 1u;
+    const int spb  = 8 / bps;                    // bayt başına sembol
+    int item = 0, sub = 0;
+    for (int s = 1; s <= dims_.data_ofdm_syms; ++s) {
+        for (int k = 0; k < kNumOccupied && item < ni; ++k) {
+            const uint32_t v = (static_cast<uint32_t>(items_[static_cast<size_t>(item)]) >> (sub * bps)) & mask;
+            put(s, kOccupiedIdx[k], points_[v]);
+            if (++sub == spb) { sub = 0; ++item; }
+        }
+        for (int k = 0; k < kNumPilots; ++k) put(s, kPilotIdx[k], kPilotSym[k]);
+    }
+
+    bfft_.transform_permuted(re_, im_, blocks_, true);
+
+    // SoA -> CP + gövde; satır satır okunur, semboller arası adım (fft_len + cp)
+    const int    nsym = 1 + dims_.data_ofdm_syms;
+    const size_t sl   = static_cast<size_t>(kFftLen + cp_);
+    const float  a    = p_.amp;
+    for (size_t b = 0; b < blocks_; ++b) {
+        const int cnt = std::min(kBatchLanes, nsym - static_cast<int>(b) * kBatchLanes);
+        cf32* base = out + b * kBatchLanes * sl;
+        const float* rb = re_ + b * kFftLen * kBatchLanes;
+        const float* ib = im_ + b * kFftLen * kBatchLanes;
+        for (int t = 0; t < kFftLen; ++t) {
+            const float* rr = rb + t * kBatchLanes;
+            const float* ri = ib + t * kBatchLanes;
+            for (int s = 0; s < cnt; ++s) {
+                const cf32 v(rr[s] * a, ri[s] * a);
+                cf32* sym = base + static_cast<size_t>(s) * sl;
+                sym[cp_ + t] = v;
+                if (t >= kFftLen - cp_) sym[t - (kFftLen - cp_)] = v;
+            }
+        }
+    }
+}
+
+} // namespace ofdm
+
+// ------------------------------------------------------------ DLL arayüzü
+
+static bool to_mod_(int bps, ofdm::Modulation& m) {
+    switch (bps) {
+        case 1: m = ofdm::Modulation::BPSK;  return true;
+        case 2: m = ofdm::Modulation::QPSK;  return true;
+        case 4: m = ofdm::Modulation::QAM16; return true;
+        default: return false;
+    }
+}
+
+OFDM_API int ofdm_tx_file(
+    const char* in_path,
+    const char* out_path,
+    int   bits_per_symbol,
+    int   packet_len,
+    int   cp_len,
+    float amp)
+{
+    try {
+        ofdm::TxParams p;
+        if (!to_mod_(bits_per_symbol, p.mod) || packet_len <= 0) return -4;
+        p.packet_len = packet_len;
+        p.cp_len     = cp_len;
+        p.amp        = amp;
+
+        std::ifstream fin(in_path, std::ios::binary);
+        if (!fin) return -1;
+        std::ofstream fout(out_path, std::ios::binary);
+        if (!fout) return -2;
+
+        ofdm::Modulator mod(p);
+        std::vector<uint8_t>    pkt(static_cast<size_t>(packet_len));
+        std::vector<ofdm::cf32> iq(static_cast<size_t>(mod.packet_samples()));
+        while (fin.read(reinterpret_cast<char*>(pkt.data()), packet_len)) {
+            mod.modulate(pkt.data(), iq.data());
+            fout.write(reinterpret_cast<const char*>(iq.data()),
+                       static_cast<std::streamsize>(iq.size() * sizeof(ofdm::cf32)));
+        }
+        if (!fout) return -3;
+        return 0;
+    } catch (...) {
+        return -99;
+    }
+}
+
+OFDM_API void* ofdm_tx_create(int bits_per_symbol, int packet_len, int cp_len, float amp) {
+    try {
+        ofdm::TxParams p;
+        if (!to_mod_(bits_per_symbol, p.mod) || packet_len <= 0) return nullptr;
+        p.packet_len = packet_len;
+        p.cp_len     = cp_len;
+        p.amp        = amp;
+        return new ofdm::Modulator(p);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OFDM_API int ofdm_tx_packet_samples(void* h) {
+    return h ? static_cast<ofdm::Modulator*>(h)->packet_samples() : -1;
+}
+
+OFDM_API int ofdm_tx_modulate(void* h, const std::uint8_t* packet, float* out_iq) {
+    if (!h || !packet || !out_iq) return -1;
+    static_cast<ofdm::Modulator*>(h)->modulate(packet, reinterpret_cast<ofdm::cf32*>(out_iq));
+    return 0;
+}
+
+OFDM_API void ofdm_tx_destroy(void* h) {
+    delete static_cast<ofdm::Modulator*>(h);
+}
@@ -3,9 +3,11 @@
 // - Keeps on-disk format stable (v4)
 // - Adds: pack_ex (IL/Slice), unpack_ex (PAD), residual BER estimate (CRC-based)
 // - Progress/cancel callbacks
+// - Soft-decision hints (RSEH sidecar) -> per-column erasures
+// - Known-missing ranges (UDP sequence gaps, RSEH flag bit0) -> skipped on resync, erased
 //
-// Build (Linux/macOS):  gcc -O3 -shared -fPIC -o rs_container.so rs_container.c fec.o
-// Build (Windows):      cl /O2 /LD rs_container.c fec.obj
+// Build (Linux/macOS):  gcc -O3 -shared -fPIC -o rs_container.so rs_container.c ../Checksum/checksum.c fec.o
+// Build (Windows):      cl /O2 /LD rs_container.c ..\Checksum\checksum.c fec.obj
 //
 // Author: (you)
 // Date: 2025-08-13
@@ -16,6 +18,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "fec.h"
+#include "../Checksum/Include/checksum.h"
 
 #ifdef _WIN32
 #define DLL_EXPORT __declspec(dllexport)
@@ -116,45 +119,10 @@ typedef struct {
 #pragma pack(pop)
 
 // -------------------- CRC ----------------------------
-static uint32_t crc32_table[256];
-static int crc32_init_done = 0;
-static void crc32_init(void){
-    if (crc32_init_done) return;
-    for (uint32_t i=0;i<256;i++){
-        uint32_t c=i;
-        for (int j=0;j<8;j++)
-            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
-        crc32_table[i]=c;
-    }
-    crc32_init_done = 1;
-}
-static uint32_t crc32_calc(const uint8_t* buf, size_t len){
-    crc32_init();
-    uint32_t c=0xFFFFFFFFu;
-    for (size_t i=0;i<len;i++)
-        c = crc32_table[(c ^ buf[i]) & 0xFFu] ^ (c >> 8);
-    return c ^ 0xFFFFFFFFu;
-}
-
-static uint16_t crc16_table[256];
-static int crc16_init_done = 0;
-static void crc16_init(void){
-    if (crc16_init_done) return;
-    for (int i=0;i<256;i++){
-        uint16_t c = (uint16_t)(i << 8);
-        for (int j=0;j<8;j++)
-            c = (c & 0x8000) ? (uint16_t)((c << 1) ^ 0x1021) : (uint16_t)(c << 1);
-        crc16_table[i] = c;
-    }
-    crc16_init_done = 1;
-}
-static uint16_t crc16_ccitt(const uint8_t *buf, size_t len){
-    crc16_init();
-    uint16_t crc = 0xFFFF;
-    for (size_t i=0;i<len;i++)
-        crc = (uint16_t)((crc << 8) ^ crc16_table[((crc >> 8) ^ buf[i]) & 0xFF]);
-    return crc;
-}
+// CRC-32 / CRC-16 çekirdekleri ortak Checksum modülünde (PCLMUL + dilimleme-8,
+// 4'lü serpiştirilmiş CRC-16); biçimler değişmedi.
+#define crc32_calc  ck_crc32
+#define crc16_ccitt ck_crc16_ccitt
 
 // -------------------- Utils --------------------
 static int64_t ftell64_(FILE* f){
@@ -187,6 +155,189 @@ static size_t payload_len_bytes(int r){
          + (size_t)K_SHARDS * 2u + (size_t)r * 2u;
 }
 
+// -------------------- Soft-decision hints (erasures) --------------------
+// Alıcının (ofdm_rx_file_ex) düşük güvenli bulduğu bayt aralıkları. CRC32'si tutmayan
+// dilim normalde atılır; üstüne ipucu düşüyorsa verisi kullanılır ve ipucu baytları
+// RS silmesi olur (silme 1, hata 2 parite sembolü harcar). Güvenilirlik: P(doğru)*255.
+#ifndef RS_ERASE_BELOW_DEFAULT
+#define RS_ERASE_BELOW_DEFAULT 170           // ~2/3: P(hata) > 1/3 ise silmek daha ucuz
+#endif
+// Kayıp aralıklar (miss): bayt hiç alınmadı, dosyada dolgu var (udp_dump sıra boşluğu).
+// Güvenilirlikleri 0'dır; ayrıca unpack tarayıcısı bu aralıklara girince sonlarına atlar.
+typedef struct {
+    uint64_t off;                            // konteyner dosyası bayt ofseti
+    uint32_t len;
+    uint8_t  rel;
+    uint8_t  miss;
+} rs_hint_t;
+
+static rs_hint_t *g_hints = NULL;
+// g_hint_maxend[i] = max(off+len) over g_hints[0..i] (sıralı tabloda hints_index_ kurar);
+// farklı kaynaklardan eklenen aralıklar örtüşebildiğinden arama bununla geri yürür
+static uint64_t *g_hint_maxend = NULL;
+static size_t g_hint_n = 0, g_hint_cap = 0;
+static int g_hints_sorted = 1;
+static int g_erase_below = RS_ERASE_BELOW_DEFAULT;
+
+// hints, salvaged slices, columns decoded with hint erasures, columns retried without them
+static uint64_t g_hint_stats[4];
+// missing ranges skipped by the scanner, bytes skipped
+static uint64_t g_gap_stats[2];
+
+DLL_EXPORT void rs_hints_clear(void) {
+    free(g_hints);
+    free(g_hint_maxend);
+    g_hints = NULL;
+    g_hint_maxend = NULL;
+    g_hint_n = g_hint_cap = 0;
+    g_hints_sorted = 1;
+}
+
+static int hints_push_(uint64_t offset, uint32_t len, int reliability, int missing) {
+    if (len == 0) return (int)g_hint_n;
+    if (g_hint_n == g_hint_cap) {
+        size_t cap = g_hint_cap ? g_hint_cap * 2 : 1024;
+        rs_hint_t *p = (rs_hint_t*)realloc(g_hints, cap * sizeof(rs_hint_t));
+        if (!p) return -1;
+        g_hints = p;
+        uint64_t *m = (uint64_t*)realloc(g_hint_maxend, cap * sizeof(uint64_t));
+        if (!m) return -1;
+        g_hint_maxend = m; g_hint_cap = cap;
+    }
+    if (reliability < 0) reliability = 0;
+    if (reliability > 255) reliability = 255;
+    if (g_hint_n && offset < g_hints[g_hint_n-1].off) g_hints_sorted = 0;
+    g_hints[g_hint_n].off = offset;
+    g_hints[g_hint_n].len = len;
+    g_hints[g_hint_n].rel = (uint8_t)reliability;
+    g_hints[g_hint_n].miss = (uint8_t)(missing ? 1 : 0);
+    return (int)++g_hint_n;
+}
+
+DLL_EXPORT int rs_hints_add(uint64_t offset, uint32_t len, int reliability) {
+    return hints_push_(offset, len, reliability, 0);
+}
+
+// Alınmadığı bilinen aralık (güvenilirlik 0 + tarayıcı atlar)
+DLL_EXPORT int rs_hints_add_missing(uint64_t offset, uint32_t len) {
+    return hints_push_(offset, len, 0, 1);
+}
+
+// RSEH yan dosyası (Ofdm_Modem/Include/ofdm_rx.hpp, Udp_Capture/udp_dump.cpp): kayıt
+// ofsetleri alınan bit akışında bayt cinsindendir; kayıt baytı 13 bit0 = kayıp aralık.
+// base_bit: konteynerin ilk bitinin akıştaki konumu, yani get_last_start_flag_pos() +
+// başlangıç bayrağı uzunluğu (bitunwrap).
+static int hints_read_(const char *path, uint64_t base_bit) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+    uint32_t hdr[4];
+    if (fread(hdr, sizeof(hdr), 1, f) != 1 || hdr[0] != 0x48455352u /* 'RSEH' */ || hdr[1] != 1u || hdr[2] < 14u) {
+        fclose(f); return -2;
+    }
+    uint8_t rec[64];
+    const size_t rs = hdr[2] > sizeof(rec) ? sizeof(rec) : hdr[2];
+    int n = (int)g_hint_n;
+    while (fread(rec, 1, rs, f) == rs) {
+        if (hdr[2] > rs) fseek64_(f, (int64_t)(hdr[2] - rs), SEEK_CUR);
+        uint64_t off; uint32_t len;
+        memcpy(&off, rec, 8);
+        memcpy(&len, rec + 8, 4);
+        // [8*off, 8*(off+len)) akış bitleri -> onları kapsayan konteyner baytları
+        uint64_t b0 = off * 8u, b1 = (off + len) * 8u;
+        if (b1 <= base_bit) continue;
+        b0 = (b0 > base_bit) ? b0 - base_bit : 0;
+        b1 -= base_bit;
+        n = hints_push_(b0 / 8u, (uint32_t)((b1 + 7u) / 8u - b0 / 8u), rec[12], rec[13] & 1u);
+        if (n < 0) { fclose(f); rs_hints_clear(); return -3; }
+    }
+    fclose(f);
+    return n;
+}
+
+// Önceki ipuçları silinir. Dönüş: yüklenen kayıt sayısı; <0 hata (-1 açılamadı, -2 biçim, -3 bellek)
+DLL_EXPORT int rs_hints_load(const char *path, uint64_t base_bit) {
+    rs_hints_clear();
+    return hints_read_(path, base_bit);
+}
+
+// Mevcut ipuçlarına ekler (ör. ofdm_rx_file_ex güvenilirlikleri + udp_dump sıra boşlukları).
+// Dönüş: toplam ipucu sayısı; hatalar rs_hints_load ile aynı
+DLL_EXPORT int rs_hints_append(const char *path, uint64_t base_bit) {
+    return hints_read_(path, base_bit);
+}
+
+DLL_EXPORT void rs_set_erasure_threshold(int rel_below) {
+    if (rel_below < 0) rel_below = 0;
+    if (rel_below > 256) rel_below = 256;
+    g_erase_below = rel_below;
+}
+
+DLL_EXPORT void rs_get_hint_stats(uint64_t out[4]) {
+    if (out) memcpy(out, g_hint_stats, sizeof(g_hint_stats));
+}
+
+DLL_EXPORT void rs_get_gap_stats(uint64_t out[2]) {
+    if (out) memcpy(out, g_gap_stats, sizeof(g_gap_stats));
+}
+
+static int hint_cmp_(const void *a, const void *b) {
+    const rs_hint_t *x = (const rs_hint_t*)a, *y = (const rs_hint_t*)b;
+    return (x->off > y->off) - (x->off < y->off);
+}
+
+// Tabloyu ofsete göre sıralar ve önek en büyük bitişi kurar (unpack başında)
+static void hints_index_(void) {
+    if (!g_hints_sorted) {
+        qsort(g_hints, g_hint_n, sizeof(rs_hint_t), hint_cmp_);
+        g_hints_sorted = 1;
+    }
+    uint64_t m = 0;
+    for (size_t i = 0; i < g_hint_n; ++i) {
+        const uint64_t e = g_hints[i].off + g_hints[i].len;
+        if (e > m) m = e;
+        g_hint_maxend[i] = m;
+    }
+}
+
+// pos'u kapsayabilecek ya da pos'tan sonra başlayan ilk ipucu. pos'tan önce başlayanlar
+// örtüşebildiğinden (ör. ofdm güvenilirlikleri + udp_dump boşlukları) önek en büyük bitişi
+// pos'u aşan ilk indekse dönülür; çağıranlar her ipucunu ayrıca kesişim için sınar.
+static size_t hint_first_(uint64_t pos) {
+    size_t lo = 0, hi = g_hint_n;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (g_hints[mid].off < pos) lo = mid + 1; else hi = mid;
+    }
+    size_t k = 0;
+    hi = lo;
+    while (k < hi) {
+        size_t mid = (k + hi) / 2;
+        if (g_hint_maxend[mid] <= pos) k = mid + 1; else hi = mid;
+    }
+    return k;
+}
+static int hint_overlaps_(uint64_t pos, size_t len) {
+    for (size_t h = hint_first_(pos); h < g_hint_n && g_hints[h].off < pos + len; ++h)
+        if (g_hints[h].off + g_hints[h].len > pos) return 1;
+    return 0;
+}
+
+// Okuma konumu kayıp bir aralıktaysa (bitişik kayıplar dahil) sonuna atlar: dolgu
+// find_next_magic ile bayt bayt taranmaz. Aralığa düşen dilimler zaten gelmemiş sayılır
+// ve güvenilirlik haritasında 0 kalarak silme olur.
+static void skip_missing_(FILE *f) {
+    const int64_t p = ftell64_(f);
+    if (p < 0) return;
+    const uint64_t pos = (uint64_t)p;
+    uint64_t end = pos;
+    for (size_t h = hint_first_(pos); h < g_hint_n && g_hints[h].off <= end; ++h)
+        if (g_hints[h].miss && g_hints[h].off + g_hints[h].len > end) end = g_hints[h].off + g_hints[h].len;
+    if (end > pos && fseek64_(f, (int64_t)end, SEEK_SET) == 0) {
+        g_gap_stats[0]++;
+        g_gap_stats[1] += end - pos;
+    }
+}
+
 // -------------------- Stats (decode sonrası) --------------------
 // Not: SER’e ihtiyacın yok dedin; alan dursa da doldurmuyoruz (0).
 typedef struct {
@@ -257,8 +408,58 @@ typedef struct {
     uint32_t     crc32_par;
     size_t       crcD_filled_bytes;
     size_t       crcP_filled_bytes;
+    uint8_t     *rel;         // ipucu güvenilirliği, data|par baytı başına (NULL: ipucu yok)
+    int          hdr_seen;    // crc32_data geçerli (init 2 iken de başlık sonradan gelebilir)
+    uint32_t    *dcrc;        // veri parçası CRC'leri, parça k = [k*S, (k+1)*S) ∩ veri (NULL: yok)
+    uint8_t     *dok;         // dcrc[k] sağlam tek dilimden mi (dcrc ile aynı blokta)
 } frame_buf_t;
 
+// frames verified by combined slice CRCs (RS skipped), frames sent through RS decode
+static uint64_t g_crc_stats[2];
+
+DLL_EXPORT void rs_get_crc_stats(uint64_t out[2]) {
+    if (out) memcpy(out, g_crc_stats, sizeof(g_crc_stats));
+}
+
+// Veri bölgesine düşen dilimin parça kaydı. Parçayı tam kaplayan sağlam dilim CRC'sini
+// bırakır (veri sonunu aşan son dilimde yalnız veri kısmı yeniden hesaplanır); bozuk,
+// kurtarılmış ya da hizasız dilim dokunduğu parçaları geçersiz kılar.
+static void note_data_piece_(frame_buf_t *fb, uint16_t S, uint32_t off, const uint8_t *buf,
+                             size_t size, int ok, uint32_t crc)
+{
+    const size_t n = (FRAME_BYTES + S - 1) / S;
+    const size_t k = off / S;
+    const size_t plen = ((k + 1) * S <= FRAME_BYTES) ? S : FRAME_BYTES - k * S;
+    if (ok && off % S == 0 && (size == plen || (size > plen && k * S + plen == FRAME_BYTES))) {
+        if (!fb->dcrc) {
+            fb->dcrc = (uint32_t*)calloc(n, sizeof(uint32_t) + 1);
+            if (!fb->dcrc) return;
+            fb->dok = (uint8_t*)(fb->dcrc + n);
+        }
+        fb->dcrc[k] = (size == plen) ? crc : ck_crc32(buf, plen);
+        fb->dok[k]  = 1;
+        return;
+    }
+    if (!fb->dcrc) return;
+    const size_t end = ((size_t)off + size < FRAME_BYTES) ? (size_t)off + size : FRAME_BYTES;
+    for (size_t j = k; j * S < end; ++j) fb->dok[j] = 0;
+}
+
+// Tüm parçalar sağlamsa CRC'leri veri okunmadan birleştirilir (op_S / op_last önceden
+// üretilmiş x^(8*len) mod P) ve çerçeve başlığındaki crc32_data ile karşılaştırılır:
+// eşitse veri bozulmamış ve doğru çerçeveye yazılmıştır.
+static int data_crc_verified_(const frame_buf_t *fb, uint16_t S, uint32_t op_S, uint32_t op_last)
+{
+    if (!fb->hdr_seen || !fb->dcrc) return 0;
+    const size_t n = (FRAME_BYTES + S - 1) / S;
+    for (size_t k = 0; k < n; ++k)
+        if (!fb->dok[k]) return 0;
+    uint32_t c = fb->dcrc[0];
+    for (size_t k = 1; k < n; ++k)
+        c = ck_crc32_combine_op(c, fb->dcrc[k], (k + 1 < n) ? op_S : op_last);
+    return c == fb->crc32_data;
+}
+
 static void copy_slice_into_frame(frame_buf_t *fb, int r, uint32_t off, const uint8_t *src, uint16_t len,
                                   size_t *o_data, size_t *o_par, size_t *o_crcD, size_t *o_crcP)
 {
@@ -411,10 +612,8 @@ static int pack_impl(const char *input_path, const char *container_path, int r,
                 return -8;
             }
 
-            for (int j=0;j<K_SHARDS;j++)
-                tab_crcD[gi][j] = crc16_ccitt(buf_data[gi] + (size_t)j*SHARD_LEN, SHARD_LEN);
-            for (int j=0;j<r;j++)
-                tab_crcP[gi][j] = crc16_ccitt(buf_par[gi]  + (size_t)j*SHARD_LEN, SHARD_LEN);
+            ck_crc16_ccitt_blocks(buf_data[gi], K_SHARDS,  SHARD_LEN, tab_crcD[gi]);
+            ck_crc16_ccitt_blocks(buf_par[gi],  (size_t)r, SHARD_LEN, tab_crcP[gi]);
 
             frame_hdr_v4_t fh;
             fh.magic      = FRAME_MAGIC_V4;
@@ -461,11 +660,12 @@ static int pack_impl(const char *input_path, const char *container_path, int r,
                     return -10;
                 }
                 size_t copied = 0;
+                uint32_t sc = 0;   // dilim CRC'si kopyalarken birikir (ayrı tarama yok)
 
                 if (off < FRAME_BYTES) {
                     size_t m = FRAME_BYTES - off;
                     size_t take = (chunk < m) ? chunk : m;
-                    memcpy(ptmp + copied, buf_data[gi] + off, take);
+                    sc = ck_crc32_copy(sc, ptmp + copied, buf_data[gi] + off, take);
                     copied += take;
                 }
                 if (off + copied < FRAME_BYTES + par_bytes && copied < chunk) {
@@ -474,7 +674,7 @@ static int pack_impl(const char *input_path, const char *container_path, int r,
                         size_t soff = (off + copied - base);
                         size_t m = par_bytes - soff;
                         size_t take = ((chunk - copied) < m) ? (chunk - copied) : m;
-                        memcpy(ptmp + copied, buf_par[gi] + soff, take);
+                        sc = ck_crc32_copy(sc, ptmp + copied, buf_par[gi] + soff, take);
                         copied += take;
                     }
                 }
@@ -484,7 +684,7 @@ static int pack_impl(const char *input_path, const char *container_path, int r,
                         size_t soff = (off + copied - base);
                         size_t m = crcD_bytes - soff;
                         size_t take = ((chunk - copied) < m) ? (chunk - copied) : m;
-                        memcpy(ptmp + copied, ((uint8_t*)tab_crcD[gi]) + soff, take);
+                        sc = ck_crc32_copy(sc, ptmp + copied, ((uint8_t*)tab_crcD[gi]) + soff, take);
                         copied += take;
                     }
                 }
@@ -494,12 +694,12 @@ static int pack_impl(const char *input_path, const char *container_path, int r,
                         size_t soff = (off + copied - base);
                         size_t m = crcP_bytes - soff;
                         size_t take = ((chunk - copied) < m) ? (chunk - copied) : m;
-                        memcpy(ptmp + copied, ((uint8_t*)tab_crcP[gi]) + soff, take);
+                        sc = ck_crc32_copy(sc, ptmp + copied, ((uint8_t*)tab_crcP[gi]) + soff, take);
                         copied += take;
                     }
                 }
 
-                sh.crc32_slice = crc32_calc(ptmp, chunk);
+                sh.crc32_slice = sc;
                 if (fwrite(&sh, sizeof(sh), 1, fo) != 1) { free(ptmp);
                     for (uint16_t k=0;k<in_grp;k++){
                         free(buf_data[k]); free(buf_par[k]); free(tab_crcD[k]); free(tab_crcP[k]);
@@ -562,6 +762,11 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
     const int pad_mode = opts ? opts->pad_mode : RS_PAD_MODE;
 
     rs_stats_reset();
+    memset(g_hint_stats, 0, sizeof(g_hint_stats));
+    memset(g_gap_stats, 0, sizeof(g_gap_stats));
+    memset(g_crc_stats, 0, sizeof(g_crc_stats));
+    hints_index_();
+    g_hint_stats[0] = g_hint_n;
 
     FILE *fi = fopen(container_path, "rb");
     if (!fi) return -1;
@@ -587,6 +792,11 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
     const size_t crcP_bytes = (size_t)r * 2u;
     const size_t PAY        = payload_len_bytes(r);
 
+    // Parça CRC birleştirme operatörleri (parça = dilim boyu; son parça veri sonunda kesik)
+    const uint16_t S_pc    = gh.slice_bytes;
+    const uint32_t op_S    = S_pc ? ck_crc32_combine_gen(S_pc) : 0;
+    const uint32_t op_last = S_pc ? ck_crc32_combine_gen(FRAME_BYTES - (size_t)((FRAME_BYTES - 1) / S_pc) * S_pc) : 0;
+
     uint64_t F = gh.frame_count;
     frame_buf_t *tab = (frame_buf_t*)calloc((size_t)F, sizeof(frame_buf_t));
     if (!tab) {
@@ -615,6 +825,7 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
         if (g_cancel) { LOGF("[unpack] cancel\n"); break; }
 
         uint32_t magic=0;
+        if (g_hint_n) skip_missing_(fi);
         if (!find_next_magic(fi, &magic)) break;
 
         if (magic == FRAME_MAGIC_V4) {
@@ -645,6 +856,7 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
             fb->data_len   = fh.data_len;
             fb->crc32_data = fh.crc32_data;
             fb->crc32_par  = fh.crc32_par;
+            fb->hdr_seen   = 1;
         }
         else if (magic == SLICE_MAGIC_V4) {
             slice_hdr_v4_t sh;
@@ -654,14 +866,30 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
 
             uint8_t *buf = (uint8_t*)malloc(size);
             if (!buf) { fseek(fi, size, SEEK_CUR); continue; }
+            const int64_t pos = ftell64_(fi);
             if (fread(buf, 1, size, fi) != size) { free(buf); break; }
 
-            if (crc32_calc(buf, size) != sh.crc32_slice) {
+            // CRC32 yalnız dilim verisini korur: bozuk başlık (offset/size) payload dışına yazmasın
+            if ((size_t)sh.offset + size > PAY) {
                 g_rs_stats.slices_bad++;
                 free(buf);
                 continue;
             }
-            g_rs_stats.slices_ok++;
+
+            // Bozuk dilim: üstüne ipucu düşmüyorsa ya da başlığı tutarsızsa atılır
+            int salvage = 0;
+            if (crc32_calc(buf, size) != sh.crc32_slice) {
+                g_rs_stats.slices_bad++;
+                if (!g_hint_n || pos < 0 || sh.frame_index >= F || (uint64_t)sh.offset >= FRAME_BYTES + par_bytes ||
+                    !hint_overlaps_((uint64_t)pos, size)) {
+                    free(buf);
+                    continue;
+                }
+                salvage = 1;
+                g_hint_stats[1]++;
+            } else {
+                g_rs_stats.slices_ok++;
+            }
 
             if (sh.frame_index < F) {
                 frame_buf_t *fb = &tab[sh.frame_index];
@@ -688,7 +916,33 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
                     fb->init = 2;
                 }
                 size_t a,b,c,d;
-                copy_slice_into_frame(fb, r, sh.offset, buf, sh.size, &a,&b,&c,&d);
+                // İpucu kipinde güvenilirlik haritası 0 (hiç gelmedi) ile başlar, gelen
+                // dilimler 255 yapar: kaybolan dilimler de sütun başına silme olur
+                const size_t dp = FRAME_BYTES + par_bytes;
+                if (g_hint_n && !fb->rel && (fb->rel = (uint8_t*)calloc(1, dp)) == NULL && salvage) {
+                    free(buf);
+                    continue;
+                }
+                if (fb->rel && sh.offset < dp)
+                    memset(fb->rel + sh.offset, 255, ((size_t)sh.offset + size <= dp) ? size : dp - sh.offset);
+                if (S_pc && sh.offset < FRAME_BYTES)
+                    note_data_piece_(fb, S_pc, sh.offset, buf, size, !salvage, sh.crc32_slice);
+                if (!salvage) {
+                    copy_slice_into_frame(fb, r, sh.offset, buf, sh.size, &a,&b,&c,&d);
+                } else {
+                    // CRC16 tablolarına bozuk veri yazılmaz; yalnız data|par kısmı + ipucu baytları
+                    const uint16_t keep = (uint16_t)(((size_t)sh.offset + size <= dp) ? size : dp - sh.offset);
+                    copy_slice_into_frame(fb, r, sh.offset, buf, keep, &a,&b,&c,&d);
+                    for (size_t h = hint_first_((uint64_t)pos); h < g_hint_n && g_hints[h].off < (uint64_t)pos + keep; ++h) {
+                        uint64_t x0 = g_hints[h].off, x1 = x0 + g_hints[h].len;
+                        if (x0 < (uint64_t)pos) x0 = (uint64_t)pos;
+                        if (x1 > (uint64_t)pos + keep) x1 = (uint64_t)pos + keep;
+                        for (uint64_t x = x0; x < x1; ++x) {
+                            uint8_t *q = fb->rel + sh.offset + (size_t)(x - (uint64_t)pos);
+                            if (g_hints[h].rel < *q) *q = g_hints[h].rel;
+                        }
+                    }
+                }
             }
             free(buf);
 
@@ -706,6 +960,8 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
             if (tab[k].par)  free(tab[k].par);
             if (tab[k].crcD) free(tab[k].crcD);
             if (tab[k].crcP) free(tab[k].crcP);
+            if (tab[k].rel)  free(tab[k].rel);
+            if (tab[k].dcrc) free(tab[k].dcrc);
         }
     free_tab_and_files:
         free(tab); fclose(fi); fclose(fo); return -9;
@@ -713,6 +969,8 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
 
     uint64_t written = 0;
     int erasures[K_SHARDS + MAX_R];
+    int eras_hint[K_SHARDS + MAX_R];
+    int eras_col[K_SHARDS + MAX_R];
 
     for (uint64_t idx=0; idx<F; ++idx) {
         if (g_cancel) { LOGF("[unpack] cancel\n"); break; }
@@ -734,8 +992,16 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
             continue;
         }
 
+        // Veri dilimlerinin hepsi sağlam geldiyse RS çözümü ve CRC16 taramaları gereksiz
+        if (S_pc && data_crc_verified_(fb, S_pc, op_S, op_last)) {
+            g_crc_stats[0]++;
+            goto write_frame;
+        }
+        g_crc_stats[1]++;
+
         int eras_data[K_SHARDS]; int nd=0;
         int eras_par[MAX_R];     int np=0;
+        int n_cut = 0;           // son çerçevede veri sonrası shard'lar (eras_data başı)
 
         size_t dlen = fb->data_len; if (dlen > FRAME_BYTES) dlen = FRAME_BYTES;
         if (dlen < FRAME_BYTES) {
@@ -743,6 +1009,7 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
             size_t cutoff2 = full2 + (rem2 ? 1 : 0);
             for (size_t j = cutoff2; j < K_SHARDS; ++j) eras_data[nd++] = (int)j;
             if (rem2) eras_data[nd++] = (int)full2;
+            n_cut = nd;
         }
 
         bool has_crc_tables = (fb->crcD_filled_bytes >= crcD_bytes) && (fb->crcP_filled_bytes >= crcP_bytes);
@@ -761,6 +1028,7 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
         int n_eras = 0;
         for (int i=0; i<nd && n_eras<r; ++i) erasures[n_eras++] = eras_data[i];
         for (int i=0; i<np && n_eras<r; ++i) erasures[n_eras++] = eras_par[i];
+        const int n_eras_frame = n_eras;
 
         for (int i = 0; i < SHARD_LEN; ++i) {
             for (int j = 0; j < K_SHARDS; ++j) {
@@ -770,7 +1038,55 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
             for (int j = 0; j < r; ++j)
                 code[K_SHARDS + j] = fb->par[j * SHARD_LEN + i];
 
-            int ret = decode_rs_char(rs, code, (n_eras ? erasures : NULL), n_eras);
+            // İpucu silmeleri sütun başına: CRC16 tablosu varsa o belirleyicidir, yalnız
+            // bozuk shard'lar r'yi aşınca bu sütunda eşik altı kalanlara daraltılır;
+            // tablo yoksa eşik altı baytlar en güvensizden başlayarak silinir.
+            int *ep = erasures;
+            n_eras = n_eras_frame;
+            if (fb->rel && n_cut < r) {
+                const uint8_t *rel = fb->rel;
+                #define REL_AT(e) rel[((e) < K_SHARDS) ? (size_t)(e) * SHARD_LEN + (size_t)i \
+                                                      : FRAME_BYTES + (size_t)((e) - K_SHARDS) * SHARD_LEN + (size_t)i]
+                int m = n_cut;
+                memcpy(eras_hint, eras_data, (size_t)n_cut * sizeof(int));
+                if (has_crc_tables && nd + np > r) {
+                    for (int k = n_cut; k < nd + np && m < r; ++k) {
+                        int e = (k < nd) ? eras_data[k] : eras_par[k - nd];
+                        if (REL_AT(e) < g_erase_below) eras_hint[m++] = e;
+                    }
+                } else if (!has_crc_tables) {
+                    for (int e = 0; e < K_SHARDS + r; ++e) {
+                        if (e < K_SHARDS && (size_t)(e + 1) * SHARD_LEN > dlen) continue;   // kesik, zaten başta
+                        uint8_t v = REL_AT(e);
+                        if (v >= g_erase_below) continue;
+                        // güvenilirliğe göre artan eklemeli sıralama, r'de kesilir
+                        int at = (m < r) ? m++ : r;
+                        while (at > n_cut && REL_AT(eras_hint[at-1]) > v) {
+                            if (at < r) eras_hint[at] = eras_hint[at-1];
+                            --at;
+                        }
+                        if (at < r) eras_hint[at] = e;
+                    }
+                }
+                #undef REL_AT
+                if (m > n_cut) { ep = eras_hint; n_eras = m; }
+            }
+
+            // decode_rs_char eras_pos'a bulduğu hata konumlarını yazar: sütun başına kopya
+            memcpy(eras_col, ep, (size_t)n_eras * sizeof(int));
+            int ret = decode_rs_char(rs, code, (n_eras ? eras_col : NULL), n_eras);
+            if (ep == eras_hint) {
+                g_hint_stats[2]++;
+                if (ret < 0) {
+                    // İpucu yanıltıcıysa (ör. hatalar güvenli görünen baytlarda) eski yola dön
+                    g_hint_stats[3]++;
+                    for (int j = 0; j < K_SHARDS; ++j) code[j] = fb->data[(size_t)j * SHARD_LEN + (size_t)i];
+                    for (int j = 0; j < r; ++j) code[K_SHARDS + j] = fb->par[j * SHARD_LEN + i];
+                    n_eras = n_eras_frame;
+                    memcpy(eras_col, erasures, (size_t)n_eras * sizeof(int));
+                    ret = decode_rs_char(rs, code, (n_eras ? eras_col : NULL), n_eras);
+                }
+            }
 
             if (n_eras > 0) g_rs_stats.used_erasures_cols++;
             if (ret < 0) {
@@ -812,6 +1128,7 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
             }
         }
 
+    write_frame:;
         size_t to_write = (size_t)((gh.original_size - written) >= FRAME_BYTES ? FRAME_BYTES
                                                                               : (gh.original_size - written));
         if (to_write > 0) {
@@ -825,6 +1142,8 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
                     if (tab[k].par)  free(tab[k].par);
                     if (tab[k].crcD) free(tab[k].crcD);
                     if (tab[k].crcP) free(tab[k].crcP);
+                    if (tab[k].rel)  free(tab[k].rel);
+                    if (tab[k].dcrc) free(tab[k].dcrc);
                 }
                 free(tab); fclose(fi); fclose(fo); return -10;
             }
@@ -842,6 +1161,8 @@ static int rs_unpack_internal(const char *container_path, const char *output_pat
         if (tab[k].par)  free(tab[k].par);
         if (tab[k].crcD) free(tab[k].crcD);
         if (tab[k].crcP) free(tab[k].crcP);
+        if (tab[k].rel)  free(tab[k].rel);
+        if (tab[k].dcrc) free(tab[k].dcrc);
     }
     free(tab);
     fclose(fi); fclose(fo);
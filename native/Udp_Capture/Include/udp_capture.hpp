@@ -0,0 +1,150 @@
+// udp_capture.hpp — yerel UDP alım motoru (udp_dump ve gömülü kullanım için)
+//
+// Yapı: alım thread'i -> önceden ayrılmış paket halkası (SPSC) -> yazıcı thread'i -> sink'ler.
+//  - Linux: recvmmsg ile toplu alım, datagramlar doğrudan halka yuvalarına yazılır
+//    (ara kopya yok). SO_RXQ_OVFL ile çekirdeğin soket tamponu taşmasında attığı
+//    paketler sayılır; SO_RCVBUFFORCE (yetki yoksa SO_RCVBUF) ile büyük tampon.
+//  - Windows: recvfrom döngüsü (toplu alım yok), aynı halka/yazıcı yapısı.
+// Halka doluysa alım thread'i bekler: yığılma çekirdek tamponunda kalır ve taşarsa
+// sock_drops'ta görünür. Sink'ler yalnız yazıcı thread'inden, paket sırasıyla çağrılır
+// (dosya yazımı, akış bitunwrap beslemesi, CRC ...); alım yolunu bloklamazlar.
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace udpcap {
+
+struct CaptureConfig {
+    std::string bind_ip    = "0.0.0.0";
+    uint16_t    port       = 2000;
+    int         rcvbuf_mb  = 32;       // istenen soket alım tamponu
+    int         batch      = 64;       // recvmmsg başına en çok datagram
+    uint32_t    slot_bytes = 2048;     // yuva boyu (>= en büyük datagram; udp_sink 1472)
+    uint32_t    ring_slots = 16384;    // 2'nin kuvvetine yuvarlanır
+    int         timeout_ms = 100;      // alım bekleme (stop() tepki süresi)
+};
+
+struct CaptureStats {
+    uint64_t pkts = 0;             // yazıcıya teslim edilen datagram
+    uint64_t bytes = 0;
+    uint64_t sock_drops = 0;       // çekirdek tamponu taşması (SO_RXQ_OVFL; Windows'ta 0)
+    uint64_t truncated = 0;        // yuvadan büyük datagram (kırpıldı)
+    uint64_t ring_waits = 0;       // halka dolu: alım thread'i bekledi
+    uint64_t batches = 0;          // başarılı recvmmsg çağrısı
+    uint32_t max_batch = 0;
+    uint64_t queue_bytes = 0;      // halkada bekleyen
+    int      rcvbuf_actual = 0;    // çekirdeğin verdiği (Linux'ta istenenin 2 katı görünür)
+};
+
+using Sink = std::function<void(const uint8_t* data, size_t n)>;
+
+// ---- Datagram numaraları (GNU Radio network.udp_sink header_type) ----
+// GrSeq: u64 sıra no (LE) + veri; GrSeqSize: u64 sıra no + i16 uzunluk + veri.
+// udp_sink payloadsize başlığı da kapsar (1472 -> 1464 bayt veri).
+enum class SeqHeader : int { None = 0, GrSeq = 1, GrSeqSize = 2 };
+
+struct SeqGap {
+    uint64_t offset;       // çıktı akışında (ham .bitwrap dosyası) bayt ofseti
+    uint32_t len;          // sıfırla doldurulan bayt
+    uint64_t first_seq;    // kayıp ilk datagram
+    uint32_t pkts;
+};
+
+struct SeqStats {
+    uint64_t gaps = 0;         // doldurulan boşluk
+    uint64_t lost_pkts = 0;
+    uint64_t lost_bytes = 0;
+    uint64_t late = 0;         // en çok max_gap geride no (geç/yinelenen): atılır, yeri zaten dolduruldu
+    uint64_t resyncs = 0;      // max_gap'ten büyük ileri/geri sıçrama (gönderici yeniden başladı):
+                               // doldurulmaz, datagram tutulur ve sayım yeni nodan sürer
+    uint64_t out_bytes = 0;    // çıktı akışı = veri + dolgu
+};
+
+// Datagram başlığını ayırır, sıra boşluklarını bilinen veri boyunda sıfırla doldurur
+// (konteyner hizası korunur) ve her boşluğu bildirir. Yazıcı thread'inde, Sink'lerin
+// önünde çalışır; stats() başka thread'den okunabilir.
+class SeqTracker {
+public:
+    using GapFn = std::function<void(const SeqGap&)>;
+
+    // payload_bytes: datagram başına veri; 0 ise görülen en büyük veri boyu kullanılır
+    SeqTracker(SeqHeader h, uint32_t payload_bytes, uint64_t max_gap_pkts = 65536);
+
+    void push(const uint8_t* p, size_t n, const Sink& out, const GapFn& gap);
+
+    SeqHeader header() const { return hdr_; }
+    size_t header_bytes() const;
+    SeqStats stats() const;
+
+private:
+    SeqHeader hdr_;
+    uint32_t  payload_;
+    bool      learn_;
+    uint64_t  max_gap_;
+    bool      have_ = false;
+    uint64_t  next_ = 0;           // beklenen sıra no
+    std::atomic<uint64_t> gaps_{0}, lost_pkts_{0}, lost_bytes_{0}, late_{0}, resyncs_{0}, out_{0};
+};
+
+class Capture {
+public:
+    Capture() = default;
+    ~Capture();
+    Capture(const Capture&) = delete;
+    Capture& operator=(const Capture&) = delete;
+
+    // Soketi açar/bağlar ve halkayı ayırır; hata metni err'e
+    bool open(const CaptureConfig& cfg, std::string& err);
+    void add_sink(Sink s) { sinks_.push_back(std::move(s)); }   // start()'tan önce
+
+    bool start();
+    // Alımı durdurur, halkadaki paketleri sink'lere boşaltıp thread'leri bitirir
+    void stop();
+    bool running() const { return run_.load(std::memory_order_relaxed); }
+
+    CaptureStats stats() const;
+    const CaptureConfig& config() const { return cfg_; }
+
+private:
+    void rx_loop();
+    void writer_loop();
+    void close_socket();
+
+    CaptureConfig cfg_;
+    std::vector<Sink> sinks_;
+
+    // Halka: yuva i -> data_[i*slot_bytes], len_[i]; head_ alım, tail_ yazıcı
+    std::vector<uint8_t>  data_;
+    std::vector<uint32_t> len_;
+    uint32_t mask_ = 0;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> queued_bytes_{0};
+
+    std::mutex              mu_;
+    std::condition_variable cv_data_, cv_space_;
+
+    std::atomic<bool> run_{false};
+    std::atomic<bool> rx_done_{false};
+    std::thread rx_th_, wr_th_;
+
+#ifdef _WIN32
+    uintptr_t sock_ = ~uintptr_t(0);
+#else
+    int sock_ = -1;
+#endif
+    int rcvbuf_actual_ = 0;
+
+    std::atomic<uint64_t> pkts_{0}, bytes_{0}, sock_drops_{0}, truncated_{0},
+                          ring_waits_{0}, batches_{0};
+    std::atomic<uint32_t> max_batch_{0};
+};
+
+} // namespace udpcap
@@ -0,0 +1,361 @@
+// udp_capture.cpp — bkz. Include/udp_capture.hpp
+#include "Include/udp_capture.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#ifdef _WIN32
+  #include <winsock2.h>
+  #include <ws2tcpip.h>
+#else
+  #include <arpa/inet.h>
+  #include <errno.h>
+  #include <netinet/in.h>
+  #include <sys/socket.h>
+  #include <sys/time.h>
+  #include <unistd.h>
+#endif
+
+namespace udpcap {
+
+Capture::~Capture() {
+    stop();
+    close_socket();
+}
+
+void Capture::close_socket() {
+#ifdef _WIN32
+    if (sock_ != ~uintptr_t(0)) {
+        ::closesocket(static_cast<SOCKET>(sock_));
+        sock_ = ~uintptr_t(0);
+        ::WSACleanup();
+    }
+#else
+    if (sock_ >= 0) { ::close(sock_); sock_ = -1; }
+#endif
+}
+
+bool Capture::open(const CaptureConfig& cfg, std::string& err) {
+    cfg_ = cfg;
+    cfg_.batch = std::clamp(cfg.batch, 1, 1024);
+    cfg_.slot_bytes = std::max<uint32_t>(cfg.slot_bytes, 64);
+    uint32_t cap = 2;
+    while (cap < std::max<uint32_t>(cfg.ring_slots, static_cast<uint32_t>(cfg_.batch) * 2)) cap <<= 1;
+    mask_ = cap - 1;
+    data_.assign(static_cast<size_t>(cap) * cfg_.slot_bytes, 0);   // sayfalar şimdi dokunulur
+    len_.assign(cap, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(cfg_.port);
+    if (::inet_pton(AF_INET, cfg_.bind_ip.c_str(), &addr.sin_addr) != 1) {
+        err = "bad bind ip: " + cfg_.bind_ip;
+        return false;
+    }
+    const int want = std::max(cfg_.rcvbuf_mb, 1) << 20;
+
+#ifdef _WIN32
+    WSADATA wsa;
+    if (::WSAStartup(MAKEWORD(2, 2), &wsa) != 0) { err = "WSAStartup failed"; return false; }
+    SOCKET s = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s == INVALID_SOCKET) { ::WSACleanup(); err = "socket() failed"; return false; }
+    sock_ = static_cast<uintptr_t>(s);
+    ::setsockopt(s, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&want), sizeof(want));
+    const DWORD tmo = static_cast<DWORD>(std::max(cfg_.timeout_ms, 1));
+    ::setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&tmo), sizeof(tmo));
+    if (::bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        close_socket();
+        err = "bind() failed: " + std::to_string(::WSAGetLastError());
+        return false;
+    }
+    int got = 0, gl = sizeof(got);
+    ::getsockopt(s, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char*>(&got), &gl);
+    rcvbuf_actual_ = got;
+#else
+    sock_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock_ < 0) { err = std::string("socket(): ") + std::strerror(errno); return false; }
+    // FORCE net.core.rmem_max sınırını aşar (CAP_NET_ADMIN); yoksa sınıra kırpılır
+  #ifdef SO_RCVBUFFORCE
+    if (::setsockopt(sock_, SOL_SOCKET, SO_RCVBUFFORCE, &want, sizeof(want)) != 0)
+  #endif
+        ::setsockopt(sock_, SOL_SOCKET, SO_RCVBUF, &want, sizeof(want));
+  #ifdef SO_RXQ_OVFL
+    const int one = 1;
+    ::setsockopt(sock_, SOL_SOCKET, SO_RXQ_OVFL, &one, sizeof(one));
+  #endif
+    timeval tv{};
+    tv.tv_sec = cfg_.timeout_ms / 1000;
+    tv.tv_usec = (cfg_.timeout_ms % 1000) * 1000;
+    ::setsockopt(sock_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (::bind(sock_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        err = std::string("bind(): ") + std::strerror(errno);
+        close_socket();
+        return false;
+    }
+    int got = 0;
+    socklen_t gl = sizeof(got);
+    ::getsockopt(sock_, SOL_SOCKET, SO_RCVBUF, &got, &gl);
+    rcvbuf_actual_ = got;
+#endif
+    return true;
+}
+
+bool Capture::start() {
+#ifdef _WIN32
+    if (sock_ == ~uintptr_t(0)) return false;
+#else
+    if (sock_ < 0) return false;
+#endif
+    if (run_.exchange(true)) return true;
+    rx_done_.store(false);
+    wr_th_ = std::thread(&Capture::writer_loop, this);
+    rx_th_ = std::thread(&Capture::rx_loop, this);
+    return true;
+}
+
+void Capture::stop() {
+    if (!run_.exchange(false)) return;
+    { std::lock_guard<std::mutex> lk(mu_); }
+    cv_space_.notify_all();
+    if (rx_th_.joinable()) rx_th_.join();
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        rx_done_.store(true);
+    }
+    cv_data_.notify_all();
+    if (wr_th_.joinable()) wr_th_.join();
+}
+
+CaptureStats Capture::stats() const {
+    CaptureStats s;
+    s.pkts          = pkts_.load(std::memory_order_relaxed);
+    s.bytes         = bytes_.load(std::memory_order_relaxed);
+    s.sock_drops    = sock_drops_.load(std::memory_order_relaxed);
+    s.truncated     = truncated_.load(std::memory_order_relaxed);
+    s.ring_waits    = ring_waits_.load(std::memory_order_relaxed);
+    s.batches       = batches_.load(std::memory_order_relaxed);
+    s.max_batch     = max_batch_.load(std::memory_order_relaxed);
+    s.queue_bytes   = queued_bytes_.load(std::memory_order_relaxed);
+    s.rcvbuf_actual = rcvbuf_actual_;
+    return s;
+}
+
+void Capture::rx_loop() {
+    const uint32_t cap = mask_ + 1;
+    const size_t   sb  = cfg_.slot_bytes;
+    const int      B   = cfg_.batch;
+
+#ifndef _WIN32
+    std::vector<mmsghdr> msgs(B);
+    std::vector<iovec>   iov(B);
+    // Her mesaja SO_RXQ_OVFL cmsg'si için yer (uint32 kümülatif düşen sayısı)
+    const size_t ctl_sz = CMSG_SPACE(sizeof(uint32_t));
+    std::vector<uint8_t> ctl(ctl_sz * B + 8);
+    uint32_t ovfl = 0;             // çekirdeğin soket ömrü boyunca kümülatif sayacı
+#endif
+
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    while (run_.load(std::memory_order_relaxed)) {
+        // Boş yuva sayısı; yoksa yazıcıyı bekle
+        uint64_t tail = tail_.load(std::memory_order_acquire);
+        uint32_t space = cap - static_cast<uint32_t>(head - tail);
+        if (space == 0) {
+            ring_waits_.fetch_add(1, std::memory_order_relaxed);
+            std::unique_lock<std::mutex> lk(mu_);
+            cv_space_.wait_for(lk, std::chrono::milliseconds(10), [&] {
+                return !run_.load(std::memory_order_relaxed) ||
+                       static_cast<uint32_t>(head - tail_.load(std::memory_order_acquire)) < cap;
+            });
+            continue;
+        }
+
+#ifdef _WIN32
+        uint8_t* dst = &data_[(head & mask_) * sb];
+        const int r = ::recvfrom(static_cast<SOCKET>(sock_), reinterpret_cast<char*>(dst),
+                                 static_cast<int>(sb), 0, nullptr, nullptr);
+        if (r < 0) {
+            const int e = ::WSAGetLastError();
+            if (e == WSAEMSGSIZE) {                 // kırpıldı: yuva dolu olarak teslim
+                truncated_.fetch_add(1, std::memory_order_relaxed);
+                len_[head & mask_] = static_cast<uint32_t>(sb);
+            } else {
+                continue;                           // WSAETIMEDOUT vb.
+            }
+        } else {
+            len_[head & mask_] = static_cast<uint32_t>(r);
+        }
+        const int n = 1;
+        queued_bytes_.fetch_add(len_[head & mask_], std::memory_order_relaxed);
+#else
+        const int want = static_cast<int>(std::min<uint32_t>(space, static_cast<uint32_t>(B)));
+        for (int i = 0; i < want; ++i) {
+            iov[i].iov_base = &data_[((head + i) & mask_) * sb];
+            iov[i].iov_len  = sb;
+            std::memset(&msgs[i].msg_hdr, 0, sizeof(msghdr));
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control = &ctl[ctl_sz * i];
+            msgs[i].msg_hdr.msg_controllen = ctl_sz;
+        }
+        // İlk datagramı bekler (SO_RCVTIMEO), ardından kuyrukta olanları beklemeden alır
+        const int n = ::recvmmsg(sock_, msgs.data(), static_cast<unsigned>(want), MSG_WAITFORONE, nullptr);
+        if (n <= 0) continue;                        // EAGAIN (zaman aşımı) / EINTR
+        uint64_t qb = 0;
+        for (int i = 0; i < n; ++i) {
+            uint32_t len = msgs[i].msg_len;
+            if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+                truncated_.fetch_add(1, std::memory_order_relaxed);
+                len = static_cast<uint32_t>(std::min<size_t>(len, sb));
+            }
+            len_[(head + i) & mask_] = len;
+            qb += len;
+  #ifdef SO_RXQ_OVFL
+            for (cmsghdr* c = CMSG_FIRSTHDR(&msgs[i].msg_hdr); c; c = CMSG_NXTHDR(&msgs[i].msg_hdr, c)) {
+                if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_RXQ_OVFL) {
+                    std::memcpy(&ovfl, CMSG_DATA(c), sizeof(ovfl));
+                }
+            }
+  #endif
+        }
+  #ifdef SO_RXQ_OVFL
+        sock_drops_.store(ovfl, std::memory_order_relaxed);
+  #endif
+        queued_bytes_.fetch_add(qb, std::memory_order_relaxed);
+#endif
+        batches_.fetch_add(1, std::memory_order_relaxed);
+        if (static_cast<uint32_t>(n) > max_batch_.load(std::memory_order_relaxed))
+            max_batch_.store(static_cast<uint32_t>(n), std::memory_order_relaxed);
+
+        // Yazıcı boştaysa uyandır (dolu çalışırken kilit alınmaz)
+        const bool was_empty = (head == tail_.load(std::memory_order_acquire));
+        head += static_cast<uint64_t>(n);
+        head_.store(head, std::memory_order_release);
+        if (was_empty) {
+            { std::lock_guard<std::mutex> lk(mu_); }
+            cv_data_.notify_one();
+        }
+    }
+}
+
+void Capture::writer_loop() {
+    const size_t sb = cfg_.slot_bytes;
+    const uint32_t cap = mask_ + 1;
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        if (head == tail) {
+            if (rx_done_.load(std::memory_order_acquire)) {
+                // rx bitti: son bir kez head'e bak
+                if (head_.load(std::memory_order_acquire) == tail) break;
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(mu_);
+            cv_data_.wait_for(lk, std::chrono::milliseconds(20), [&] {
+                return rx_done_.load(std::memory_order_relaxed) ||
+                       head_.load(std::memory_order_acquire) != tail;
+            });
+            continue;
+        }
+        uint64_t pk = 0, by = 0;
+        for (; tail != head; ++tail) {
+            const uint32_t i = static_cast<uint32_t>(tail & mask_);
+            const uint8_t* p = &data_[i * sb];
+            const uint32_t n = len_[i];
+            for (auto& s : sinks_) s(p, n);
+            ++pk; by += n;
+            // Büyük yığında yuvaları erken geri ver (alım thread'i beklemesin)
+            if ((pk & 255u) == 0) {
+                tail_.store(tail + 1, std::memory_order_release);
+                queued_bytes_.fetch_sub(by, std::memory_order_relaxed);
+                pkts_.fetch_add(pk, std::memory_order_relaxed);
+                bytes_.fetch_add(by, std::memory_order_relaxed);
+                pk = by = 0;
+            }
+        }
+        const bool was_full = static_cast<uint32_t>(head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed)) >= cap;
+        tail_.store(tail, std::memory_order_release);
+        queued_bytes_.fetch_sub(by, std::memory_order_relaxed);
+        pkts_.fetch_add(pk, std::memory_order_relaxed);
+        bytes_.fetch_add(by, std::memory_order_relaxed);
+        if (was_full || ring_waits_.load(std::memory_order_relaxed)) {
+            { std::lock_guard<std::mutex> lk(mu_); }
+            cv_space_.notify_one();
+        }
+    }
+}
+
+// -------------------- SeqTracker --------------------
+SeqTracker::SeqTracker(SeqHeader h, uint32_t payload_bytes, uint64_t max_gap_pkts)
+    : hdr_(h), payload_(payload_bytes), learn_(payload_bytes == 0),
+      max_gap_(std::max<uint64_t>(max_gap_pkts, 1)) {}
+
+size_t SeqTracker::header_bytes() const {
+    switch (hdr_) {
+        case SeqHeader::GrSeq:     return 8;
+        case SeqHeader::GrSeqSize: return 10;
+        default:                   return 0;
+    }
+}
+
+SeqStats SeqTracker::stats() const {
+    SeqStats s;
+    s.gaps       = gaps_.load(std::memory_order_relaxed);
+    s.lost_pkts  = lost_pkts_.load(std::memory_order_relaxed);
+    s.lost_bytes = lost_bytes_.load(std::memory_order_relaxed);
+    s.late       = late_.load(std::memory_order_relaxed);
+    s.resyncs    = resyncs_.load(std::memory_order_relaxed);
+    s.out_bytes  = out_.load(std::memory_order_relaxed);
+    return s;
+}
+
+void SeqTracker::push(const uint8_t* p, size_t n, const Sink& out, const GapFn& gap) {
+    const size_t hb = header_bytes();
+    if (hb == 0) {
+        out(p, n);
+        out_.fetch_add(n, std::memory_order_relaxed);
+        return;
+    }
+    if (n < hb) return;                                 // send_eof (boş datagram) / bozuk
+    uint64_t seq = 0;
+    for (int i = 7; i >= 0; --i) seq = (seq << 8) | p[i];
+    const uint8_t* d = p + hb;
+    const size_t   dn = n - hb;
+
+    if (have_ && seq != next_) {
+        const uint32_t pl = payload_ ? payload_ : static_cast<uint32_t>(dn);
+        if (seq < next_ && next_ - seq <= max_gap_) {   // geç ya da yinelenen
+            late_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const uint64_t miss = seq - next_;              // geri sıçramada anlamsız (büyük)
+        if (seq < next_ || miss > max_gap_ || pl == 0) {
+            // Gönderici yeniden başladı (no geri ya da çok ileri sıçradı): doldurulmaz, veri tutulur
+            resyncs_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            // Kayıp datagramlar tam boyludur (udp_sink yalnız sonuncuyu kısa gönderir)
+            const uint64_t fill = miss * pl;
+            SeqGap g{out_.load(std::memory_order_relaxed), static_cast<uint32_t>(std::min<uint64_t>(fill, UINT32_MAX)),
+                     next_, static_cast<uint32_t>(miss)};
+            static const uint8_t zeros[64 << 10] = {};
+            for (uint64_t left = fill; left; ) {
+                const size_t k = static_cast<size_t>(std::min<uint64_t>(left, sizeof(zeros)));
+                out(zeros, k);
+                left -= k;
+            }
+            out_.fetch_add(fill, std::memory_order_relaxed);
+            gaps_.fetch_add(1, std::memory_order_relaxed);
+            lost_pkts_.fetch_add(miss, std::memory_order_relaxed);
+            lost_bytes_.fetch_add(fill, std::memory_order_relaxed);
+            if (gap) gap(g);
+        }
+    }
+    have_ = true;
+    next_ = seq + 1;
+    // Boy verilmediyse en büyük veri boyu öğrenilir (ilk datagram normalde tam boyludur)
+    if (learn_ && dn > payload_) payload_ = static_cast<uint32_t>(dn);
+    out(d, dn);
+    out_.fetch_add(dn, std::memory_order_relaxed);
+}
+
+} // namespace udpcap
@@ -0,0 +1,282 @@
+// udp_dump.cpp — scripts/udp_dump+.exe'nin kaynaklı, yerel yerine geçeni
+// (scripts/udp_dump.exe olarak kurulursa rx_controller bunu --seq gr ile kullanır)
+//
+// Komut satırı ve stdout biçimi services/udp_runner.py ile uyumludur:
+//   udp_dump [seçenekler] <bind_ip> <port> <out_file>
+//   "Listening UDP ip:port" satırı, ardından \r ile biten durum satırları:
+//   pkts=N bytes=N (X MB) rate=X Mb/s queue=X MB drops=N pps=N ovf=N trunc=N
+// drops = ovf (çekirdek tamponu taşması) + trunc (yuvaya sığmayan datagram).
+//
+// Ek olarak alım sırasında akış bitunwrap'a beslenebilir (--unwrap): bayraklar arası
+// yük, RX sonrası ayrı bir unwrap_file_bits geçişine gerek kalmadan doğrudan konteyner
+// dosyasına yazılır. --no-raw ile ham .bitwrap dökümü atlanır.
+//
+// Datagram numaraları (--seq gr, udp_sink header_type=1): başlık ayrılır, kayıp
+// datagramlar bilinen veri boyunda sıfırla doldurulur (konteyner hizası kaymaz) ve
+// her boşluk RSEH yan dosyasına (--hints, varsayılan <out_file>.rseh) güvenilirlik 0
+// olarak yazılır. Ofsetler çıktı akışı baytıdır (ofdm_rx_file_ex RSEH'i ile aynı
+// düzen); rs_hints_load(path, start_flag_pos + bayrak uzunluğu) bunları konteyner
+// ofsetlerine çevirir ve RS unpack kayıp dilimleri doğrudan silme sayar.
+//
+// Build (Linux):  g++ -O2 -std=c++17 -pthread -o udp_dump udp_dump.cpp udp_capture.cpp ../Bitwrap/bitunwrap.cpp ../Checksum/checksum.c
+// Build (MinGW):  g++ -O2 -std=c++17 -o udp_dump.exe udp_dump.cpp udp_capture.cpp ../Bitwrap/bitunwrap.cpp ../Checksum/checksum.c -lws2_32
+
+#include "Include/udp_capture.hpp"
+#include "../Bitwrap/Include/bitunwrap.hpp"
+#include "../Checksum/Include/checksum.h"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+// services/bitunwrap.py FIXED_DE_BRUIJN_SEQ (başlangıç); bitiş bayrağı tersidir
+static const char* kDefaultStartFlag =
+    "0000000100100111011100011000110101101100011110001111111001011010"
+    "011011001010001011000101010010111111110101001110011101110000001";
+
+static std::atomic<bool> g_stop{false};
+static void on_signal(int) { g_stop.store(true); }
+
+struct Options {
+    udpcap::CaptureConfig cap;
+    std::string out_path;
+    std::string unwrap_path;
+    std::string start_flag = kDefaultStartFlag;
+    std::string end_flag;                 // boş: start_flag'in tersi
+    std::string hints_path;               // boş: seq açıkken <out_file>.rseh
+    udpcap::SeqHeader seq = udpcap::SeqHeader::None;
+    uint32_t seq_payload = 0;             // 0: ilk datagramdan öğren
+    uint64_t max_gap = 65536;             // datagram; fazlası yeniden başlama sayılır
+    bool raw = true;
+    bool stop_on_end = false;
+    int  stats_ms = 500;
+};
+
+static void usage() {
+    std::fprintf(stderr,
+        "usage: udp_dump [options] <bind_ip> <port> <out_file>\n"
+        "  --rcvbuf MB        socket receive buffer (default 32)\n"
+        "  --batch N          datagrams per recvmmsg (default 64)\n"
+        "  --ring N           packet ring slots (default 16384)\n"
+        "  --slot BYTES       ring slot size (default 2048)\n"
+        "  --stats-ms MS      status line period (default 500)\n"
+        "  --unwrap PATH      stream-unwrap payload between flags into PATH\n"
+        "  --start-flag BITS  start flag bitstring (default: 127-bit De Bruijn)\n"
+        "  --end-flag BITS    end flag bitstring (default: reversed start flag)\n"
+        "  --stop-on-end      exit once the end flag has been unwrapped\n"
+        "  --seq MODE         datagram header: none | gr (udp_sink header_type 1) | gr-size (2)\n"
+        "  --seq-payload N    data bytes per datagram after the header (default: learn)\n"
+        "  --max-gap N        larger jumps, forward or back, are resyncs (default 65536)\n"
+        "  --hints PATH       RSEH sidecar for sequence gaps (default <out_file>.rseh)\n"
+        "  --no-raw           do not write the raw datagram stream to <out_file>\n");
+}
+
+static bool parse_args(int argc, char** argv, Options& o) {
+    int pos = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        auto next = [&](const char* what) -> const char* {
+            if (i + 1 >= argc) { std::fprintf(stderr, "[ERR] %s needs a value\n", what); std::exit(2); }
+            return argv[++i];
+        };
+        if      (a == "--rcvbuf")     o.cap.rcvbuf_mb  = std::atoi(next("--rcvbuf"));
+        else if (a == "--batch")      o.cap.batch      = std::atoi(next("--batch"));
+        else if (a == "--ring")       o.cap.ring_slots = static_cast<uint32_t>(std::strtoul(next("--ring"), nullptr, 10));
+        else if (a == "--slot")       o.cap.slot_bytes = static_cast<uint32_t>(std::strtoul(next("--slot"), nullptr, 10));
+        else if (a == "--stats-ms")   o.stats_ms       = std::max(50, std::atoi(next("--stats-ms")));
+        else if (a == "--unwrap")     o.unwrap_path    = next("--unwrap");
+        else if (a == "--start-flag") o.start_flag     = next("--start-flag");
+        else if (a == "--end-flag")   o.end_flag       = next("--end-flag");
+        else if (a == "--stop-on-end") o.stop_on_end   = true;
+        else if (a == "--no-raw")     o.raw            = false;
+        else if (a == "--seq-payload") o.seq_payload   = static_cast<uint32_t>(std::strtoul(next("--seq-payload"), nullptr, 10));
+        else if (a == "--max-gap")    o.max_gap        = std::strtoull(next("--max-gap"), nullptr, 10);
+        else if (a == "--hints")      o.hints_path     = next("--hints");
+        else if (a == "--seq") {
+            const std::string m = next("--seq");
+            if      (m == "none" || m == "0")    o.seq = udpcap::SeqHeader::None;
+            else if (m == "gr" || m == "1")      o.seq = udpcap::SeqHeader::GrSeq;
+            else if (m == "gr-size" || m == "2") o.seq = udpcap::SeqHeader::GrSeqSize;
+            else { std::fprintf(stderr, "[ERR] bad --seq mode %s\n", m.c_str()); return false; }
+        }
+        else if (a == "-h" || a == "--help") { usage(); std::exit(0); }
+        else if (!a.empty() && a[0] == '-' && a.size() > 1) { std::fprintf(stderr, "[ERR] unknown option %s\n", a.c_str()); return false; }
+        else {
+            if (pos == 0) o.cap.bind_ip = a;
+            else if (pos == 1) o.cap.port = static_cast<uint16_t>(std::atoi(a.c_str()));
+            else if (pos == 2) o.out_path = a;
+            else return false;
+            ++pos;
+        }
+    }
+    if (o.end_flag.empty()) o.end_flag.assign(o.start_flag.rbegin(), o.start_flag.rend());
+    if (o.hints_path.empty() && o.seq != udpcap::SeqHeader::None) o.hints_path = o.out_path + ".rseh";
+    return pos == 3 && (o.raw || !o.unwrap_path.empty());
+}
+
+struct UnwrapOut {
+    std::FILE* f = nullptr;
+};
+static void unwrap_sink(void* user, const std::uint8_t* data, std::size_t n) {
+    std::fwrite(data, 1, n, static_cast<UnwrapOut*>(user)->f);
+}
+
+// RSEH (Ofdm_Modem/Include/ofdm_rx.hpp): başlık {'RSEH', 1, 16, 0}, kayıt
+// {u64 ofset, u32 uzunluk, u8 güvenilirlik, u8 bayrak (bit0: kayıp), u16 0}
+static std::FILE* rseh_open(const std::string& path) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return nullptr;
+    const uint32_t hdr[4] = {0x48455352u, 1u, 16u, 0u};
+    std::fwrite(hdr, sizeof(hdr), 1, f);
+    std::fflush(f);
+    return f;
+}
+static void rseh_add(std::FILE* f, uint64_t off, uint32_t len, uint8_t rel, bool missing) {
+    uint8_t rec[16] = {};
+    std::memcpy(rec, &off, 8);
+    std::memcpy(rec + 8, &len, 4);
+    rec[12] = rel;
+    rec[13] = missing ? 1 : 0;
+    std::fwrite(rec, sizeof(rec), 1, f);
+    std::fflush(f);                       // boşluklar seyrek; süreç öldürülse de kayıt kalır
+}
+
+int main(int argc, char** argv) {
+    Options o;
+    if (!parse_args(argc, argv, o)) { usage(); return 2; }
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+#ifdef SIGBREAK
+    std::signal(SIGBREAK, on_signal);       // udp_runner CTRL_BREAK ile durdurur
+#endif
+
+    udpcap::Capture cap;
+    std::string err;
+    if (!cap.open(o.cap, err)) {
+        std::fprintf(stderr, "[ERR] %s\n", err.c_str());
+        return 1;
+    }
+
+    std::FILE* raw = nullptr;
+    if (o.raw) {
+        raw = std::fopen(o.out_path.c_str(), "wb");
+        if (!raw) { std::fprintf(stderr, "[ERR] cannot open %s\n", o.out_path.c_str()); return 1; }
+        std::setvbuf(raw, nullptr, _IOFBF, 4u << 20);
+    }
+    UnwrapOut uo;
+    bitunwrap_stream* us = nullptr;
+    std::atomic<int> ustate{0};
+    if (!o.unwrap_path.empty()) {
+        uo.f = std::fopen(o.unwrap_path.c_str(), "wb");
+        if (!uo.f) { std::fprintf(stderr, "[ERR] cannot open %s\n", o.unwrap_path.c_str()); return 1; }
+        std::setvbuf(uo.f, nullptr, _IOFBF, 1u << 20);
+        us = unwrap_stream_create(o.start_flag.c_str(), o.end_flag.c_str(), unwrap_sink, &uo);
+        if (!us) { std::fprintf(stderr, "[ERR] bad flag bitstring\n"); return 1; }
+    }
+
+    // Çıktı akışı (başlıksız veri + boşluk dolgusu): CRC, ham döküm, akış unwrap
+    uint32_t crc = 0;
+    const udpcap::Sink deliver = [&](const uint8_t* p, size_t n) {
+        crc = ck_crc32_update(crc, p, n);
+        if (raw) std::fwrite(p, 1, n, raw);
+        if (us && ustate.load(std::memory_order_relaxed) != 2)
+            ustate.store(unwrap_stream_feed(us, p, n), std::memory_order_relaxed);
+    };
+
+    udpcap::SeqTracker seq(o.seq, o.seq_payload, o.max_gap);
+    std::FILE* hints = nullptr;
+    if (o.seq == udpcap::SeqHeader::None) {
+        cap.add_sink(deliver);
+    } else {
+        hints = rseh_open(o.hints_path);
+        if (!hints) { std::fprintf(stderr, "[ERR] cannot open %s\n", o.hints_path.c_str()); return 1; }
+        const udpcap::SeqTracker::GapFn on_gap = [&](const udpcap::SeqGap& g) {
+            rseh_add(hints, g.offset, g.len, 0, true);
+        };
+        cap.add_sink([&, on_gap](const uint8_t* p, size_t n) { seq.push(p, n, deliver, on_gap); });
+    }
+
+    const udpcap::CaptureStats s0 = cap.stats();
+    std::printf("Listening UDP %s:%u rcvbuf=%d ring=%u batch=%d\n", o.cap.bind_ip.c_str(),
+                static_cast<unsigned>(o.cap.port), s0.rcvbuf_actual, o.cap.ring_slots, o.cap.batch);
+    std::fflush(stdout);
+    cap.start();
+
+    using clk = std::chrono::steady_clock;
+    const auto t_begin = clk::now();
+    auto t_prev = t_begin;
+    uint64_t prev_bytes = 0, prev_pkts = 0;
+    int last_ustate = 0;
+    while (!g_stop.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(o.stats_ms));
+        const auto t = clk::now();
+        const double dt = std::chrono::duration<double>(t - t_prev).count();
+        t_prev = t;
+        const udpcap::CaptureStats s = cap.stats();
+        const double mbps = dt > 0 ? (s.bytes - prev_bytes) * 8.0 / 1e6 / dt : 0.0;
+        const double pps  = dt > 0 ? (s.pkts - prev_pkts) / dt : 0.0;
+        prev_bytes = s.bytes; prev_pkts = s.pkts;
+        // Sıra no varken drops = sıra boşluklarındaki datagramlar (ovf dahil, yukarı akış kaybı da)
+        const udpcap::SeqStats q = seq.stats();
+        const uint64_t drops = o.seq != udpcap::SeqHeader::None ? q.lost_pkts : s.sock_drops + s.truncated;
+        std::printf("\rpkts=%llu bytes=%llu (%.2f MB) rate=%.2f Mb/s queue=%.2f MB drops=%llu pps=%.0f ovf=%llu trunc=%llu",
+                    static_cast<unsigned long long>(s.pkts), static_cast<unsigned long long>(s.bytes),
+                    s.bytes / 1048576.0, mbps, s.queue_bytes / 1048576.0,
+                    static_cast<unsigned long long>(drops), pps,
+                    static_cast<unsigned long long>(s.sock_drops), static_cast<unsigned long long>(s.truncated));
+        if (o.seq != udpcap::SeqHeader::None)
+            std::printf(" gaps=%llu late=%llu", static_cast<unsigned long long>(q.gaps),
+                        static_cast<unsigned long long>(q.late));
+        std::printf("   ");
+        std::fflush(stdout);
+
+        const int u = ustate.load(std::memory_order_relaxed);
+        if (u != last_ustate) {
+            last_ustate = u;
+            if (u == 1) std::printf("\n[unwrap] start flag at bit %llu\n",
+                                    static_cast<unsigned long long>(unwrap_stream_start_pos(us)));
+            if (u == 2) std::printf("\n[unwrap] end flag at bit %llu\n",
+                                    static_cast<unsigned long long>(unwrap_stream_end_pos(us)));
+            std::fflush(stdout);
+            if (u == 2 && o.stop_on_end) break;
+        }
+    }
+    cap.stop();
+
+    const udpcap::CaptureStats s = cap.stats();
+    const double el = std::chrono::duration<double>(clk::now() - t_begin).count();
+    std::printf("\n[done] pkts=%llu bytes=%llu avg=%.2f Mb/s ovf=%llu trunc=%llu ring_waits=%llu max_batch=%u crc32=%08x\n",
+                static_cast<unsigned long long>(s.pkts), static_cast<unsigned long long>(s.bytes),
+                el > 0 ? s.bytes * 8.0 / 1e6 / el : 0.0,
+                static_cast<unsigned long long>(s.sock_drops), static_cast<unsigned long long>(s.truncated),
+                static_cast<unsigned long long>(s.ring_waits), s.max_batch, crc);
+    if (o.seq != udpcap::SeqHeader::None) {
+        const udpcap::SeqStats q = seq.stats();
+        std::printf("[seq] gaps=%llu lost_pkts=%llu lost_bytes=%llu late=%llu resyncs=%llu hints=%s\n",
+                    static_cast<unsigned long long>(q.gaps), static_cast<unsigned long long>(q.lost_pkts),
+                    static_cast<unsigned long long>(q.lost_bytes), static_cast<unsigned long long>(q.late),
+                    static_cast<unsigned long long>(q.resyncs), o.hints_path.c_str());
+        std::fclose(hints);
+    }
+    int rc = 0;
+    if (raw) std::fclose(raw);
+    if (us) {
+        const int fr = unwrap_stream_finish(us);
+        std::printf("[unwrap] %s start=%llu end=%llu out=%llu bytes\n",
+                    fr == 0 ? "complete" : "end flag not found",
+                    static_cast<unsigned long long>(unwrap_stream_start_pos(us)),
+                    static_cast<unsigned long long>(unwrap_stream_end_pos(us)),
+                    static_cast<unsigned long long>(unwrap_stream_bytes_out(us)));
+        unwrap_stream_destroy(us);
+        std::fclose(uo.f);
+        if (fr != 0) rc = 3;
+    }
+    std::fflush(stdout);
+    return rc;
+}
@@ -7,10 +7,10 @@ Temiz stop: UDP 'STOP' -> terminate (grace) -> (Windows) taskkill /T /F -> kill
 - Varsayılan: create_new_process_group=False, new_console=False (GUI log için PIPE).
 """
 
-import os, re, socket, time, threading, subprocess, locale
+import os, re, json, socket, time, threading, subprocess, locale
 from dataclasses import dataclass, field
 from pathlib import Path
-from typing import Optional, List
+from typing import Optional, List, Dict, Any
 from PyQt5.QtCore import QObject, pyqtSignal
 
 IS_WIN = (os.name == 'nt')
@@ -252,6 +252,31 @@ class JammerDetectionRunner(QObject):
         self._closing = False
         self.stopped.emit(exit_code, reason)
 
+    # --- control / metrics ---
+    def send_control(self, cmd: str, timeout_s: float = 0.3) -> Optional[str]:
+        """UDP 25000'e komut gönderir (THRESHOLD -45, RETUNE 2.41e9, GAIN 20 ...); cevabı döner."""
+        if not self.is_running():
+            return None
+        try:
+            s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+            s.settimeout(timeout_s)
+            s.sendto(cmd.encode("ascii"), ("127.0.0.1", 25000))
+            data, _ = s.recvfrom(8192)
+            s.close()
+            return data.decode("utf-8", errors="replace")
+        except Exception:
+            return None
+
+    def query_stats(self, reset: bool = False, timeout_s: float = 0.3) -> Optional[Dict[str, Any]]:
+        """UDP 25000'e 'STATS' gönderir; aşama gecikme histogram özetini (JSON) döner."""
+        reply = self.send_control("STATS RESET" if reset else "STATS", timeout_s)
+        if reply is None:
+            return None
+        try:
+            return json.loads(reply)
+        except Exception:
+            return None
+
     # --- stdout parse ---
     def _stdout_loop(self):
         assert self._proc and self._proc.stdout
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+scripts/ofdm_golden_tx.py
+
+ofdmtransmitter.py ile aynı GNU Radio TX zincirini Pluto/Qt olmadan çalıştırır ve
+baseband'i cf32 (interleaved float I/Q) dosyasına yazar. Native modülatörün
+(native/Ofdm_Modem) altın vektörü budur:
+
+    python ofdm_golden_tx.py --input file.bin --out tx_gr.cf32 --mod qpsk
+    ofdm_tx_bench --input file.bin --golden tx_gr.cf32 --mod qpsk
+
+Zincir: file_source -> stream_to_tagged_stream -> crc32_bb -> repack/headergen
+-> chunks_to_symbols -> tagged_stream_mux -> carrier_allocator -> fft(64) -> CP -> amp
+"""
+
+import argparse
+import sys
+
+from gnuradio import gr, blocks, digital, fft
+
+# Çerçeve düzeni ofdmtransmitter.py ile aynı (biri değişirse diğeri de güncellenmeli)
+OCCUPIED = (
+    list(range(-26, -21)) + list(range(-20, -7)) + list(range(-6, 0)) +
+    list(range(1, 7)) + list(range(8, 21)) + list(range(22, 27)),
+)
+PILOTS      = ((-21, -7, 7, 21),)
+PILOT_SYMS  = ((1, 1, 1, -1),)
+SYNC_WORD1 = [0.,0.,0.,0.,0.,0.,0.,1.41421356,0.,-1.41421356,0.,1.41421356,0.,-1.41421356,0.,-1.41421356,0.,-1.41421356,0.,1.41421356,0.,-1.41421356,0.,1.41421356,0.,-1.41421356,0.,-1.41421356,0.,-1.41421356,0.,-1.41421356,0.,1.41421356,0.,-1.41421356,0.,1.41421356,0.,1.41421356,0.,1.41421356,0.,-1.41421356,0.,1.41421356,0.,1.41421356,0.,1.41421356,0.,-1.41421356,0.,1.41421356,0.,1.41421356,0.,1.41421356,0.,0.,0.,0.,0.,0.]
+SYNC_WORD2 = [0,0,0,0,0,0,-1,-1,-1,-1,1,1,-1,-1,-1,1,-1,1,1,1,1,1,-1,-1,-1,-1,-1,1,-1,-1,1,-1,0,1,-1,1,1,1,-1,1,1,1,-1,1,1,1,1,-1,1,-1,-1,-1,1,-1,1,-1,-1,-1,-1,0,0,0,0,0]
+
+
+class golden_tx(gr.top_block):
+    def __init__(self, input_path, out_path, modulation="qpsk", packet_len=512, rolloff=0, amp=0.03):
+        gr.top_block.__init__(self, "OFDM TX golden vector")
+        fft_len = 64
+        tag = "packet_len"
+        m = modulation.lower()
+        if m in ("bpsk", "b"):
+            payload_mod = digital.constellation_bpsk()
+        elif m in ("qpsk", "q"):
+            payload_mod = digital.constellation_qpsk()
+        else:
+            payload_mod = digital.constellation_16qam()
+        header_mod = digital.constellation_bpsk()
+
+        fmt = digital.packet_header_ofdm(
+            OCCUPIED, n_syms=1, len_tag_key=tag, frame_len_tag_key=tag,
+            bits_per_header_sym=header_mod.bits_per_symbol(),
+            bits_per_payload_sym=payload_mod.bits_per_symbol(),
+            scramble_header=False,
+        )
+        cp_samp = rolloff if rolloff > 0 else fft_len // 4
+
+        src    = blocks.file_source(gr.sizeof_char, input_path, False, 0, 0)
+        t2t    = blocks.stream_to_tagged_stream(gr.sizeof_char, 1, packet_len, tag)
+        crc    = digital.crc32_bb(False, tag, False)
+        repack = blocks.repack_bits_bb(8, payload_mod.bits_per_symbol(), tag, False, gr.GR_LSB_FIRST)
+        hdrgen = digital.packet_headergenerator_bb(fmt.base(), tag)
+        map_h  = digital.chunks_to_symbols_bc(header_mod.points(), 1)
+        map_p  = digital.chunks_to_symbols_bc(payload_mod.points(), 1)
+        mux    = blocks.tagged_stream_mux(gr.sizeof_gr_complex, tag, 0)
+        alloc  = digital.ofdm_carrier_allocator_cvc(
+            fft_len, OCCUPIED, PILOTS, PILOT_SYMS, (SYNC_WORD1, SYNC_WORD2), tag, True)
+        ifft   = fft.fft_vcc(fft_len, False, (), True, 1)
+        cp     = digital.ofdm_cyclic_prefixer(fft_len, fft_len + max(1, cp_samp), 0, tag)
+        mul    = blocks.multiply_const_cc(amp)
+        gate   = blocks.tag_gate(gr.sizeof_gr_complex, False)
+        sink   = blocks.file_sink(gr.sizeof_gr_complex, out_path, False)
+        sink.set_unbuffered(False)
+
+        self.connect(src, t2t, crc)
+        self.connect(crc, repack, map_p, (mux, 1))
+        self.connect(crc, hdrgen, map_h, (mux, 0))
+        self.connect(mux, alloc, ifft, cp, mul, gate, sink)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="GNU Radio OFDM TX golden vector (cf32)")
+    ap.add_argument("--input", required=True)
+    ap.add_argument("--out", required=True)
+    ap.add_argument("--mod", default="qpsk", choices=["bpsk", "qpsk", "16qam"])
+    ap.add_argument("--packet-len", type=int, default=512)
+    ap.add_argument("--rolloff", type=int, default=0, help="CP samples (0 => fft_len//4)")
+    ap.add_argument("--amp", type=float, default=0.03)
+    a = ap.parse_args()
+
+    tb = golden_tx(a.input, a.out, a.mod, a.packet_len, a.rolloff, a.amp)
+    tb.run()
+    print(f"[GOLDEN] wrote {a.out}", flush=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -30,6 +30,7 @@ class Reciever(gr.top_block, Qt.QWidget):
         gain_mode="slow_attack",   # slow_attack | fast_attack | manual
         rx_gain_db=64.0,           # manual için
         modulation="qpsk",         # ← YENİ: payload modülasyonu (bpsk/qpsk/qam16/qam64)
+        udp_header=0,              # udp_sink header_type: 0 yok, 1 u64 sıra no (native udp_dump --seq gr)
     ):
         gr.top_block.__init__(self, "Reciever", catch_exceptions=True)
         Qt.QWidget.__init__(self)
@@ -71,6 +72,7 @@ class Reciever(gr.top_block, Qt.QWidget):
         self._gain_mode  = str(gain_mode).strip().lower()
         self._rx_gain_db = float(rx_gain_db)
         self._mod_name   = str(modulation).strip().lower()   # ← YENİ
+        self._udp_header = int(udp_header)
 
         # -----------------------------
         # PHY değişkenleri (dokunulmadı, sadece payload_mod seçimi eklendi)
@@ -122,8 +124,9 @@ class Reciever(gr.top_block, Qt.QWidget):
         # -----------------------------
         # BLOKLER
         # -----------------------------
-        # UDP çıkışı (değiştirme: network.udp_sink)
-        self.network_udp_sink_0 = network.udp_sink(gr.sizeof_char, 1, '127.0.0.1', 2000, 0, 1472, False)
+        # UDP çıkışı (değiştirme: network.udp_sink). header_type=1: her datagram u64 sıra no
+        # taşır (payload 1472 başlığı kapsar); alıcı boşlukları sıfırla doldurup RS'e silme bildirir.
+        self.network_udp_sink_0 = network.udp_sink(gr.sizeof_char, 1, '127.0.0.1', 2000, self._udp_header, 1472, False)
 
         # Pluto RX (buffer_size parametreli)
         self.iio_pluto_source_0 = iio.fmcomms2_source_fc32('' if '' else iio.get_pluto_uri(), [True, True], self.buffer_size)
@@ -284,6 +287,8 @@ def argument_parser():
                     choices=["bpsk", "qpsk", "qam16", "qam64"],
                     default="qpsk",
                     help="Payload modulation (header always BPSK)")
+    ap.add_argument("--udp-seq", dest="udp_seq", action="store_true",
+                    help="Prefix UDP datagrams with a u64 sequence number (udp_sink header_type 1)")
     return ap
 
 def main(top_block_cls=Reciever, options=None):
@@ -293,6 +298,7 @@ def main(top_block_cls=Reciever, options=None):
     qapp = Qt.QApplication(sys.argv)
     tb = top_block_cls(
         modulation=options.mod,   # ← YENİ: CLI’dan gelen mod burada uygulanır
+        udp_header=1 if options.udp_seq else 0,
     )
     tb.start(); tb.show()
 
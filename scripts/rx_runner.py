@@ -38,6 +38,8 @@ def parse_args():
     ap.add_argument("--mod", type=str, default="qpsk",
                     choices=["bpsk", "qpsk", "qam16", "qam64"],
                     help="Payload modulation (header=BPSK)")
+    ap.add_argument("--udp-seq", action="store_true",
+                    help="Sequence-numbered UDP datagrams (needs the native udp_dump --seq gr)")
     return ap.parse_args()
 
 
@@ -123,6 +125,7 @@ def main():
             gain_mode=args.gain_mode,
             rx_gain_db=args.gain_db,
             modulation=args.mod,
+            udp_header=1 if args.udp_seq else 0,
         )
         tb.start()
         print("[RX] GNURadio started", flush=True)
@@ -5,7 +5,8 @@ services/udp_runner.py
 UDP dump runner for Windows (portable):
 
 - Runs '<scripts>/udp_dump+.exe' resolved via paths.dir_scripts(), fallback to repo layout.
-- Args: <bind_ip> <port> <out_file>   e.g. 0.0.0.0 2000 out.bitwrap
+- Args: [extra_args] <bind_ip> <port> <out_file>   e.g. 0.0.0.0 2000 out.bitwrap
+  (extra_args: native udp_dump options such as --seq gr; the prebuilt exe takes none)
 - Reads stdout in raw bytes; treats both '\\n' and '\\r' as "line" terminators (our exe uses \\r).
 - Emits:
     started(pid:int)
@@ -35,8 +36,8 @@ import time
 import threading
 import subprocess
 import locale
-from dataclasses import dataclass
-from typing import Optional, Dict
+from dataclasses import dataclass, field
+from typing import Optional, Dict, List
 from pathlib import Path
 
 from PyQt5.QtCore import QObject, pyqtSignal
@@ -103,6 +104,9 @@ STATS_RE = re.compile(
     re.IGNORECASE
 )
 
+# native/Udp_Capture/udp_dump ek alanları (eski exe'de yok; varsa okunur)
+EXTRA_RE = re.compile(r"(?P<key>pps|ovf|trunc|gaps|late)=(?P<val>[0-9.]+)", re.IGNORECASE)
+
 LISTEN_RE = re.compile(
     r"Listening\s+UDP\s+(?P<ip>\d+\.\d+\.\d+\.\d+):(?P<port>\d+)",
     re.IGNORECASE
@@ -118,6 +122,7 @@ class UdpRunnerConfig:
     port: int = 2000
     out_file: str = "out.bitwrap"
     cwd: Optional[str] = None
+    extra_args: List[str] = field(default_factory=list)   # konumsal argümanlardan önce
 
     # Console/termination behavior
     create_new_process_group: bool = True
@@ -160,7 +165,7 @@ class UdpRunner(QObject):
             self.stopped.emit(-1, "error")
             return
 
-        args = [exe, cfg.bind_ip, str(cfg.port), cfg.out_file]
+        args = [exe, *cfg.extra_args, cfg.bind_ip, str(cfg.port), cfg.out_file]
         cwd = cfg.cwd or os.path.dirname(exe) or None
 
         # Env (portable)
@@ -328,6 +333,9 @@ class UdpRunner(QObject):
                 "queue_mb": float(m.group("qmb")),
                 "drops": int(m.group("drops")),
             }
+            for x in EXTRA_RE.finditer(line[m.end():]):
+                k = x.group("key").lower()
+                d[k] = float(x.group("val")) if k == "pps" else int(float(x.group("val")))
 
             # -------- Aliases for UI compatibility --------
             d["queue"] = d["queue_mb"]                # some controllers read "queue"
@@ -0,0 +1,173 @@
+# -*- coding: utf-8 -*-
+"""
+services/jd_events.py
+- jammer_detect paylaşımlı bellek olay halkası okuyucusu (jd/event_ring.hpp)
+- Windows: mmap tagname=<name>, Linux: /dev/shm/<name>
+- Okuyucu yıkıcı değildir; birden çok denetleyici aynı halkayı okuyabilir
+
+Kullanım:
+    r = JdEventReader("jd_events")
+    for ev in r.poll():          # bekleyen tüm olaylar (bloklamaz)
+        ...
+    ev = r.wait(timeout_s=0.5)   # ilk olay ya da None
+
+Komut satırı: python -m services.jd_events [name]  (olayları yazdırır)
+"""
+
+import mmap
+import os
+import struct
+import sys
+import time
+from collections import namedtuple
+
+MAGIC = 0x5645444A          # 'JDEV'
+VERSION = 1
+HEADER_SIZE = 128
+HEAD_OFFSET = 64
+
+EV_DETECT, EV_POWER, EV_HOP, EV_CHANNEL = 1, 2, 3, 4
+JDX_START, JDX_TICK, JDX_STOP = 1, 2, 3
+
+_HDR = struct.Struct("<IHHIIqqI")                 # magic, version, header_size, record_size, capacity, unix_off, created, pid
+_REC = struct.Struct("<QQHBBI")                   # seq, t_ns, type, version, _r, size
+_U64 = struct.Struct("<Q")
+
+_PAYLOAD = {
+    EV_DETECT:  (struct.Struct("<QQffB7x"),  ("session", "frame", "power_dbm", "threshold_dbm", "state")),
+    EV_POWER:   (struct.Struct("<QffBB6x"),  ("frame", "power_dbm", "threshold_dbm", "over", "jammed")),
+    EV_HOP:     (struct.Struct("<QQqIi"),    ("session", "slot", "slot_start_ns", "dwell_us", "value")),
+    EV_CHANNEL: (struct.Struct("<QQffB7x"),  ("hz", "frame", "power_dbm", "threshold_dbm", "jammed")),
+}
+
+# t_ns: yazarın monotonik saati; unix_ns = t_ns + halka başlığındaki ofset
+Event = namedtuple("Event", "ticket t_ns unix_ns type version data")
+
+
+class JdEventReader:
+    def __init__(self, name: str = "jd_events", from_start: bool = False):
+        self.name = name
+        self._mm = None
+        self.lost = 0                 # halka tarafından geçilen (okunamadan üzerine yazılan) olay
+        self._open()
+        head = self._head()
+        # Varsayılan: yalnız yeni olaylar; from_start: halkada kalan en eskiden başla
+        self._next = max(0, head - self.capacity) if from_start else head
+
+    # ---- segment ----
+    def _open(self):
+        if os.name == "nt":
+            # Var olan eşlemeyi açar; boyut başlıktan okunup yeniden eşlenir
+            mm = mmap.mmap(-1, HEADER_SIZE, tagname=self.name, access=mmap.ACCESS_READ)
+            hdr = _HDR.unpack_from(mm, 0)
+            mm.close()
+            if hdr[0] != MAGIC:
+                raise FileNotFoundError(f"event ring '{self.name}' not found")
+            size = HEADER_SIZE + hdr[3] * hdr[4]
+            self._mm = mmap.mmap(-1, size, tagname=self.name, access=mmap.ACCESS_READ)
+        else:
+            fd = os.open(f"/dev/shm/{self.name}", os.O_RDONLY)
+            try:
+                self._mm = mmap.mmap(fd, 0, access=mmap.ACCESS_READ)
+            finally:
+                os.close(fd)
+        magic, ver, hsz, rsz, cap, off, created, pid = _HDR.unpack_from(self._mm, 0)
+        if magic != MAGIC or ver != VERSION or hsz != HEADER_SIZE:
+            self.close()
+            raise RuntimeError(f"event ring '{self.name}': bad header (magic={magic:#x} ver={ver})")
+        self.record_size = rsz
+        self.capacity = cap
+        self.unix_off_ns = off
+        self.created_unix_ns = created
+        self.writer_pid = pid
+
+    def close(self):
+        if self._mm is not None:
+            self._mm.close()
+            self._mm = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def _head(self) -> int:
+        return _U64.unpack_from(self._mm, HEAD_OFFSET)[0]
+
+    # ---- okuma ----
+    def _read_one(self):
+        """(Event|None, durum): durum 'ok' | 'empty' | 'lapped'"""
+        t = self._next
+        base = HEADER_SIZE + (t % self.capacity) * self.record_size
+        want = 2 * t + 2
+        s1 = _U64.unpack_from(self._mm, base)[0]
+        if s1 < want:
+            return None, "empty"
+        if s1 > want:
+            return None, "lapped"
+        raw = self._mm[base:base + self.record_size]
+        if _U64.unpack_from(self._mm, base)[0] != s1:
+            return None, "lapped"           # okurken üzerine yazıldı
+        _, t_ns, typ, ver, _, size = _REC.unpack_from(raw, 0)
+        payload = raw[_REC.size:_REC.size + size]
+        spec = _PAYLOAD.get(typ)
+        if spec is not None and ver == 1 and size >= spec[0].size:
+            data = dict(zip(spec[1], spec[0].unpack_from(payload, 0)))
+        else:
+            data = {"raw": payload}
+        return Event(t, t_ns, t_ns + self.unix_off_ns, typ, ver, data), "ok"
+
+    def poll(self, max_events: int = 0):
+        """Bekleyen olayları döndürür (bloklamaz). max_events > 0: en çok bu kadar."""
+        out = []
+        while not max_events or len(out) < max_events:
+            ev, st = self._read_one()
+            if st == "ok":
+                out.append(ev)
+                self._next += 1
+            elif st == "lapped":
+                # Yazar bir tur öne geçti: halkadaki en eski olaya atla
+                head = self._head()
+                nxt = max(self._next + 1, head - self.capacity)
+                self.lost += nxt - self._next
+                self._next = nxt
+            else:
+                break
+        return out
+
+    def wait(self, timeout_s: float = None, spin_s: float = 0.0005):
+        """İlk olayı bekler. Önce kısa süre döner (µs gecikme), sonra 1 ms uyuyarak yoklar."""
+        t0 = time.perf_counter()
+        while True:
+            ev = self.poll(1)
+            if ev:
+                return ev[0]
+            el = time.perf_counter() - t0
+            if timeout_s is not None and el >= timeout_s:
+                return None
+            if el >= spin_s:
+                time.sleep(0.001)
+
+    def pending(self) -> int:
+        return max(0, self._head() - self._next)
+
+
+def _main(argv):
+    name = argv[1] if len(argv) > 1 else "jd_events"
+    names = {EV_DETECT: "DETECT", EV_POWER: "POWER", EV_HOP: "HOP", EV_CHANNEL: "CHANNEL"}
+    with JdEventReader(name) as r:
+        print(f"[jd_events] {name}: capacity={r.capacity} writer_pid={r.writer_pid}")
+        try:
+            while True:
+                ev = r.wait(1.0)
+                if ev is None:
+                    continue
+                lag_us = (time.time_ns() - ev.unix_ns) / 1e3
+                print(f"{ev.ticket:>10} {names.get(ev.type, ev.type):<8} lag={lag_us:8.1f}us lost={r.lost} {ev.data}")
+        except KeyboardInterrupt:
+            pass
+
+
+if __name__ == "__main__":
+    _main(sys.argv)
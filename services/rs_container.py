@@ -104,6 +104,36 @@ class RSContainer:
             except Exception:
                 pass
 
+        # ------- Soft-decision hints (ofdm_rx_file_ex .rseh sidecar) -------
+        self._hints_load = getattr(self._lib, "rs_hints_load", None)
+        if self._hints_load:
+            self._hints_load.argtypes = [ctypes.c_char_p, ctypes.c_uint64]
+            self._hints_load.restype = ctypes.c_int
+        self._hints_append = getattr(self._lib, "rs_hints_append", None)
+        if self._hints_append:
+            self._hints_append.argtypes = [ctypes.c_char_p, ctypes.c_uint64]
+            self._hints_append.restype = ctypes.c_int
+        self._hints_clear = getattr(self._lib, "rs_hints_clear", None)
+        if self._hints_clear:
+            self._hints_clear.argtypes = []
+            self._hints_clear.restype = None
+        self._set_erase_thr = getattr(self._lib, "rs_set_erasure_threshold", None)
+        if self._set_erase_thr:
+            self._set_erase_thr.argtypes = [ctypes.c_int]
+            self._set_erase_thr.restype = None
+        self._get_hint_stats = getattr(self._lib, "rs_get_hint_stats", None)
+        if self._get_hint_stats:
+            self._get_hint_stats.argtypes = [ctypes.POINTER(ctypes.c_uint64)]
+            self._get_hint_stats.restype = None
+        self._get_gap_stats = getattr(self._lib, "rs_get_gap_stats", None)
+        if self._get_gap_stats:
+            self._get_gap_stats.argtypes = [ctypes.POINTER(ctypes.c_uint64)]
+            self._get_gap_stats.restype = None
+        self._get_crc_stats = getattr(self._lib, "rs_get_crc_stats", None)
+        if self._get_crc_stats:
+            self._get_crc_stats.argtypes = [ctypes.POINTER(ctypes.c_uint64)]
+            self._get_crc_stats.restype = None
+
     # ---------------- ENCODE ----------------
     def encode_file(self, input_path: str, output_path: str,
                     r: int, il_depth: int, slice_bytes: int,
@@ -182,6 +212,76 @@ class RSContainer:
             "ber_est":            float(st.ber_est),
         }
 
+    # ---------------- Soft-decision hints ----------------
+    def load_hints(self, hints_path: str, base_bit: int) -> int:
+        """
+        Load an RSEH reliability sidecar for the next decode_file() call(s).
+        base_bit: first container bit in the received stream, i.e.
+        bitunwrap start_flag_pos + len(start_flag_bits).
+        Returns the number of loaded ranges (0 if the DLL has no hint support).
+        """
+        if not self._hints_load:
+            return 0
+        n = self._hints_load(str(hints_path).encode("utf-8"), ctypes.c_uint64(int(base_bit)))
+        if n < 0:
+            raise RuntimeError(f"Hint load failed (rc={n}).")
+        return int(n)
+
+    def append_hints(self, hints_path: str, base_bit: int) -> int:
+        """
+        Add a second RSEH sidecar to the loaded hints (e.g. udp_dump sequence gaps on top of
+        ofdm_rx_file_ex reliabilities). Returns the total number of ranges.
+        """
+        if not self._hints_append:
+            return 0
+        n = self._hints_append(str(hints_path).encode("utf-8"), ctypes.c_uint64(int(base_bit)))
+        if n < 0:
+            raise RuntimeError(f"Hint append failed (rc={n}).")
+        return int(n)
+
+    def clear_hints(self):
+        if self._hints_clear:
+            self._hints_clear()
+
+    def set_erasure_threshold(self, rel_below: int):
+        """Bytes with reliability (P(correct)*255) below this become erasures (default 170)."""
+        if self._set_erase_thr:
+            self._set_erase_thr(int(rel_below))
+
+    def get_hint_stats(self):
+        if not self._get_hint_stats:
+            return None
+        arr = (ctypes.c_uint64 * 4)()
+        self._get_hint_stats(arr)
+        return {
+            "hints":             int(arr[0]),
+            "slices_salvaged":   int(arr[1]),
+            "hint_erasure_cols": int(arr[2]),
+            "hint_retry_cols":   int(arr[3]),
+        }
+
+    def get_gap_stats(self):
+        """Known-missing ranges (RSEH flag bit0) the decoder jumped over instead of scanning."""
+        if not self._get_gap_stats:
+            return None
+        arr = (ctypes.c_uint64 * 2)()
+        self._get_gap_stats(arr)
+        return {
+            "gaps_skipped":  int(arr[0]),
+            "bytes_skipped": int(arr[1]),
+        }
+
+    def get_crc_stats(self):
+        """Frames verified from combined slice CRCs (RS skipped) vs. frames sent to RS decode."""
+        if not self._get_crc_stats:
+            return None
+        arr = (ctypes.c_uint64 * 2)()
+        self._get_crc_stats(arr)
+        return {
+            "frames_crc_verified": int(arr[0]),
+            "frames_rs_decoded":   int(arr[1]),
+        }
+
     def set_residual_coeff(self, v: float):
         if self._set_res_coeff:
             self._set_res_coeff(float(v))